@@ -746,17 +746,33 @@ void DataSet::p_read_variable_len(const hid_t mem_type_id, const hid_t mem_space
     // Prepare and call C API to read dataset.
     char *strg_C;
 
+    // The C library allocates the string in an arena set in a copy of
+    // the transfer property list, whatever VL allocator the list has
+    H5D_vlen_arena_t *arena = H5Dvlen_arena_create();
+    if (arena == NULL)
+        throw DataSetIException("DataSet::read", "H5Dvlen_arena_create failed");
+    hid_t arena_plist_id = (xfer_plist_id == H5P_DEFAULT) ? H5Pcreate(H5P_DATASET_XFER) : H5Pcopy(xfer_plist_id);
+    if (arena_plist_id < 0 || H5Pset_vlen_arena(arena_plist_id, arena) < 0)
+    {
+        if (arena_plist_id >= 0)
+            H5Pclose(arena_plist_id);
+        H5Dvlen_arena_free(arena);
+        throw DataSetIException("DataSet::read", "setting the VL arena failed");
+    }
+
     // Read dataset, no allocation for variable-len string; C library will
-    herr_t ret_value = H5Dread(id, mem_type_id, mem_space_id, file_space_id, xfer_plist_id, &strg_C);
+    herr_t ret_value = H5Dread(id, mem_type_id, mem_space_id, file_space_id, arena_plist_id, &strg_C);
+    H5Pclose(arena_plist_id);
 
     if (ret_value < 0)
     {
+        H5Dvlen_arena_free(arena);
         throw DataSetIException("DataSet::read", "H5Dread failed for variable length string");
     }
 
     // Get string from the C char* and release resource allocated by C API
     strg = strg_C;
-    HDfree(strg_C);
+    H5Dvlen_arena_free(arena);
 }
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
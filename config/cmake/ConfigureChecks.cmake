@@ -125,6 +125,21 @@ if (NOT WINDOWS)
     list (APPEND LINK_LIBS posix4)
   endif ()
 endif ()
+
+# Find the library containing shm_open()
+if (NOT WINDOWS)
+  CHECK_FUNCTION_EXISTS (shm_open SHM_OPEN_IN_LIBC)
+  CHECK_LIBRARY_EXISTS (rt shm_open "" SHM_OPEN_IN_LIBRT)
+  if (SHM_OPEN_IN_LIBC)
+    set (H5_HAVE_SHM_OPEN 1)
+  elseif (SHM_OPEN_IN_LIBRT)
+    set (H5_HAVE_SHM_OPEN 1)
+    list (FIND LINK_LIBS rt RT_IN_LINK_LIBS)
+    if (RT_IN_LINK_LIBS EQUAL -1)
+      list (APPEND LINK_LIBS rt)
+    endif ()
+  endif ()
+endif ()
 #-----------------------------------------------------------------------------
 
 #-----------------------------------------------------------------------------
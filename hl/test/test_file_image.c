@@ -24,6 +24,9 @@
 #define SUPER_STATUS_FLAGS_OFF_V0_V1    20
 #define SUPER_STATUS_FLAGS_SIZE_V0_V1   4
 
+/* Number of times a file image is opened to measure the cost of opening */
+#define IMAGE_NOPENS    1000
+
 /* Test of file image operations.
 
    The following code provides a means to thoroughly test the file image
@@ -511,6 +514,152 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+* test the read-only image driver, which opens images in the application's
+* buffers without copying them, and compare the cost of opening an image
+* with it to that of H5LTopen_file_image()
+*-------------------------------------------------------------------------
+*/
+static int
+test_image_driver(void)
+{
+    const char  *filename = "image_driver.h5";
+    hid_t       file_id = -1, dset_id = -1, space_id = -1, fapl = -1, fapl2 = -1;
+    hsize_t     dims[RANK] = {2,3};
+    int         data1[6] = {1,2,3,4,5,6};
+    int         data2[6];
+    void        *image = NULL;          /* the file image */
+    ssize_t     image_size;
+    const void  *buf = NULL;
+    size_t      size = 0;
+    void        *handle_ptr = NULL;
+    double      start_time, image_time, lt_time;
+    herr_t      status;
+    size_t      i;
+
+    TESTING("read-only image driver");
+
+    /* create a file and get its image */
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_PUTS_ERROR("H5Fcreate() failed");
+    if ((space_id = H5Screate_simple(RANK, dims, NULL)) < 0)
+        FAIL_PUTS_ERROR("H5Screate_simple() failed");
+    if ((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_PUTS_ERROR("H5Dcreate() failed");
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data1) < 0)
+        FAIL_PUTS_ERROR("H5Dwrite() failed");
+    if (H5Dclose(dset_id) < 0 || H5Sclose(space_id) < 0)
+        FAIL_PUTS_ERROR("H5Dclose() failed");
+    if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0)
+        FAIL_PUTS_ERROR("H5Fflush() failed");
+    if ((image_size = H5Fget_file_image(file_id, NULL, (size_t)0)) < 0)
+        FAIL_PUTS_ERROR("H5Fget_file_image() failed");
+    if (NULL == (image = HDmalloc((size_t)image_size)))
+        FAIL_PUTS_ERROR("malloc() failed");
+    if (H5Fget_file_image(file_id, image, (size_t)image_size) != image_size)
+        FAIL_PUTS_ERROR("H5Fget_file_image() failed");
+    if (H5Fclose(file_id) < 0)
+        FAIL_PUTS_ERROR("H5Fclose() failed");
+
+    /* set up a file access property list with the image */
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        FAIL_PUTS_ERROR("H5Pcreate() failed");
+    H5E_BEGIN_TRY {
+        status = H5Pset_fapl_image(fapl, NULL, (size_t)image_size);
+    } H5E_END_TRY;
+    VERIFY(status < 0, "H5Pset_fapl_image() with no image should fail");
+    if (H5Pset_fapl_image(fapl, image, (size_t)image_size) < 0)
+        FAIL_PUTS_ERROR("H5Pset_fapl_image() failed");
+    if (H5Pget_fapl_image(fapl, &buf, &size) < 0)
+        FAIL_PUTS_ERROR("H5Pget_fapl_image() failed");
+    VERIFY(buf == image && size == (size_t)image_size, "H5Pget_fapl_image() returned the wrong image");
+
+    /* the image can't be opened for writing */
+    H5E_BEGIN_TRY {
+        file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl);
+    } H5E_END_TRY;
+    VERIFY(file_id < 0, "H5Fopen() of an image for writing should fail");
+
+    /* open the image and check that the driver uses the application's buffer */
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_PUTS_ERROR("H5Fopen() failed");
+    if (H5Fget_vfd_handle(file_id, H5P_DEFAULT, &handle_ptr) < 0)
+        FAIL_PUTS_ERROR("H5Fget_vfd_handle() failed");
+    VERIFY(*(const void **)handle_ptr == image, "the image driver copied the image");
+    if ((fapl2 = H5Fget_access_plist(file_id)) < 0)
+        FAIL_PUTS_ERROR("H5Fget_access_plist() failed");
+    if (H5Pget_fapl_image(fapl2, &buf, &size) < 0)
+        FAIL_PUTS_ERROR("H5Pget_fapl_image() failed");
+    VERIFY(buf == image && size == (size_t)image_size, "H5Pget_fapl_image() returned the wrong image");
+    if (H5Pclose(fapl2) < 0)
+        FAIL_PUTS_ERROR("H5Pclose() failed");
+
+    /* read the dataset, and check that it can't be written */
+    if ((dset_id = H5Dopen2(file_id, DSET_NAME, H5P_DEFAULT)) < 0)
+        FAIL_PUTS_ERROR("H5Dopen() failed");
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data2) < 0)
+        FAIL_PUTS_ERROR("H5Dread() failed");
+    for (i = 0; i < 6; i++)
+        if (data2[i] != data1[i])
+            FAIL_PUTS_ERROR("comparison of image values with original data failed");
+    H5E_BEGIN_TRY {
+        status = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data1);
+    } H5E_END_TRY;
+    VERIFY(status < 0, "H5Dwrite() to an image should fail");
+    if (H5Dclose(dset_id) < 0)
+        FAIL_PUTS_ERROR("H5Dclose() failed");
+    if (H5Fclose(file_id) < 0)
+        FAIL_PUTS_ERROR("H5Fclose() failed");
+
+    /* time opening the image with the image driver... */
+    start_time = H5_get_time();
+    for (i = 0; i < IMAGE_NOPENS; i++) {
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+            FAIL_PUTS_ERROR("H5Fopen() failed");
+        if (H5Fclose(file_id) < 0)
+            FAIL_PUTS_ERROR("H5Fclose() failed");
+    } /* end for */
+    image_time = H5_get_time() - start_time;
+
+    /* ...and with H5LTopen_file_image(), which copies it */
+    start_time = H5_get_time();
+    for (i = 0; i < IMAGE_NOPENS; i++) {
+        if ((file_id = H5LTopen_file_image(image, (size_t)image_size, 0)) < 0)
+            FAIL_PUTS_ERROR("H5LTopen_file_image() failed");
+        if (H5Fclose(file_id) < 0)
+            FAIL_PUTS_ERROR("H5Fclose() failed");
+    } /* end for */
+    lt_time = H5_get_time() - start_time;
+
+    if (H5Pclose(fapl) < 0)
+        FAIL_PUTS_ERROR("H5Pclose() failed");
+    if (HDremove(filename) < 0)
+        FAIL_PUTS_ERROR("HDremove() failed");
+    HDfree(image);
+
+    PASSED();
+
+    if (image_time > 0.0 && lt_time > 0.0)
+        printf("    opens/s: image driver %.0f, H5LTopen_file_image %.0f\n",
+               (double)IMAGE_NOPENS / image_time, (double)IMAGE_NOPENS / lt_time);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Pclose(fapl);
+        H5Pclose(fapl2);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    HDremove(filename);
+    if (image)
+        HDfree(image);
+    H5_FAILED();
+    return -1;
+}
+
 /*-------------------------------------------------------------------------
 * the main program
 *-------------------------------------------------------------------------
@@ -535,6 +684,9 @@ int main( void )
     /* Test file image operations. The flag combinations are assigned to file images in round-robin fashion */
     nerrors += test_file_image(open_images, nflags, flags) < 0? 1 : 0;
 
+    /* Test the read-only image driver */
+    nerrors += test_image_driver() < 0? 1 : 0;
+
     if (nerrors) goto error;
     printf("File image tests passed.\n");
     return 0;
@@ -53,6 +53,7 @@ extern jobject visit_callback;
 /* Local Prototypes */
 /********************/
 
+static hid_t H5DreadVL_arena_plist (hid_t xfer_plist_id, H5D_vlen_arena_t **arena);
 static herr_t H5DreadVL_asstr (JNIEnv *env, hid_t did, hid_t tid, hid_t mem_sid, hid_t file_sid, hid_t xfer_plist_id, jobjectArray buf);
 static herr_t H5DreadVL_str (JNIEnv *env, hid_t did, hid_t tid, hid_t mem_sid, hid_t file_sid, hid_t xfer_plist_id, jobjectArray buf);
 static herr_t H5DreadVL_array (JNIEnv *env, hid_t did, hid_t tid, hid_t mem_sid, hid_t file_sid, hid_t xfer_plist_id, jobjectArray buf);
@@ -1021,6 +1022,34 @@ Java_hdf_hdf5lib_H5_H5DreadVL
     return (jint)status;
 } /* end Java_hdf_hdf5lib_H5_H5Dread_1VLStrings */
 
+/*
+ * Returns a copy of the transfer property list that reads VL data into
+ * a new arena, so that all the VL data read with it is released by one
+ * H5Dvlen_arena_free() call.
+ */
+static hid_t
+H5DreadVL_arena_plist
+    (hid_t xfer_plist_id, H5D_vlen_arena_t **arena)
+{
+    hid_t plist_id = -1;
+
+    if ((*arena = H5Dvlen_arena_create()) == NULL)
+        return -1;
+    if (xfer_plist_id == H5P_DEFAULT)
+        plist_id = H5Pcreate(H5P_DATASET_XFER);
+    else
+        plist_id = H5Pcopy(xfer_plist_id);
+    if (plist_id < 0 || H5Pset_vlen_arena(plist_id, *arena) < 0) {
+        if (plist_id >= 0)
+            H5Pclose(plist_id);
+        H5Dvlen_arena_free(*arena);
+        *arena = NULL;
+        return -1;
+    } /* end if */
+
+    return plist_id;
+} /* end H5DreadVL_arena_plist */
+
 herr_t
 H5DreadVL_asstr
     (JNIEnv *env, hid_t did, hid_t tid, hid_t mem_sid, hid_t file_sid, hid_t xfer_plist_id, jobjectArray buf)
@@ -1032,6 +1061,8 @@ H5DreadVL_asstr
     hvl_t  *rdata;
     size_t  size;
     size_t  max_len = 0;
+    hid_t   arena_plist_id = -1;
+    H5D_vlen_arena_t *arena = NULL;
     herr_t  status = -1;
 
     n = ENVPTR->GetArrayLength(ENVPAR buf);
@@ -1039,11 +1070,15 @@ H5DreadVL_asstr
     if (rdata == NULL) {
         h5JNIFatalError(env, "H5DreadVL_notstr:  failed to allocate buff for read");
     } /* end if */
+    else if ((arena_plist_id = H5DreadVL_arena_plist(xfer_plist_id, &arena)) < 0) {
+        HDfree(rdata);
+        h5libraryError(env);
+    } /* end else if */
     else {
-        status = H5Dread(did, tid, mem_sid, file_sid, xfer_plist_id, rdata);
+        /* All the VL data is read into the arena and freed with it */
+        status = H5Dread(did, tid, mem_sid, file_sid, arena_plist_id, rdata);
 
         if (status < 0) {
-            H5Dvlen_reclaim(tid, mem_sid, xfer_plist_id, rdata);
             HDfree(rdata);
             h5JNIFatalError(env, "H5DreadVL_notstr: failed to read data");
         } /* end if */
@@ -1059,7 +1094,6 @@ H5DreadVL_asstr
             h5str_new(&h5str, 4 * size);
 
             if (h5str.s == NULL) {
-                H5Dvlen_reclaim(tid, mem_sid, xfer_plist_id, rdata);
                 HDfree(rdata);
                 h5JNIFatalError(env, "H5DreadVL_notstr:  failed to allocate buf");
             } /* end if */
@@ -1072,10 +1106,12 @@ H5DreadVL_asstr
                 } /* end for */
                 h5str_free(&h5str);
 
-                H5Dvlen_reclaim(tid, mem_sid, xfer_plist_id, rdata);
                 HDfree(rdata);
             } /* end else */
         } /* end else */
+
+        H5Pclose(arena_plist_id);
+        H5Dvlen_arena_free(arena);
     } /* end else */
 
     return status;
@@ -1264,6 +1300,8 @@ H5DreadVL_str
     jstring jstr;
     jint    i;
     jint    n;
+    hid_t   arena_plist_id = -1;
+    H5D_vlen_arena_t *arena = NULL;
     herr_t  status = -1;
 
     n = ENVPTR->GetArrayLength(ENVPAR buf);
@@ -1272,11 +1310,19 @@ H5DreadVL_str
     if (strs == NULL) {
         h5JNIFatalError(env, "H5DreadVL_str:  failed to allocate buff for read variable length strings");
     } /* end if */
+    else if ((arena_plist_id = H5DreadVL_arena_plist(xfer_plist_id, &arena)) < 0) {
+        HDfree(strs);
+        h5libraryError(env);
+    } /* end else if */
     else {
-        status = H5Dread(did, tid, mem_sid, file_sid, xfer_plist_id, strs);
+        /*
+        the strings are read into an arena and all freed with it once they are copied,
+        rather than with H5Dvlen_reclaim() or one H5free_memory() call per string, which
+        is slow for a large number of strs (e.g., 1,000,000 strings)
+        */
+        status = H5Dread(did, tid, mem_sid, file_sid, arena_plist_id, strs);
 
         if (status < 0) {
-            H5Dvlen_reclaim(tid, mem_sid, xfer_plist_id, strs);
             HDfree(strs);
             h5JNIFatalError(env, "H5DreadVL_str: failed to read variable length strings");
         } /* end if */
@@ -1284,19 +1330,13 @@ H5DreadVL_str
             for (i=0; i < n; i++) {
                 jstr = ENVPTR->NewStringUTF(ENVPAR strs[i]);
                 ENVPTR->SetObjectArrayElement(ENVPAR buf, i, jstr);
-                H5free_memory (strs[i]);
             } /* end for */
 
-            /*
-            for repeatedly reading a dataset with a large number of strs (e.g., 1,000,000 strings,
-            H5Dvlen_reclaim() may crash on Windows because the Java GC will not be able to collect
-            free space in time. Instead, use "H5free_memory(strs[i])" above to free individual strings
-            after it is done.
-            H5Dvlen_reclaim(tid, mem_sid, xfer_plist_id, strs);
-            */
-
             HDfree(strs);
         } /* end else */
+
+        H5Pclose(arena_plist_id);
+        H5Dvlen_arena_free(arena);
     } /* end else */
 
     return status;
@@ -254,6 +254,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_add_candidate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_sync_timing()
+ *
+ * Purpose:     Copy the sync point totals of this process into *timing.  Zeros are returned if the cache has no
+ *		auxiliary structure, i.e. no sync point was ever run.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_get_sync_timing(const H5AC_t *cache_ptr, H5F_mdc_sync_timing_t *timing)
+{
+    H5AC_aux_t         * aux_ptr;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr != NULL);
+    HDassert(timing != NULL);
+
+    aux_ptr = (H5AC_aux_t *)H5C_get_aux_ptr(cache_ptr);
+    if(aux_ptr != NULL) {
+        HDassert(aux_ptr->magic == H5AC__H5AC_AUX_T_MAGIC);
+        *timing = aux_ptr->sync_timing;
+    } /* end if */
+    else
+        HDmemset(timing, 0, sizeof(*timing));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5AC_get_sync_timing() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -1276,7 +1309,8 @@ H5AC__propagate_and_apply_candidate_list(H5F_t  *f, hid_t dxpl_id)
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, dxpl_id, cache_ptr, num_candidates,
-            candidates_list_ptr, aux_ptr->mpi_rank, aux_ptr->mpi_size);
+            candidates_list_ptr, aux_ptr->mpi_rank, aux_ptr->mpi_size,
+            &aux_ptr->sync_timing);
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
@@ -1703,7 +1737,8 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f, hid_t dxpl_id)
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, dxpl_id, cache_ptr, num_entries,
-            haddr_buf_ptr, aux_ptr->mpi_rank, aux_ptr->mpi_size);
+            haddr_buf_ptr, aux_ptr->mpi_rank, aux_ptr->mpi_size,
+            &aux_ptr->sync_timing);
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
@@ -1903,6 +1938,8 @@ H5AC__rsp__p0_only__flush(H5F_t *f, hid_t dxpl_id)
 
     /* Flush data to disk, from rank 0 process */
     if(aux_ptr->mpi_rank == 0) {
+        size_t        num_cleaned = H5SL_count(aux_ptr->c_slist_ptr);
+        double        start_time = MPI_Wtime();
         herr_t        result;
 
         /* Enable writes during this operation */
@@ -1914,6 +1951,10 @@ H5AC__rsp__p0_only__flush(H5F_t *f, hid_t dxpl_id)
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
 
+        /* Entries flushed are moved to the cleaned list */
+        aux_ptr->sync_timing.flush_time += MPI_Wtime() - start_time;
+        aux_ptr->sync_timing.nentries += (unsigned)(H5SL_count(aux_ptr->c_slist_ptr) - num_cleaned);
+
         /* Check for error on the write operation */
         if(result < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't flush.")
@@ -2018,6 +2059,8 @@ H5AC__rsp__p0_only__flush_to_min_clean(H5F_t *f, hid_t dxpl_id)
             HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
 
         if(0 == aux_ptr->mpi_rank) {
+            size_t       num_cleaned = H5SL_count(aux_ptr->c_slist_ptr);
+            double       start_time = MPI_Wtime();
             herr_t	 result;
 
             /* here, process 0 flushes as many entries as necessary to 
@@ -2035,6 +2078,10 @@ H5AC__rsp__p0_only__flush_to_min_clean(H5F_t *f, hid_t dxpl_id)
             /* Disable writes again */
             aux_ptr->write_permitted = FALSE;
 
+            /* Entries flushed are moved to the cleaned list */
+            aux_ptr->sync_timing.flush_time += MPI_Wtime() - start_time;
+            aux_ptr->sync_timing.nentries += (unsigned)(H5SL_count(aux_ptr->c_slist_ptr) - num_cleaned);
+
             /* Check for error on the write operation */
             if(result < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_flush_to_min_clean() failed.")
@@ -2092,6 +2139,8 @@ H5AC__run_sync_point(H5F_t *f, hid_t dxpl_id, int sync_point_op)
 {
     H5AC_t     * cache_ptr;
     H5AC_aux_t * aux_ptr;
+    double       start_time;
+    double       other_time;
     herr_t	 ret_value = SUCCEED;   /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2118,6 +2167,13 @@ HDfprintf(stdout, "%d:H5AC_propagate...:%u: (u/uu/i/iu/r/ru) = %zu/%u/%zu/%u/%zu
     aux_ptr->rename_dirty_bytes_updates);
 #endif /* H5AC_DEBUG_DIRTY_BYTES_CREATION */
 
+    /* Start timing the sync point.  The write strategy adds to the
+     * entry count and the flush and write times.
+     */
+    start_time = MPI_Wtime();
+    other_time = aux_ptr->sync_timing.flush_time + aux_ptr->sync_timing.write_time;
+    aux_ptr->sync_timing.nsync_points++;
+
     /* clear collective access flag on half of the entries in the
        cache and mark them as independent in case they need to be
        evicted later. All ranks are guranteed to mark the same entries
@@ -2171,6 +2227,15 @@ HDfprintf(stdout, "%d:H5AC_propagate...:%u: (u/uu/i/iu/r/ru) = %zu/%u/%zu/%u/%zu
     /* reset the dirty bytes count */
     aux_ptr->dirty_bytes = 0;
 
+    /* The time not spent flushing or writing entries went into agreeing
+     * on them: building, broadcasting and applying the lists, and the
+     * barriers.
+     */
+    start_time = MPI_Wtime() - start_time;
+    other_time = (aux_ptr->sync_timing.flush_time + aux_ptr->sync_timing.write_time) - other_time;
+    aux_ptr->sync_timing.total_time += start_time;
+    aux_ptr->sync_timing.list_time += start_time - other_time;
+
 #if H5AC_DEBUG_DIRTY_BYTES_CREATION
     aux_ptr->dirty_bytes_propagations     += 1;
     aux_ptr->unprotect_dirty_bytes         = 0;
@@ -355,6 +355,13 @@ H5FL_EXTERN(H5AC_aux_t);
  *		image constructed by MPI process 0.  This field should be 0
  *		if the value is unknown, or if cache image is not enabled.
  *
+ * The following field supports instrumentation of sync points.
+ *
+ * sync_timing: Instance of H5F_mdc_sync_timing_t holding the number of
+ *		sync points run so far, and the total number of entries
+ *		written by this process and time spent in each phase of
+ *		them.  Reported by H5Fget_mdc_sync_timing().
+ *
  ****************************************************************************/
 
 #ifdef H5_HAVE_PARALLEL
@@ -407,6 +414,8 @@ typedef struct H5AC_aux_t
 
     unsigned    p0_image_len;
 
+    H5F_mdc_sync_timing_t sync_timing;
+
 } H5AC_aux_t; /* struct H5AC_aux_t */
 #endif /* H5_HAVE_PARALLEL */
 
@@ -481,6 +481,8 @@ H5_DLL herr_t H5AC_proxy_entry_dest(H5AC_proxy_entry_t *pentry);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5AC_add_candidate(H5AC_t * cache_ptr, haddr_t addr);
+H5_DLL herr_t H5AC_get_sync_timing(const H5AC_t *cache_ptr,
+    H5F_mdc_sync_timing_t *timing);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Debugging functions */
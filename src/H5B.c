@@ -107,6 +107,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MFprivate.h"	/* File memory management		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"         /* Property lists                       */
 
 
@@ -1144,6 +1145,7 @@ H5B__iterate_helper(H5F_t *f, hid_t dxpl_id, const H5B_class_t *type, haddr_t ad
     H5UC_t	        *rc_shared;     /* Ref-counted shared info */
     H5B_shared_t        *shared;        /* Pointer to shared B-tree info */
     H5B_cache_ud_t      cache_udata;    /* User-data for metadata cache callback */
+    H5F_block_t         *ra_blocks = NULL; /* Child nodes to read ahead */
     unsigned            u;              /* Local index variable */
     herr_t              ret_value = H5_ITER_CONT; /* Return value */
 
@@ -1171,6 +1173,18 @@ H5B__iterate_helper(H5F_t *f, hid_t dxpl_id, const H5B_class_t *type, haddr_t ad
     if(NULL == (bt = (H5B_t *)H5AC_protect(f, dxpl_id, H5AC_BT, addr, &cache_udata, H5AC__READ_ONLY_FLAG)))
         HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, H5_ITER_ERROR, "unable to load B-tree node")
 
+    /* Read ahead the child nodes of an internal node in one request */
+    if(bt->level > 0 && bt->nchildren > 1 && H5F_META_READ_AHEAD_SIZE(f) > 0) {
+        if(NULL == (ra_blocks = (H5F_block_t *)H5MM_malloc(sizeof(H5F_block_t) * bt->nchildren)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed for read-ahead blocks")
+        for(u = 0; u < bt->nchildren; u++) {
+            ra_blocks[u].offset = bt->child[u];
+            ra_blocks[u].length = shared->sizeof_rnode;
+        } /* end for */
+        if(H5F_read_ahead(f, H5FD_MEM_BTREE, (size_t)bt->nchildren, ra_blocks, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_READERROR, H5_ITER_ERROR, "unable to read ahead B-tree nodes")
+    } /* end if */
+
     /* Iterate over node's children */
     for(u = 0; u < bt->nchildren && ret_value == H5_ITER_CONT; u++) {
         if(bt->level > 0)
@@ -1184,6 +1198,8 @@ H5B__iterate_helper(H5F_t *f, hid_t dxpl_id, const H5B_class_t *type, haddr_t ad
 done:
     if(bt && H5AC_unprotect(f, dxpl_id, H5AC_BT, addr, bt, H5AC__NO_FLAGS_SET) < 0)
         HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, H5_ITER_ERROR, "unable to release B-tree node")
+    if(ra_blocks)
+        ra_blocks = (H5F_block_t *)H5MM_xfree(ra_blocks);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5B__iterate_helper() */
@@ -35,6 +35,7 @@
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5B2pkg.h"		/* v2 B-trees				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
 
@@ -1511,6 +1512,7 @@ H5B2__iterate_node(H5B2_hdr_t *hdr, hid_t dxpl_id, uint16_t depth,
     uint8_t *node_native;               /* Pointers to node's native records */
     uint8_t *native = NULL;             /* Pointers to copy of node's native records */
     H5B2_node_ptr_t *node_ptrs = NULL;  /* Pointers to node's node pointers */
+    H5F_block_t *ra_blocks = NULL;      /* Child nodes to read ahead */
     hbool_t node_pinned = FALSE;        /* Whether node is pinned */
     unsigned u;                         /* Local index */
     herr_t ret_value = H5_ITER_CONT;    /* Iterator return value */
@@ -1570,6 +1572,20 @@ H5B2__iterate_node(H5B2_hdr_t *hdr, hid_t dxpl_id, uint16_t depth,
     else
         node = NULL;
 
+    /* Read ahead the child nodes of an internal node in one request */
+    if(depth > 0 && H5F_META_READ_AHEAD_SIZE(hdr->f) > 0) {
+        size_t nchildren = (size_t)curr_node->node_nrec + 1;   /* # of child nodes */
+
+        if(NULL == (ra_blocks = (H5F_block_t *)H5MM_malloc(sizeof(H5F_block_t) * nchildren)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for read-ahead blocks")
+        for(u = 0; u < nchildren; u++) {
+            ra_blocks[u].offset = node_ptrs[u].addr;
+            ra_blocks[u].length = hdr->node_size;
+        } /* end for */
+        if(H5F_read_ahead(hdr->f, H5FD_MEM_BTREE, nchildren, ra_blocks, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_READERROR, FAIL, "unable to read ahead B-tree nodes")
+    } /* end if */
+
     /* Iterate through records, in order */
     for(u = 0; u < curr_node->node_nrec && !ret_value; u++) {
         /* Descend into child node, if current node is an internal node */
@@ -1601,6 +1617,8 @@ done:
         node_ptrs = (H5B2_node_ptr_t *)H5FL_FAC_FREE(hdr->node_info[depth].node_ptr_fac, node_ptrs);
     if(native)
         native = (uint8_t *)H5FL_FAC_FREE(hdr->node_info[depth].nat_rec_fac, native);
+    if(ra_blocks)
+        ra_blocks = (H5F_block_t *)H5MM_xfree(ra_blocks);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2__iterate_node() */
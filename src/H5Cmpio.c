@@ -62,6 +62,9 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5C__align_candidate_assignment(H5C_t *cache_ptr,
+    unsigned num_candidates, const haddr_t *candidates_list_ptr,
+    int *candidate_assignment_table, int mpi_size, hsize_t stripe_size);
 static herr_t H5C__collective_write(H5F_t *f, hid_t dxpl_id);
 static herr_t H5C__flush_candidate_entries(H5F_t *f, hid_t dxpl_id, 
     unsigned entries_to_flush[H5C_RING_NTYPES], 
@@ -137,6 +140,13 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, hid_t dxpl_id,
  *		give num_candidates % mpi_size processes one extra entry
  *		each to make things work out.
  *
+ *		If the file system stripe size is known, the boundaries
+ *		between processes are then moved forward as needed so that
+ *		no stripe is written by more than one process -- see
+ *		H5C__align_candidate_assignment().  The table remains
+ *		identical on all processes, since it only depends on the
+ *		addresses and sizes of the candidate entries.
+ *
  *		Once the table is constructed, we determine the first and
  *		last entry this process is to flush as follows:
  *
@@ -157,6 +167,10 @@ static herr_t H5C__flush_candidates_in_ring(H5F_t *f, hid_t dxpl_id,
  *		Note that this function will fail if any protected or 
  *		clean entries appear on the candidate list.
  *
+ *		If timing is not NULL, the number of entries this process
+ *		writes and the time spent flushing them and in the
+ *		collective write are added to it.
+ *
  *		This function is used in managing sync points, and 
  *		shouldn't be used elsewhere.
  *
@@ -176,7 +190,8 @@ H5C_apply_candidate_list(H5F_t * f,
                          unsigned num_candidates,
                          haddr_t * candidates_list_ptr,
                          int mpi_rank,
-                         int mpi_size)
+                         int mpi_size,
+                         H5F_mdc_sync_timing_t * timing)
 {
     int                 i;
     int			m;
@@ -186,6 +201,8 @@ H5C_apply_candidate_list(H5F_t * f,
     unsigned		total_entries_to_clear = 0;
     unsigned		total_entries_to_flush = 0;
     int               * candidate_assignment_table = NULL;
+    hsize_t             stripe_size = 0;
+    double              start_time = 0.0;
     unsigned            entries_to_flush[H5C_RING_NTYPES];
     unsigned            entries_to_clear[H5C_RING_NTYPES];
     haddr_t		addr;
@@ -279,6 +296,15 @@ H5C_apply_candidate_list(H5F_t * f,
     }
 #endif /* H5C_DO_SANITY_CHECKS */
 
+    /* Keep processes from writing to the same file system stripe */
+    if(mpi_size > 1) {
+        if(H5F_mpi_get_stripe_size(f, &stripe_size) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't get stripe size")
+        if(stripe_size > 1)
+            if(H5C__align_candidate_assignment(cache_ptr, num_candidates, candidates_list_ptr, candidate_assignment_table, mpi_size, stripe_size) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't align candidate assignment table")
+    } /* end if */
+
     first_entry_to_flush = candidate_assignment_table[mpi_rank];
     last_entry_to_flush = candidate_assignment_table[mpi_rank + 1] - 1;
 
@@ -387,8 +413,14 @@ H5C_apply_candidate_list(H5F_t * f,
      * If we don't do this, my experiments indicate that we will have a
      * noticably poorer hit ratio as a result.
      */
+    if(timing)
+        start_time = MPI_Wtime();
      if(H5C__flush_candidate_entries(f, dxpl_id, entries_to_flush, entries_to_clear) < 0)
          HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "flush candidates failed")
+    if(timing) {
+        timing->nentries += total_entries_to_flush;
+        timing->flush_time += MPI_Wtime() - start_time;
+    } /* end if */
 
     /* If we've deferred writing to do it collectively, take care of that now */
     if(f->coll_md_write) {
@@ -396,8 +428,12 @@ H5C_apply_candidate_list(H5F_t * f,
         HDassert(cache_ptr->coll_write_list);
 
         /* Write collective list */
+        if(timing)
+            start_time = MPI_Wtime();
         if(H5C__collective_write(f, dxpl_id) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write metadata collectively")
+        if(timing)
+            timing->write_time += MPI_Wtime() - start_time;
     } /* end if */
 
 done:
@@ -907,6 +943,67 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_clear_coll_entries */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__align_candidate_assignment
+ *
+ * Purpose:     Move the boundaries in the candidate assignment table
+ *		forward so that the entries written by different processes
+ *		never share a file system stripe of stripe_size bytes.
+ *		Entries spanning a stripe boundary stay with the process
+ *		that writes the preceding entries.
+ *
+ *		This may leave some processes with nothing to write, which
+ *		is still cheaper than having several processes contend for
+ *		the lock on one stripe.
+ *
+ * Return:      Success:        SUCCEED
+ *
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__align_candidate_assignment(H5C_t *cache_ptr, unsigned num_candidates,
+    const haddr_t *candidates_list_ptr, int *candidate_assignment_table,
+    int mpi_size, hsize_t stripe_size)
+{
+    H5C_cache_entry_t *	entry_ptr = NULL;
+    int                 i;
+    unsigned            u;
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cache_ptr != NULL);
+    HDassert(candidates_list_ptr != NULL);
+    HDassert(candidate_assignment_table != NULL);
+    HDassert(stripe_size > 1);
+
+    for(i = 1; i < mpi_size; i++) {
+        u = (unsigned)MAX(candidate_assignment_table[i], candidate_assignment_table[i - 1]);
+
+        /* Advance while the first entry of process i starts in the
+         * stripe where the last entry of process i - 1 ends
+         */
+        while(u > 0 && u < num_candidates) {
+            H5C__SEARCH_INDEX(cache_ptr, candidates_list_ptr[u - 1], entry_ptr, FAIL)
+            if(entry_ptr == NULL)
+                HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "listed candidate entry not in cache?!?!?")
+
+            if((candidates_list_ptr[u] / stripe_size) > ((entry_ptr->addr + entry_ptr->size - 1) / stripe_size))
+                break;
+            u++;
+        } /* end while */
+
+        candidate_assignment_table[i] = (int)u;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__align_candidate_assignment() */
+
 
 /*-------------------------------------------------------------------------
  *
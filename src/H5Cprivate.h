@@ -2324,7 +2324,7 @@ H5_DLL herr_t H5C_get_mdc_image_info(H5C_t *cache_ptr, haddr_t *image_addr, hsiz
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5C_apply_candidate_list(H5F_t *f, hid_t dxpl_id,
     H5C_t *cache_ptr, unsigned num_candidates, haddr_t *candidates_list_ptr,
-    int mpi_rank, int mpi_size);
+    int mpi_rank, int mpi_size, H5F_mdc_sync_timing_t *timing);
 H5_DLL herr_t H5C_construct_candidate_list__clean_cache(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_construct_candidate_list__min_clean(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_clear_coll_entries(H5C_t * cache_ptr, hbool_t partial);
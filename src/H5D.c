@@ -723,6 +723,8 @@ done:
  *      in memory.  Only frees the VL data in the selection defined in the
  *      dataspace.  The dataset transfer property list is required to find the
  *      correct allocation/free methods for the VL data in the buffer.
+ *      If the property list has a VL arena (see H5Pset_vlen_arena()), the
+ *      buffer isn't visited at all: that data is freed with the arena.
  *
  * Return:	Non-negative on success, negative on failure
  *
@@ -878,6 +880,65 @@ done:
     FUNC_LEAVE_API(ret_value)
 }   /* end H5Dvlen_get_buf_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dvlen_arena_create
+ *
+ * Purpose:	Creates an arena for variable-length data.  When the arena
+ *      is set in a dataset transfer property list with H5Pset_vlen_arena(),
+ *      the VL data read with that property list is allocated from a few
+ *      large blocks of the arena instead of separately for each sequence.
+ *      All of it is then released at once with H5Dvlen_arena_free().
+ *
+ * Return:	Success:	Pointer to the new arena
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_vlen_arena_t *
+H5Dvlen_arena_create(void)
+{
+    H5D_vlen_arena_t *ret_value;        /* Return value */
+
+    FUNC_ENTER_API(NULL)
+    H5TRACE0("*x","");
+
+    if(NULL == (ret_value = H5D__vlen_arena_create()))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, NULL, "unable to create VL arena")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5Dvlen_arena_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dvlen_arena_free
+ *
+ * Purpose:	Frees an arena created with H5Dvlen_arena_create(), along
+ *      with all the variable-length data read into it.  The arena must
+ *      no longer be set in any dataset transfer property list in use.
+ *
+ * Return:	Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dvlen_arena_free(H5D_vlen_arena_t *arena)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "*x", arena);
+
+    if(NULL == arena)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no VL arena")
+
+    H5D__vlen_arena_free(arena);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+}   /* end H5Dvlen_arena_free() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Dset_extent
@@ -3807,6 +3807,8 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     hsize_t     edge_chunk_scaled[H5O_LAYOUT_NDIMS]; /* Offset of the unfiltered edge chunks at the edge of each dimension */
     unsigned    nunfilt_edge_chunk_dims = 0; /* Number of dimensions on an edge */
     const H5O_storage_chunk_t *sc = &(layout->storage.u.chunk);
+    haddr_t     resv_addr = HADDR_UNDEF; /* Address of next chunk in the file space reserved for all chunks */
+    haddr_t     resv_end = HADDR_UNDEF; /* End of the file space reserved for all chunks */
     herr_t	ret_value = SUCCEED;	/* Return value */
 
     FUNC_ENTER_PACKAGE_TAG(md_dxpl_id, dset->oloc.addr, FAIL)
@@ -3942,6 +3944,44 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     idx_info.layout = &dset->shared->layout.u.chunk;
     idx_info.storage = &dset->shared->layout.storage.u.chunk;
 
+    /* Check for reserving the file space for all the new chunks at once */
+    /* (Only possible when all the chunks are the same size, i.e. unfiltered.
+     *  The chunks are carved from the reserved space, in the order they are
+     *  visited below, instead of being allocated individually)
+     */
+    if(H5F_CHUNK_ALLOC_RESERVE(dset->oloc.file) && pline->nused == 0
+            && H5D_CHUNK_IDX_NONE != sc->idx_type) {
+        hsize_t nchunks_new = 1;        /* # of chunks in the new dataspace */
+        hsize_t nchunks_old = 1;        /* # of those chunks within the original dataspace */
+        hsize_t nchunks;                /* # of chunks to allocate */
+
+        for(op_dim = 0; op_dim < space_ndims; op_dim++) {
+            nchunks_new *= max_unalloc[op_dim] + 1;
+            nchunks_old *= MIN(min_unalloc[op_dim], max_unalloc[op_dim] + 1);
+        } /* end for */
+        nchunks = nchunks_new - nchunks_old;
+
+        /* Chunks that would be aligned individually are only reserved
+         * together when no padding is needed between them, since padding
+         * inside the reservation could never be reused.  The reservation
+         * is aligned, so chunks that are a multiple of the alignment stay
+         * aligned.  Also fall back to allocating chunks individually if
+         * the reservation's size would overflow.
+         */
+        if(nchunks > 1 && nchunks <= (HSIZET_MAX / (hsize_t)orig_chunk_size)) {
+            hsize_t alignment = H5F_ALIGNMENT(dset->oloc.file);
+
+            if(!(alignment > 1 && (hsize_t)orig_chunk_size >= H5F_THRESHOLD(dset->oloc.file)
+                    && ((hsize_t)orig_chunk_size % alignment) != 0)) {
+                hsize_t resv_size = nchunks * (hsize_t)orig_chunk_size;
+
+                if(HADDR_UNDEF == (resv_addr = H5MF_alloc(dset->oloc.file, H5FD_MEM_DRAW, md_dxpl_id, resv_size)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to reserve file space for chunks")
+                resv_end = resv_addr + resv_size;
+            } /* end if */
+        } /* end if */
+    } /* end if */
+
     /* Loop over all chunks */
     /* The algorithm is:
      *  For each dimension:
@@ -4083,7 +4123,14 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             udata.filter_mask = filter_mask;
 
             /* Allocate the chunk (with all processes) */
-	    if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
+            if(H5F_addr_defined(resv_addr)) {
+                /* Take the next chunk from the reserved file space */
+                /* (It's only consumed once it's in the index, below) */
+                HDassert(H5F_addr_le(resv_addr + orig_chunk_size, resv_end));
+                udata.chunk_block.offset = resv_addr;
+                need_insert = TRUE;
+            } /* end if */
+	    else if(H5D__chunk_file_alloc(&idx_info, NULL, &udata.chunk_block, &need_insert, scaled) < 0)
 		HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk on chunk level")
             HDassert(H5F_addr_defined(udata.chunk_block.offset));
 
@@ -4127,6 +4174,10 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
                 if((ops->insert)(&idx_info, &udata, dset) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
 
+            /* Consume the chunk's part of the reserved file space */
+            if(H5F_addr_defined(resv_addr))
+                resv_addr += orig_chunk_size;
+
             /* Increment indices and adjust the edge chunk state */
             carry = TRUE;
             for(i = ((int)space_ndims - 1); i >= 0; --i) {
@@ -4187,6 +4238,12 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
 
 done:
+    /* Release any reserved file space that wasn't used for a chunk */
+    /* (i.e. when the loop above failed part-way) */
+    if(H5F_addr_defined(resv_addr) && H5F_addr_lt(resv_addr, resv_end))
+        if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, md_dxpl_id, resv_addr, (hsize_t)(resv_end - resv_addr)) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release reserved file space for chunks")
+
     /* Release the fill buffer info, if it's been initialized */
     if(fb_info_init && H5D__fill_term(&fb_info) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "Can't release fill buffer info")
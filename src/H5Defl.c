@@ -75,7 +75,12 @@ static ssize_t H5D__efl_writevv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_offset_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_offset_arr[]);
 
+static herr_t H5D__efl_dest(H5D_t *dset, hid_t dxpl_id);
+
 /* Helper routines */
+static herr_t H5D__efl_open(const H5O_efl_t *efl, const H5D_t *dset, size_t idx,
+    hbool_t writable, int *fd);
+static herr_t H5D__efl_close_files(H5D_rdefc_t *cache);
 static herr_t H5D__efl_read(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t size,
     uint8_t *buf);
 static herr_t H5D__efl_write(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t size,
@@ -102,7 +107,7 @@ const H5D_layout_ops_t H5D_LOPS_EFL[1] = {{
     H5D__efl_writevv,
     NULL,
     NULL,
-    NULL
+    H5D__efl_dest
 }};
 
 
@@ -231,6 +236,167 @@ H5D__efl_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t H5_ATTR_UNU
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5D__efl_io_init() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__efl_open
+ *
+ * Purpose:     Returns a descriptor for entry IDX of the external file
+ *              list, opened for writing if WRITABLE is set.  Descriptors
+ *              are kept in the dataset's external file cache until the
+ *              dataset is closed, so the external files are only opened
+ *              once, and a descriptor opened for writing also serves
+ *              reads.  Entries naming the same file share a descriptor.
+ *
+ *              If the process runs out of file descriptors, the ones
+ *              cached for the dataset are closed and the open is retried.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__efl_open(const H5O_efl_t *efl, const H5D_t *dset, size_t idx,
+    hbool_t writable, int *fd)
+{
+    H5D_rdefc_t *cache = &dset->shared->cache.efl;     /* External file cache */
+    char        *full_name = NULL;      /* File name with prefix */
+    int         new_fd = -1;            /* Newly opened descriptor */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(efl && idx < efl->nused);
+    HDassert(fd);
+
+    /* Set up the cache on first use */
+    if(NULL == cache->file) {
+        if(NULL == (cache->file = (H5D_efl_fd_t *)H5MM_malloc(efl->nused * sizeof(H5D_efl_fd_t))))
+            HGOTO_ERROR(H5E_EFL, H5E_CANTALLOC, FAIL, "can't allocate external file cache")
+        cache->nfiles = efl->nused;
+        for(u = 0; u < cache->nfiles; u++) {
+            cache->file[u].fd = -1;
+            cache->file[u].writable = FALSE;
+        } /* end for */
+    } /* end if */
+    HDassert(cache->nfiles == efl->nused);
+
+    /* Use the cached descriptor, if it allows this access */
+    if(cache->file[idx].fd >= 0) {
+        if(cache->file[idx].writable || !writable) {
+            *fd = cache->file[idx].fd;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Drop the read-only descriptor, for all entries sharing it */
+        new_fd = cache->file[idx].fd;
+        for(u = 0; u < cache->nfiles; u++)
+            if(cache->file[u].fd == new_fd)
+                cache->file[u].fd = -1;
+        if(HDclose(new_fd) < 0)
+            HGOTO_ERROR(H5E_EFL, H5E_CLOSEERROR, FAIL, "unable to close external raw data file")
+        new_fd = -1;
+    } /* end if */
+
+    /* Share the descriptor of another entry for the same file */
+    for(u = 0; u < cache->nfiles; u++)
+        if(cache->file[u].fd >= 0 && (cache->file[u].writable || !writable)
+                && !HDstrcmp(efl->slot[u].name, efl->slot[idx].name)) {
+            cache->file[idx] = cache->file[u];
+            *fd = cache->file[idx].fd;
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+    /* Open the file */
+    if(H5_combine_path(dset->shared->extfile_prefix, efl->slot[idx].name, &full_name) < 0)
+        HGOTO_ERROR(H5E_EFL, H5E_NOSPACE, FAIL, "can't build external file name")
+    if((new_fd = HDopen(full_name, writable ? (O_CREAT | O_RDWR) : O_RDONLY, 0666)) < 0 && EMFILE == errno) {
+        if(H5D__efl_close_files(cache) < 0)
+            HGOTO_ERROR(H5E_EFL, H5E_CLOSEERROR, FAIL, "unable to close external raw data files")
+        new_fd = HDopen(full_name, writable ? (O_CREAT | O_RDWR) : O_RDONLY, 0666);
+    } /* end if */
+    if(new_fd < 0) {
+        if(writable && HDaccess(full_name, F_OK) < 0)
+            HGOTO_ERROR(H5E_EFL, H5E_CANTOPENFILE, FAIL, "external raw data file does not exist")
+        else
+            HGOTO_ERROR(H5E_EFL, H5E_CANTOPENFILE, FAIL, "unable to open external raw data file")
+    } /* end if */
+
+    cache->file[idx].fd = new_fd;
+    cache->file[idx].writable = writable;
+    *fd = new_fd;
+
+done:
+    if(full_name)
+        full_name = (char *)H5MM_xfree(full_name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__efl_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__efl_close_files
+ *
+ * Purpose:     Closes the descriptors in an external file cache.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__efl_close_files(H5D_rdefc_t *cache)
+{
+    int         fd;                     /* Descriptor to close */
+    size_t      u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(cache);
+
+    for(u = 0; u < cache->nfiles; u++)
+        if((fd = cache->file[u].fd) >= 0) {
+            /* Close shared descriptors only once */
+            for(v = u; v < cache->nfiles; v++)
+                if(cache->file[v].fd == fd)
+                    cache->file[v].fd = -1;
+            if(HDclose(fd) < 0)
+                ret_value = FAIL;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__efl_close_files() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__efl_dest
+ *
+ * Purpose:     Closes the external raw data files left open by I/O on the
+ *              dataset.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__efl_dest(H5D_t *dset, hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5D_rdefc_t *cache = &dset->shared->cache.efl;     /* External file cache */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(cache->file) {
+        if(H5D__efl_close_files(cache) < 0)
+            HDONE_ERROR(H5E_EFL, H5E_CLOSEERROR, FAIL, "unable to close external raw data files")
+        cache->file = (H5D_efl_fd_t *)H5MM_xfree(cache->file);
+        cache->nfiles = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__efl_dest() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__efl_read
@@ -257,9 +423,10 @@ H5D__efl_read(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t size
 #endif /* NDEBUG */
     hsize_t     skip = 0;
     haddr_t     cur;
+    HDoff_t     offset;
+    size_t      nread;
     ssize_t	n;
     size_t      u;                      /* Local index variable */
-    char *full_name = NULL;             /* File name with prefix */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_STATIC
@@ -286,12 +453,13 @@ H5D__efl_read(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t size
             HGOTO_ERROR(H5E_EFL, H5E_OVERFLOW, FAIL, "read past logical end of file")
         if(H5F_OVERFLOW_HSIZET2OFFT((hsize_t)efl->slot[u].offset + skip))
             HGOTO_ERROR(H5E_EFL, H5E_OVERFLOW, FAIL, "external file address overflowed")
-        if(H5_combine_path(dset->shared->extfile_prefix, efl->slot[u].name, &full_name) < 0)
-            HGOTO_ERROR(H5E_EFL, H5E_NOSPACE, FAIL, "can't build external file name")
-        if((fd = HDopen(full_name, O_RDONLY, 0)) < 0)
+        if(H5D__efl_open(efl, dset, u, FALSE, &fd) < 0)
             HGOTO_ERROR(H5E_EFL, H5E_CANTOPENFILE, FAIL, "unable to open external raw data file")
-        if(HDlseek(fd, (HDoff_t)(efl->slot[u].offset + (HDoff_t)skip), SEEK_SET) < 0)
+        offset = (HDoff_t)(efl->slot[u].offset + (HDoff_t)skip);
+#ifndef H5_HAVE_PREAD
+        if(HDlseek(fd, offset, SEEK_SET) < 0)
             HGOTO_ERROR(H5E_EFL, H5E_SEEKERROR, FAIL, "unable to seek in external raw data file")
+#endif /* H5_HAVE_PREAD */
 #ifndef NDEBUG
         tempto_read = MIN((size_t)(efl->slot[u].size-skip), (hsize_t)size);
         H5_CHECK_OVERFLOW(tempto_read, hsize_t, size_t);
@@ -299,13 +467,20 @@ H5D__efl_read(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t size
 #else /* NDEBUG */
         to_read = MIN((size_t)(efl->slot[u].size - skip), (hsize_t)size);
 #endif /* NDEBUG */
-        if((n = HDread(fd, buf, to_read)) < 0)
-            HGOTO_ERROR(H5E_EFL, H5E_READERROR, FAIL, "read error in external raw data file")
-        else if((size_t)n < to_read)
-            HDmemset(buf + n, 0, to_read - (size_t)n);
-        full_name = (char *)H5MM_xfree(full_name);
-        HDclose(fd);
-        fd = -1;
+
+        /* Read until the end of the external file, which may be short */
+        for(nread = 0; nread < to_read; nread += (size_t)n) {
+#ifdef H5_HAVE_PREAD
+            if((n = HDpread(fd, buf + nread, to_read - nread, offset + (HDoff_t)nread)) < 0)
+#else /* H5_HAVE_PREAD */
+            if((n = HDread(fd, buf + nread, to_read - nread)) < 0)
+#endif /* H5_HAVE_PREAD */
+                HGOTO_ERROR(H5E_EFL, H5E_READERROR, FAIL, "read error in external raw data file")
+            if(0 == n)
+                break;
+        } /* end for */
+        if(nread < to_read)
+            HDmemset(buf + nread, 0, to_read - nread);
         size -= to_read;
         buf += to_read;
         skip = 0;
@@ -313,11 +488,6 @@ H5D__efl_read(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t size
     } /* end while */
 
 done:
-    if(full_name)
-        full_name = (char *)H5MM_xfree(full_name);
-    if(fd >= 0)
-        HDclose(fd);
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__efl_read() */
 
@@ -350,8 +520,10 @@ H5D__efl_write(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t siz
 #endif /* NDEBUG */
     haddr_t     cur;
     hsize_t     skip = 0;
+    HDoff_t     offset;
+    size_t      nwritten;
+    ssize_t     n;
     size_t	u;                          /* Local index variable */
-    char *full_name = NULL;             /* File name with prefix */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_STATIC
@@ -378,16 +550,13 @@ H5D__efl_write(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t siz
             HGOTO_ERROR(H5E_EFL, H5E_OVERFLOW, FAIL, "write past logical end of file")
         if(H5F_OVERFLOW_HSIZET2OFFT((hsize_t)efl->slot[u].offset + skip))
             HGOTO_ERROR(H5E_EFL, H5E_OVERFLOW, FAIL, "external file address overflowed")
-        if(H5_combine_path(dset->shared->extfile_prefix, efl->slot[u].name, &full_name) < 0)
-            HGOTO_ERROR(H5E_EFL, H5E_NOSPACE, FAIL, "can't build external file name")
-        if((fd = HDopen(full_name, O_CREAT | O_RDWR, 0666)) < 0) {
-            if(HDaccess(full_name, F_OK) < 0)
-                HGOTO_ERROR(H5E_EFL, H5E_CANTOPENFILE, FAIL, "external raw data file does not exist")
-            else
-                HGOTO_ERROR(H5E_EFL, H5E_CANTOPENFILE, FAIL, "unable to open external raw data file")
-            } /* end if */
-        if(HDlseek(fd, (HDoff_t)(efl->slot[u].offset + (HDoff_t)skip), SEEK_SET) < 0)
+        if(H5D__efl_open(efl, dset, u, TRUE, &fd) < 0)
+            HGOTO_ERROR(H5E_EFL, H5E_CANTOPENFILE, FAIL, "unable to open external raw data file")
+        offset = (HDoff_t)(efl->slot[u].offset + (HDoff_t)skip);
+#ifndef H5_HAVE_PWRITE
+        if(HDlseek(fd, offset, SEEK_SET) < 0)
             HGOTO_ERROR(H5E_EFL, H5E_SEEKERROR, FAIL, "unable to seek in external raw data file")
+#endif /* H5_HAVE_PWRITE */
 #ifndef NDEBUG
         tempto_write = MIN(efl->slot[u].size - skip, (hsize_t)size);
         H5_CHECK_OVERFLOW(tempto_write, hsize_t, size_t);
@@ -395,11 +564,14 @@ H5D__efl_write(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t siz
 #else /* NDEBUG */
         to_write = MIN((size_t)(efl->slot[u].size - skip), size);
 #endif /* NDEBUG */
-        if((size_t)HDwrite(fd, buf, to_write) != to_write)
-            HGOTO_ERROR(H5E_EFL, H5E_READERROR, FAIL, "write error in external raw data file")
-        full_name = (char *)H5MM_xfree(full_name);
-        HDclose (fd);
-        fd = -1;
+        for(nwritten = 0; nwritten < to_write; nwritten += (size_t)n) {
+#ifdef H5_HAVE_PWRITE
+            if((n = HDpwrite(fd, buf + nwritten, to_write - nwritten, offset + (HDoff_t)nwritten)) <= 0)
+#else /* H5_HAVE_PWRITE */
+            if((n = HDwrite(fd, buf + nwritten, to_write - nwritten)) <= 0)
+#endif /* H5_HAVE_PWRITE */
+                HGOTO_ERROR(H5E_EFL, H5E_WRITEERROR, FAIL, "write error in external raw data file")
+        } /* end for */
         size -= to_write;
         buf += to_write;
         skip = 0;
@@ -407,11 +579,6 @@ H5D__efl_write(const H5O_efl_t *efl, const H5D_t *dset, haddr_t addr, size_t siz
     } /* end while */
 
 done:
-    if(full_name)
-        full_name = (char *)H5MM_xfree(full_name);
-    if(fd >= 0)
-        HDclose(fd);
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__efl_write() */
 
@@ -35,6 +35,15 @@
 /* Local Macros */
 /****************/
 
+/* Size of the first block of VL data arenas, and of the largest one they
+ * grow to by doubling */
+#define H5D_VLEN_ARENA_BLK_SIZE         (64 * 1024)
+#define H5D_VLEN_ARENA_MAX_BLK_SIZE     (16 * 1024 * 1024)
+
+/* Alignment of the data handed out from VL data arenas */
+#define H5D_VLEN_ARENA_ALIGN(X)         (((X) + 15) & ~(size_t)15)
+#define H5D_VLEN_ARENA_BLK_HDR_SIZE     H5D_VLEN_ARENA_ALIGN(sizeof(H5D_vlen_arena_blk_t))
+
 
 /******************/
 /* Local Typedefs */
@@ -1884,6 +1893,10 @@ H5D_close(H5D_t *dataset)
         /* Free the external file prefix */
         dataset->shared->extfile_prefix = (char *)H5MM_xfree(dataset->shared->extfile_prefix);
 
+        /* Free the datatype conversion buffer kept between I/O operations */
+        if(dataset->shared->tconv_buf)
+            dataset->shared->tconv_buf = H5FL_BLK_FREE(type_conv, dataset->shared->tconv_buf);
+
         /* Release layout, fill-value, efl & pipeline messages */
         if(dataset->shared->dcpl_id != H5P_DATASET_CREATE_DEFAULT)
             free_failed |= (H5O_msg_reset(H5O_PLINE_ID, &dataset->shared->dcpl_cache.pline) < 0) ||
@@ -2536,6 +2549,9 @@ done:
  *      dataspace.  The dataset transfer property list is required to find the
  *      correct allocation/free methods for the VL data in the buffer.
  *
+ *      VL data read with an arena is only released with the whole arena,
+ *      so nothing needs to be done for it here.
+ *
  * Return:	Non-negative on success, negative on failure
  *
  * Programmer:	Quincey Koziol
@@ -2567,6 +2583,10 @@ H5D_vlen_reclaim(hid_t type_id, H5S_t *space, hid_t plist_id, void *buf)
     if(H5T_vlen_get_alloc_info(plist_id,&vl_alloc_info) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "unable to retrieve VL allocation info")
 
+    /* Don't visit the elements of VL data in an arena */
+    if(vl_alloc_info->free_func == H5D_vlen_arena_free_elmt)
+        HGOTO_DONE(SUCCEED)
+
     /* Call H5S_select_iterate with args, etc. */
     dset_op.op_type = H5S_SEL_ITER_OP_APP;
     dset_op.u.app_op.op = H5T_vlen_reclaim;
@@ -2578,6 +2598,141 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D_vlen_reclaim() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__vlen_arena_create
+ *
+ * Purpose:	Creates an empty arena for VL data.
+ *
+ * Return:	Success:	Pointer to the new arena
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5D_vlen_arena_t *
+H5D__vlen_arena_create(void)
+{
+    H5D_vlen_arena_t *ret_value = NULL;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(NULL == (ret_value = (H5D_vlen_arena_t *)H5MM_calloc(sizeof(H5D_vlen_arena_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for VL arena")
+    ret_value->blk_size = H5D_VLEN_ARENA_BLK_SIZE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__vlen_arena_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__vlen_arena_free
+ *
+ * Purpose:	Frees a VL data arena, along with all the VL data allocated
+ *		from it, one block at a time.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D__vlen_arena_free(H5D_vlen_arena_t *arena)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(arena);
+
+    while(arena->head) {
+        H5D_vlen_arena_blk_t *blk = arena->head;
+
+        arena->head = blk->next;
+        H5MM_xfree(blk);
+    } /* end while */
+    H5MM_xfree(arena);
+
+    FUNC_LEAVE_NOAPI_VOID
+}   /* end H5D__vlen_arena_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_vlen_arena_alloc
+ *
+ * Purpose:	Allocates SIZE bytes of VL data from the arena INFO, for
+ *		use as the VL allocation routine of a transfer with an arena.
+ *
+ *		Small requests are handed out one after another from the
+ *		arena's current block, and a new block, twice the size of
+ *		the last one (up to H5D_VLEN_ARENA_MAX_BLK_SIZE), is started
+ *		when it fills up, so that even large reads only use a few
+ *		blocks.  Requests too large for a block get a block of their
+ *		own, behind the current one.
+ *
+ * Return:	Success:	Pointer to the memory
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5D_vlen_arena_alloc(size_t size, void *info)
+{
+    H5D_vlen_arena_t *arena = (H5D_vlen_arena_t *)info;
+    H5D_vlen_arena_blk_t *blk = arena->head;    /* Block to allocate from */
+    void *ret_value = NULL;                     /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    HDassert(arena);
+
+    size = H5D_VLEN_ARENA_ALIGN(size);
+    if(NULL == blk || blk->size - blk->used < size) {
+        hbool_t own_blk = (blk && size > arena->blk_size / 4);  /* Whether the request gets a block of its own */
+        size_t blk_size = own_blk ? size : MAX(size, arena->blk_size - H5D_VLEN_ARENA_BLK_HDR_SIZE);
+
+        if(NULL == (blk = (H5D_vlen_arena_blk_t *)H5MM_malloc(H5D_VLEN_ARENA_BLK_HDR_SIZE + blk_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for VL arena block")
+        blk->size = blk_size;
+        blk->used = 0;
+
+        /* Keep filling the current block if the new one only holds this request */
+        if(own_blk) {
+            blk->next = arena->head->next;
+            arena->head->next = blk;
+        } /* end if */
+        else {
+            blk->next = arena->head;
+            arena->head = blk;
+            if(arena->blk_size < H5D_VLEN_ARENA_MAX_BLK_SIZE)
+                arena->blk_size *= 2;
+        } /* end else */
+    } /* end if */
+
+    ret_value = (uint8_t *)blk + H5D_VLEN_ARENA_BLK_HDR_SIZE + blk->used;
+    blk->used += size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D_vlen_arena_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_vlen_arena_free_elmt
+ *
+ * Purpose:	The VL free routine of a transfer with an arena.  VL data
+ *		in an arena is only released with the whole arena, so this
+ *		does nothing.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5D_vlen_arena_free_elmt(void H5_ATTR_UNUSED *mem, void H5_ATTR_UNUSED *info)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI_VOID
+}   /* end H5D_vlen_arena_free_elmt() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__vlen_get_buf_size_alloc
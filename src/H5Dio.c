@@ -61,7 +61,7 @@ const
     H5D_dxpl_cache_t *dxpl_cache,
     hid_t dxpl_id, const H5D_type_info_t *type_info, H5D_storage_t *store,
     H5D_io_info_t *io_info);
-static herr_t H5D__typeinfo_init(const H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
+static herr_t H5D__typeinfo_init(H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
     hid_t dxpl_id, hid_t mem_type_id, hbool_t do_write,
     H5D_type_info_t *type_info);
 #ifdef H5_HAVE_PARALLEL
@@ -70,7 +70,7 @@ static herr_t H5D__ioinfo_adjust(H5D_io_info_t *io_info, const H5D_t *dset,
     const H5D_type_info_t *type_info, const H5D_chunk_map_t *fm);
 static herr_t H5D__ioinfo_term(H5D_io_info_t *io_info);
 #endif /* H5_HAVE_PARALLEL */
-static herr_t H5D__typeinfo_term(const H5D_type_info_t *type_info);
+static herr_t H5D__typeinfo_term(H5D_t *dset, const H5D_type_info_t *type_info);
 
 
 /*********************/
@@ -564,7 +564,7 @@ done:
     }
 
     /* Shut down datatype info for operation */
-    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
+    if(type_info_init && H5D__typeinfo_term(dataset, &type_info) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
 
     /* discard projected mem space if it was created */
@@ -829,7 +829,7 @@ done:
     }
 
     /* Shut down datatype info for operation */
-    if(type_info_init && H5D__typeinfo_term(&type_info) < 0)
+    if(type_info_init && H5D__typeinfo_term(dataset, &type_info) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
 
     /* discard projected mem space if it was created */
@@ -936,7 +936,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__typeinfo_init(const H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
+H5D__typeinfo_init(H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
     hid_t dxpl_id, hid_t mem_type_id, hbool_t do_write,
     H5D_type_info_t *type_info)
 {
@@ -1052,12 +1052,23 @@ H5D__typeinfo_init(const H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
          * supplied one through the xfer properties. Instead of allocating a
          * buffer which is the exact size, we allocate the target size.  The
          * malloc() is usually less resource-intensive if we allocate/free the
-         * same size over and over.
+         * same size over and over.  The dataset keeps the buffer between
+         * operations, so take that one when it's big enough.
          */
         if(NULL == (type_info->tconv_buf = (uint8_t *)dxpl_cache->tconv_buf)) {
-            /* Allocate temporary buffer */
-            if(NULL == (type_info->tconv_buf = H5FL_BLK_MALLOC(type_conv, target_size)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+            if(dset->shared->tconv_buf && dset->shared->tconv_buf_size >= target_size) {
+                /* Take the dataset's buffer while this operation uses it */
+                type_info->tconv_buf = dset->shared->tconv_buf;
+                type_info->tconv_buf_size = dset->shared->tconv_buf_size;
+                dset->shared->tconv_buf = NULL;
+                dset->shared->tconv_buf_size = 0;
+            } /* end if */
+            else {
+                /* Allocate temporary buffer */
+                if(NULL == (type_info->tconv_buf = H5FL_BLK_MALLOC(type_conv, target_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+                type_info->tconv_buf_size = target_size;
+            } /* end else */
             type_info->tconv_buf_allocated = TRUE;
         } /* end if */
         if(type_info->need_bkg && NULL == (type_info->bkg_buf = (uint8_t *)dxpl_cache->bkgr_buf)) {
@@ -1244,14 +1255,24 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__typeinfo_term(const H5D_type_info_t *type_info)
+H5D__typeinfo_term(H5D_t *dset, const H5D_type_info_t *type_info)
 {
     FUNC_ENTER_STATIC_NOERR
 
     /* Check for releasing datatype conversion & background buffers */
     if(type_info->tconv_buf_allocated) {
         HDassert(type_info->tconv_buf);
-        (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf);
+
+        /* Give the conversion buffer to the dataset for its next operation,
+         * unless the dataset already has a bigger one */
+        if(type_info->tconv_buf_size > dset->shared->tconv_buf_size) {
+            if(dset->shared->tconv_buf)
+                (void)H5FL_BLK_FREE(type_conv, dset->shared->tconv_buf);
+            dset->shared->tconv_buf = type_info->tconv_buf;
+            dset->shared->tconv_buf_size = type_info->tconv_buf_size;
+        } /* end if */
+        else
+            (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf);
     } /* end if */
     if(type_info->bkg_buf_allocated) {
         HDassert(type_info->bkg_buf);
@@ -111,6 +111,7 @@ typedef struct H5D_type_info_t {
     H5T_bkg_t need_bkg;		        /* Type of background buf needed */
     size_t request_nelmts;		/* Requested strip mine	*/
     uint8_t *tconv_buf;	                /* Datatype conv buffer	*/
+    size_t tconv_buf_size;              /* Size of the datatype conv buffer, if allocated */
     hbool_t tconv_buf_allocated;        /* Whether the type conversion buffer was allocated */
     uint8_t *bkg_buf;	                /* Background buffer	*/
     hbool_t bkg_buf_allocated;          /* Whether the background buffer was allocated */
@@ -441,6 +442,22 @@ typedef struct H5D_rdcdc_t {
     hbool_t sieve_dirty;        /* Flag to indicate that the data sieve buffer is dirty */
 } H5D_rdcdc_t;
 
+/* An open external raw data file, in the external file cache */
+typedef struct H5D_efl_fd_t {
+    int fd;                     /* File descriptor, or -1 when not open */
+    hbool_t writable;           /* Whether the descriptor was opened for writing */
+} H5D_efl_fd_t;
+
+/* The external file cache: the descriptors of the external raw data files
+ * of a dataset, kept open from the first access until the dataset is
+ * closed.  Entries of the external file list naming the same file share
+ * one descriptor.
+ */
+typedef struct H5D_rdefc_t {
+    size_t nfiles;              /* Number of entries in 'file' (the size of the external file list) */
+    H5D_efl_fd_t *file;         /* Descriptor for each entry of the external file list */
+} H5D_rdefc_t;
+
 /*
  * A dataset is made of two layers, an H5D_t struct that is unique to
  * each instance of an opened datset, and a shared struct that is only
@@ -472,10 +489,15 @@ typedef struct H5D_shared_t {
                                          * dataset in certain circumstances)
                                          */
         H5D_rdcc_t      chunk;          /* Information about chunked data */
+        H5D_rdefc_t     efl;            /* Information about external data */
     } cache;
 
     H5D_append_flush_t  append_flush;   /* Append flush property information */
     char                *extfile_prefix; /* expanded external file prefix */
+
+    /* Datatype conversion buffer kept between I/O operations */
+    uint8_t             *tconv_buf;     /* Buffer, when not in use by an operation */
+    size_t              tconv_buf_size; /* Size of the buffer */
 } H5D_shared_t;
 
 struct H5D_t {
@@ -536,6 +558,19 @@ typedef struct {
     hsize_t size;       /* Accumulated number of bytes for the selection */
 } H5D_vlen_bufsize_t;
 
+/* A block of memory in a VL data arena */
+typedef struct H5D_vlen_arena_blk_t {
+    struct H5D_vlen_arena_blk_t *next;  /* Next block in the arena's list */
+    size_t size;        /* # of bytes for data in the block */
+    size_t used;        /* # of those bytes handed out */
+} H5D_vlen_arena_blk_t;
+
+/* An arena for VL data read into memory (H5D_vlen_arena_t, see H5Dpublic.h) */
+struct H5D_vlen_arena_t {
+    H5D_vlen_arena_blk_t *head;         /* Block being filled, followed by full ones */
+    size_t blk_size;                    /* Size of the next block to start */
+};
+
 
 /*****************************/
 /* Package Private Variables */
@@ -580,6 +615,8 @@ H5_DLL herr_t H5D__alloc_storage(const H5D_io_info_t *io_info, H5D_time_alloc_t
 H5_DLL herr_t H5D__get_storage_size(H5D_t *dset, hid_t dxpl_id, hsize_t *storage_size);
 H5_DLL haddr_t H5D__get_offset(const H5D_t *dset);
 H5_DLL void *H5D__vlen_get_buf_size_alloc(size_t size, void *info);
+H5_DLL H5D_vlen_arena_t *H5D__vlen_arena_create(void);
+H5_DLL void H5D__vlen_arena_free(H5D_vlen_arena_t *arena);
 H5_DLL herr_t H5D__vlen_get_buf_size(void *elem, hid_t type_id, unsigned ndim,
     const hsize_t *point, void *op_data);
 H5_DLL herr_t H5D__check_filters(H5D_t *dataset);
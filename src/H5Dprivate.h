@@ -65,6 +65,7 @@
 #define H5D_XFER_VLEN_ALLOC_INFO_NAME   "vlen_alloc_info" /* Vlen allocation info */
 #define H5D_XFER_VLEN_FREE_NAME         "vlen_free"     /* Vlen free function */
 #define H5D_XFER_VLEN_FREE_INFO_NAME    "vlen_free_info" /* Vlen free info */
+#define H5D_XFER_VLEN_ARENA_NAME        "vlen_arena"    /* Vlen arena */
 #define H5D_XFER_VFL_ID_NAME            "vfl_id"        /* File driver ID */
 #define H5D_XFER_VFL_INFO_NAME          "vfl_info"      /* File driver info */
 #define H5D_XFER_HYPER_VECTOR_SIZE_NAME "vec_size"      /* Hyperslab vector size */
@@ -107,6 +108,7 @@
 #define H5D_VLEN_ALLOC_INFO     NULL
 #define H5D_VLEN_FREE           NULL
 #define H5D_VLEN_FREE_INFO      NULL
+#define H5D_VLEN_ARENA          NULL
 
 /* Default virtual dataset list size */
 #define H5D_VIRTUAL_DEF_LIST_SIZE 8
@@ -185,6 +187,8 @@ H5_DLL hid_t H5D_get_type(H5D_t *dset);
 /* Functions that operate on vlen data */
 H5_DLL herr_t H5D_vlen_reclaim(hid_t type_id, H5S_t *space, hid_t plist_id,
     void *buf);
+H5_DLL void *H5D_vlen_arena_alloc(size_t size, void *info);
+H5_DLL void H5D_vlen_arena_free_elmt(void *mem, void *info);
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
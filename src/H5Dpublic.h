@@ -110,6 +110,9 @@ typedef enum H5D_vds_view_t {
 /* Callback for H5Pset_append_flush() in a dataset access property list */
 typedef herr_t (*H5D_append_cb_t)(hid_t dataset_id, hsize_t *cur_dims, void *op_data);
 
+/* Arena holding the variable-length data read with H5Pset_vlen_arena() */
+typedef struct H5D_vlen_arena_t H5D_vlen_arena_t;
+
 /********************/
 /* Public Variables */
 /********************/
@@ -155,6 +158,8 @@ H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
 H5_DLL herr_t H5Dvlen_get_buf_size(hid_t dataset_id, hid_t type_id, hid_t space_id, hsize_t *size);
+H5_DLL H5D_vlen_arena_t *H5Dvlen_arena_create(void);
+H5_DLL herr_t H5Dvlen_arena_free(H5D_vlen_arena_t *arena);
 H5_DLL herr_t H5Dfill(const void *fill, hid_t fill_type, void *buf,
         hid_t buf_type, hid_t space);
 H5_DLL herr_t H5Dset_extent(hid_t dset_id, const hsize_t size[]);
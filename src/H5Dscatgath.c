@@ -32,6 +32,9 @@
 /* Local Macros */
 /****************/
 
+/* Datatype classes whose conversions can be done in the application's buffer */
+#define H5D_SCATGATH_IN_PLACE_CLASS(C)  (H5T_INTEGER == (C) || H5T_FLOAT == (C))
+
 
 /******************/
 /* Local Typedefs */
@@ -491,6 +494,47 @@ H5D__scatgath_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize background selection information")
     bkg_iter_init = TRUE;	/*file selection iteration info has been initialized */
 
+    /*
+     * When the selection in memory is one contiguous run and the conversion
+     * is between integer or floating-point types that don't shrink, read
+     * the file data straight into that run of the application's buffer and
+     * convert it in place, bypassing the type conversion buffer.
+     */
+    if(H5T_BKG_NO == type_info->need_bkg && NULL == type_info->cmpd_subset
+            && type_info->dst_type_size >= type_info->src_type_size
+            && H5D_SCATGATH_IN_PLACE_CLASS(H5T_get_class(type_info->mem_type, FALSE))
+            && H5D_SCATGATH_IN_PLACE_CLASS(H5T_get_class(type_info->dset_type, FALSE))
+            && nelmts == (hsize_t)(size_t)nelmts
+            && TRUE == H5S_SELECT_IS_CONTIGUOUS(mem_space)) {
+        hsize_t mem_off;        /* Offset of the run in the application's buffer */
+        size_t mem_len;         /* Length of the run */
+        size_t nseq;            /* Number of sequences generated */
+        size_t nelem;           /* Number of elements in the run */
+
+        /* Locate the run (the background iterator is otherwise unused
+         * when there's no background buffer) */
+        if(H5S_SELECT_GET_SEQ_LIST(mem_space, 0, bkg_iter, (size_t)1, (size_t)nelmts, &nseq, &nelem, &mem_off, &mem_len) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_UNSUPPORTED, FAIL, "sequence length generation failed")
+
+        if(1 == nseq && nelem == nelmts) {
+            uint8_t *run = (uint8_t *)buf + mem_off;    /* Start of the run */
+
+            if(H5D__gather_file(io_info, file_space, file_iter, (size_t)nelmts, run/*out*/) != nelmts)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file gather failed")
+
+            if(H5T_convert(type_info->tpath, type_info->src_type_id, type_info->dst_type_id,
+                    (size_t)nelmts, (size_t)0, (size_t)0, run, NULL, io_info->md_dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+            /* Do the data transform after the conversion (since we're using type mem_type) */
+            if(!type_info->is_xform_noop)
+                if(H5Z_xform_eval(dxpl_cache->data_xform_prop, run, (size_t)nelmts, type_info->mem_type) < 0)
+                    HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Error performing data transform")
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
     /* Start strip mining... */
     for(smine_start = 0; smine_start < nelmts; smine_start += smine_nelmts) {
         size_t n;               /* Elements operated on */
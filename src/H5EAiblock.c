@@ -42,6 +42,7 @@
 #include "H5EApkg.h"		/* Extensible Arrays			*/
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5MFprivate.h"	/* File memory management		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5VMprivate.h"		/* Vectors and arrays 			*/
 
 
@@ -63,6 +64,8 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5EA__iblock_read_ahead(const H5EA_hdr_t *hdr,
+    const H5EA_iblock_t *iblock, hid_t dxpl_id);
 
 
 /*********************/
@@ -295,6 +298,7 @@ H5EA__iblock_protect(H5EA_hdr_t *hdr, hid_t dxpl_id, unsigned flags))
 
     /* Local variables */
     H5EA_iblock_t *iblock = NULL;       /* Pointer to index block */
+    unsigned status = 0;                /* Index block's metadata cache status */
 
 #ifdef QAK
 HDfprintf(stderr, "%s: Called\n", FUNC);
@@ -306,10 +310,20 @@ HDfprintf(stderr, "%s: Called\n", FUNC);
     /* only the H5AC__READ_ONLY_FLAG may be set */
     HDassert((flags & (unsigned)(~H5AC__READ_ONLY_FLAG)) == 0);
 
+    /* Check if the index block will be loaded from the file */
+    if(H5F_META_READ_AHEAD_SIZE(hdr->f) > 0)
+        if(H5AC_get_entry_status(hdr->f, hdr->idx_blk_addr, &status) < 0)
+            H5E_THROW(H5E_CANTGET, "unable to check metadata cache status for extensible array index block")
+
     /* Protect the index block */
     if(NULL == (iblock = (H5EA_iblock_t *)H5AC_protect(hdr->f, dxpl_id, H5AC_EARRAY_IBLOCK, hdr->idx_blk_addr, hdr, flags)))
         H5E_THROW(H5E_CANTPROTECT, "unable to protect extensible array index block, address = %llu", (unsigned long long)hdr->idx_blk_addr)
 
+    /* Read ahead the data blocks of an index block that was just loaded */
+    if(H5F_META_READ_AHEAD_SIZE(hdr->f) > 0 && !(status & H5AC_ES__IN_CACHE))
+        if(H5EA__iblock_read_ahead(hdr, iblock, dxpl_id) < 0)
+            H5E_THROW(H5E_READERROR, "unable to read ahead extensible array data blocks")
+
     /* Create top proxy, if it doesn't exist */
     if(hdr->top_proxy && NULL == iblock->top_proxy) {
         /* Add index block as child of 'top' proxy */
@@ -331,6 +345,77 @@ CATCH
 
 END_FUNC(PKG)   /* end H5EA__iblock_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5EA__iblock_read_ahead
+ *
+ * Purpose:	Read ahead the data blocks referenced from an index block,
+ *		with one request to the file driver.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(STATIC, ERR,
+herr_t, SUCCEED, FAIL,
+H5EA__iblock_read_ahead(const H5EA_hdr_t *hdr, const H5EA_iblock_t *iblock,
+    hid_t dxpl_id))
+
+    /* Local variables */
+    H5F_block_t *blocks = NULL;         /* Data blocks to read ahead */
+    size_t nblocks = 0;                 /* # of data blocks to read ahead */
+    unsigned sblk_idx;                  /* Current super block index */
+    size_t dblk_idx;                    /* Current data block index w/in super block */
+    size_t u;                           /* Local index variable */
+
+    /* Sanity check */
+    HDassert(hdr);
+    HDassert(iblock);
+
+    /* Check for data block pointers in the index block */
+    if(iblock->ndblk_addrs < 2)
+        H5_LEAVE(SUCCEED)
+
+    /* Allocate space for the data blocks */
+    if(NULL == (blocks = (H5F_block_t *)H5MM_malloc(sizeof(H5F_block_t) * iblock->ndblk_addrs)))
+        H5E_THROW(H5E_CANTALLOC, "memory allocation failed for read-ahead blocks")
+
+    /* Compute the on-disk size of each existing data block */
+    sblk_idx = 0;
+    dblk_idx = 0;
+    for(u = 0; u < iblock->ndblk_addrs; u++) {
+        if(H5F_addr_defined(iblock->dblk_addrs[u])) {
+            H5EA_dblock_t dblock;       /* Fake data block for computing size on disk */
+
+            /* (Note: mirrors H5EA__cache_dblock_get_initial_load_size) */
+            HDmemset(&dblock, 0, sizeof(dblock));
+            dblock.hdr = (H5EA_hdr_t *)hdr;     /* Casting away const OK -QAK */
+            dblock.nelmts = hdr->sblk_info[sblk_idx].dblk_nelmts;
+            if(dblock.nelmts > hdr->dblk_page_nelmts)
+                dblock.npages = dblock.nelmts / hdr->dblk_page_nelmts;
+
+            blocks[nblocks].offset = iblock->dblk_addrs[u];
+            blocks[nblocks].length = dblock.npages ? H5EA_DBLOCK_PREFIX_SIZE(&dblock) : H5EA_DBLOCK_SIZE(&dblock);
+            nblocks++;
+        } /* end if */
+
+        /* Advance to next data block w/in super block */
+        if(++dblk_idx >= hdr->sblk_info[sblk_idx].ndblks) {
+            sblk_idx++;
+            dblk_idx = 0;
+        } /* end if */
+    } /* end for */
+
+    /* Read the data blocks */
+    if(H5F_read_ahead(hdr->f, H5FD_MEM_EARRAY_DBLOCK, nblocks, blocks, dxpl_id) < 0)
+        H5E_THROW(H5E_READERROR, "unable to read ahead data blocks")
+
+CATCH
+    if(blocks)
+        blocks = (H5F_block_t *)H5MM_xfree(blocks);
+
+END_FUNC(STATIC)   /* end H5EA__iblock_read_ahead() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5EA__iblock_unprotect
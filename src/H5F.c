@@ -2077,13 +2077,53 @@ H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2], unsigned hits[2
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL input parameters for stats")
 
     /* Get the statistics */
-    if(H5PB_get_stats(file->shared->page_buf, accesses, hits, misses, evictions, bypasses) < 0)
+    if(H5PB_get_stats(file->shared->page_buf, accesses, hits, misses, evictions, bypasses, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for page buffering")
 
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Fget_page_buffering_stats() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_page_buffering_ext_stats
+ *
+ * Purpose:     Retrieves the per-class hit ratios, the number of dirty
+ *              pages written back and the time spent writing them back
+ *              for the page buffer layer.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_page_buffering_ext_stats(hid_t file_id, double hit_ratios[2], unsigned writes[2],
+    double *write_time)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    unsigned   accesses[2], hits[2], misses[2], evictions[2], bypasses[2];  /* Basic stats (unused) */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "i*d*Iu*d", file_id, hit_ratios, writes, write_time);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->page_buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "page buffering not enabled on file")
+    if(NULL == hit_ratios || NULL == writes || NULL == write_time)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL input parameters for stats")
+
+    /* Get the statistics */
+    if(H5PB_get_stats(file->shared->page_buf, accesses, hits, misses, evictions, bypasses, hit_ratios, writes, write_time) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve stats for page buffering")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_page_buffering_ext_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_mdc_image_info
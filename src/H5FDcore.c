@@ -87,6 +87,10 @@ typedef struct H5FD_core_t {
     hbool_t dirty;                              /* changes not saved?       */
     H5FD_file_image_callbacks_t fi_callbacks;   /* file image callbacks     */
     H5SL_t *dirty_list;                         /* dirty parts of the file  */
+    hbool_t lazy_load;                          /* load pages on first access */
+    haddr_t bstore_eof;                         /* end of the data in the backing store not yet loaded */
+    uint8_t *page_state;                        /* loaded/dirty flags for each page (lazy loading) */
+    size_t  npages;                             /* # of entries in page_state */
 } H5FD_core_t;
 
 /* Driver-specific file access properties */
@@ -98,6 +102,10 @@ typedef struct H5FD_core_fapl_t {
 /* Allocate memory in multiples of this size by default */
 #define H5FD_CORE_INCREMENT 8192
 
+/* Page state flags, when an existing file is loaded lazily */
+#define H5FD_CORE_PAGE_LOADED   0x01    /* Page's memory holds the file's data */
+#define H5FD_CORE_PAGE_DIRTY    0x02    /* Page must be written to the backing store */
+
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
  *
@@ -122,6 +130,11 @@ typedef struct H5FD_core_fapl_t {
 static herr_t H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_read_from_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_resize_page_state(H5FD_core_t *file, size_t new_eof);
+static herr_t H5FD__core_load_pages(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_dirty_pages(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_flush_dirty_pages(H5FD_core_t *file);
 static herr_t H5FD__core_term(void);
 static void *H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -384,6 +397,290 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write_to_bstore() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_read_from_bstore
+ *
+ * Purpose:     Read data from the backing store into the memory buffer,
+ *              at the same address.  Anything past the actual end of the
+ *              backing store is zero-filled.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_read_from_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
+{
+    unsigned char  *ptr         = file->mem + addr;     /* mutable pointer into the
+                                                         * buffer (can't change mem)
+                                                         */
+    herr_t          ret_value   = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->fd >= 0);
+
+    /* Read from backing store */
+    if((off_t)addr != HDlseek(file->fd, (off_t)addr, SEEK_SET))
+        HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "error seeking in backing store")
+
+    while(size > 0) {
+        h5_posix_io_t       bytes_in        = 0;    /* # of bytes to read       */
+        h5_posix_io_ret_t   bytes_read      = -1;   /* # of bytes actually read */
+
+        /* Trying to read more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if(size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)size;
+
+        do {
+            bytes_read = HDread(file->fd, ptr, bytes_in);
+        } while(-1 == bytes_read && EINTR == errno);
+
+        if(-1 == bytes_read) { /* error */
+            int myerrno = errno;
+            time_t mytime = HDtime(NULL);
+            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read from backing store failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', ptr = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->name, file->fd, myerrno, HDstrerror(myerrno), ptr, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)myoffset);
+        } /* end if */
+
+        /* End of file */
+        if(0 == bytes_read) {
+            HDmemset(ptr, 0, size);
+            break;
+        } /* end if */
+
+        HDassert((size_t)bytes_read <= size);
+
+        size -= (size_t)bytes_read;
+        ptr = (unsigned char *)ptr + bytes_read;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_read_from_bstore() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_resize_page_state
+ *
+ * Purpose:     Resize the page state array of a lazily loaded file to
+ *              cover a memory buffer of NEW_EOF bytes.  New pages that
+ *              lie beyond the data in the backing store have nothing
+ *              to load, so they start out as loaded.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_resize_page_state(H5FD_core_t *file, size_t new_eof)
+{
+    size_t      new_npages;                     /* # of pages needed */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->lazy_load);
+    HDassert(file->bstore_page_size > 0);
+
+    new_npages = (new_eof + file->bstore_page_size - 1) / file->bstore_page_size;
+    if(new_npages != file->npages) {
+        if(new_npages > 0) {
+            uint8_t *x;         /* Pointer to new page state array */
+            size_t u;           /* Local index variable */
+
+            if(NULL == (x = (uint8_t *)H5MM_realloc(file->page_state, new_npages)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate core VFD page state")
+            for(u = file->npages; u < new_npages; u++)
+                x[u] = (uint8_t)(((haddr_t)u * file->bstore_page_size) >= file->bstore_eof ? H5FD_CORE_PAGE_LOADED : 0);
+            file->page_state = x;
+        } /* end if */
+        else
+            file->page_state = (uint8_t *)H5MM_xfree(file->page_state);
+        file->npages = new_npages;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_resize_page_state() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_load_pages
+ *
+ * Purpose:     Make sure the pages of a lazily loaded file that overlap
+ *              [ADDR, ADDR + SIZE) hold the file's data, reading each run
+ *              of consecutive pages not yet loaded from the backing store
+ *              with a single read.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_load_pages(H5FD_core_t *file, haddr_t addr, size_t size)
+{
+    size_t      first, last;                    /* First & last page touched */
+    size_t      u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->lazy_load);
+
+    if(0 == size || file->npages == 0)
+        HGOTO_DONE(SUCCEED)
+
+    first = (size_t)(addr / file->bstore_page_size);
+    last = (size_t)((addr + size - 1) / file->bstore_page_size);
+    if(last >= file->npages)
+        last = file->npages - 1;
+
+    u = first;
+    while(u <= last) {
+        size_t run_end;                         /* One past the last page in the run */
+        haddr_t start, end;                     /* Region to read */
+
+        if(file->page_state[u] & H5FD_CORE_PAGE_LOADED) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Find the run of pages to load */
+        for(run_end = u + 1; run_end <= last; run_end++)
+            if(file->page_state[run_end] & H5FD_CORE_PAGE_LOADED)
+                break;
+
+        /* Read whatever part of the run is in the backing store */
+        start = (haddr_t)u * file->bstore_page_size;
+        end = MIN((haddr_t)run_end * file->bstore_page_size, file->bstore_eof);
+        if(start < end)
+            if(H5FD__core_read_from_bstore(file, start, (size_t)(end - start)) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to load pages from backing store")
+
+        for(; u < run_end; u++)
+            file->page_state[u] |= H5FD_CORE_PAGE_LOADED;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_load_pages() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_dirty_pages
+ *
+ * Purpose:     Prepare the pages of a lazily loaded file that overlap
+ *              [ADDR, ADDR + SIZE) to be written and mark them dirty.
+ *              Pages only partly covered by the write are loaded first;
+ *              pages that will be entirely overwritten are not read.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_dirty_pages(H5FD_core_t *file, haddr_t addr, size_t size)
+{
+    size_t      first, last;                    /* First & last page touched */
+    size_t      u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->lazy_load);
+    HDassert(addr + size <= file->eof);
+
+    if(0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    first = (size_t)(addr / file->bstore_page_size);
+    last = (size_t)((addr + size - 1) / file->bstore_page_size);
+    HDassert(last < file->npages);
+
+    /* Load the pages at either end, if the write doesn't cover all of
+     * their data in the backing store.
+     */
+    for(u = first; u <= last; u += MAX(last - first, 1)) {
+        haddr_t start = (haddr_t)u * file->bstore_page_size;
+        haddr_t end = MIN(start + file->bstore_page_size, file->bstore_eof);
+
+        if(!(file->page_state[u] & H5FD_CORE_PAGE_LOADED) && start < end
+                && (addr > start || addr + size < end))
+            if(H5FD__core_load_pages(file, start, (size_t)1) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to load pages from backing store")
+    } /* end for */
+
+    for(u = first; u <= last; u++)
+        file->page_state[u] |= (H5FD_CORE_PAGE_LOADED | H5FD_CORE_PAGE_DIRTY);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_dirty_pages() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_flush_dirty_pages
+ *
+ * Purpose:     Write the dirty pages of a lazily loaded file to the
+ *              backing store, coalescing each run of consecutive dirty
+ *              pages into a single write.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_flush_dirty_pages(H5FD_core_t *file)
+{
+    size_t      u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->lazy_load);
+
+    u = 0;
+    while(u < file->npages) {
+        size_t run_end;                         /* One past the last page in the run */
+        haddr_t start, end;                     /* Region to write */
+
+        if(!(file->page_state[u] & H5FD_CORE_PAGE_DIRTY)) {
+            u++;
+            continue;
+        } /* end if */
+
+        /* Find the run of dirty pages */
+        for(run_end = u + 1; run_end < file->npages; run_end++)
+            if(!(file->page_state[run_end] & H5FD_CORE_PAGE_DIRTY))
+                break;
+
+        /* The file may have been truncated, so clip the run to the EOF */
+        start = (haddr_t)u * file->bstore_page_size;
+        end = MIN((haddr_t)run_end * file->bstore_page_size, file->eof);
+        if(start < end)
+            if(H5FD__core_write_to_bstore(file, start, (size_t)(end - start)) != SUCCEED)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+
+        for(; u < run_end; u++)
+            file->page_state[u] &= (uint8_t)~H5FD_CORE_PAGE_DIRTY;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_flush_dirty_pages() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
@@ -700,7 +997,26 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
 #endif /* H5_HAVE_WIN32_API */
     } /* end if */
 
-    /* If an existing file is opened, load the whole file into memory. */
+    /* Check whether an existing file should be loaded a page at a time as
+     * it is accessed, instead of all at once.  This only applies when the
+     * data comes from the backing store, not from an initial file image.
+     */
+    if(!(H5F_ACC_CREAT & flags) && fd >= 0 && NULL == file_image_info.buffer) {
+        hbool_t lazy_load_flag = FALSE;     /* what the user asked for */
+
+        if(H5P_get(plist, H5F_ACS_CORE_LAZY_LOAD_FLAG_NAME, &lazy_load_flag) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD lazy load flag");
+        if(lazy_load_flag) {
+            /* Pages are loaded and tracked with the write tracking page size */
+            if(H5P_get(plist, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME, &(file->bstore_page_size)) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD write tracking page size");
+            file->lazy_load = (file->bstore_page_size > 0);
+        } /* end if */
+    } /* end if */
+
+    /* If an existing file is opened, load the whole file into memory
+     * (or just set up the page state, if loading lazily).
+     */
     if(!(H5F_ACC_CREAT & flags)) {
         size_t size;
 
@@ -734,6 +1050,12 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
                 else
                     HDmemcpy(file->mem, file_image_info.buffer, size);
             } /* end if */
+            /* Pages of the file are read in as they are accessed */
+            else if(file->lazy_load) {
+                file->bstore_eof = size;
+                if(H5FD__core_resize_page_state(file, size) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, NULL, "unable to set up core VFD page state")
+            } /* end else-if */
             /* Read in existing data from the file if there is no image */
             else {
                 /* Read in existing data, being careful of interrupted system calls,
@@ -800,8 +1122,10 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
             && !(o_flags & O_RDONLY)            /* file is open for writing (i.e. not read-only) */
             && file->bstore_page_size != 0;     /* page size is not zero */
 
-        /* initialize the dirty list */
-        if(use_write_tracking) {
+        /* initialize the dirty list (lazily loaded files track dirty pages
+         * in their page state instead)
+         */
+        if(use_write_tracking && !file->lazy_load) {
             if(NULL == (file->dirty_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
                 HGOTO_ERROR(H5E_SLIST, H5E_CANTCREATE, NULL, "can't create core vfd dirty region list");
         } /* end if */
@@ -816,6 +1140,7 @@ done:
             HDclose(file->fd);
         H5MM_xfree(file->name);
         H5MM_xfree(file->mem);
+        H5MM_xfree(file->page_state);
         H5MM_xfree(file);
     } /* end if */
 
@@ -857,6 +1182,8 @@ H5FD__core_close(H5FD_t *_file)
         HDclose(file->fd);
     if(file->name)
         H5MM_xfree(file->name);
+    if(file->page_state)
+        H5MM_xfree(file->page_state);
     if(file->mem) {
         /* Use image callback if available */
         if(file->fi_callbacks.image_free) {
@@ -1130,6 +1457,11 @@ H5FD__core_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
     else
         *file_handle = &(file->mem);
 
+    /* The whole file must be in memory before handing out the buffer */
+    if(file->lazy_load && *file_handle == &(file->mem))
+        if(H5FD__core_load_pages(file, (haddr_t)0, (size_t)file->eof) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "unable to load core VFD file")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_get_handle() */
@@ -1182,6 +1514,11 @@ H5FD__core_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         nbytes = MIN(size,(size_t)(file->eof-addr));
 #endif /* NDEBUG */
 
+        /* Make sure the data has been loaded */
+        if(file->lazy_load)
+            if(H5FD__core_load_pages(file, addr, nbytes) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to load pages from backing store")
+
         HDmemcpy(buf, file->mem + addr, nbytes);
         size -= nbytes;
         addr += nbytes;
@@ -1256,8 +1593,18 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
         file->mem = x;
 
         file->eof = new_eof;
+
+        /* Track the new pages, if loading lazily */
+        if(file->lazy_load)
+            if(H5FD__core_resize_page_state(file, new_eof) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to resize core VFD page state")
     } /* end if */
 
+    /* Load partially overwritten pages and mark the pages dirty, if loading lazily */
+    if(file->lazy_load)
+        if(H5FD__core_dirty_pages(file, addr, size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTMARKDIRTY, FAIL, "unable to mark core VFD pages dirty")
+
     /* Add the buffer region to the dirty list if using that optimization */
     if(file->dirty_list) {
         haddr_t start = addr;
@@ -1302,8 +1649,13 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
     /* Write to backing store */
     if (file->dirty && file->fd >= 0 && file->backing_store) {
 
+        /* Write only the dirty pages of a lazily loaded file */
+        if(file->lazy_load) {
+            if(H5FD__core_flush_dirty_pages(file) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write dirty pages to backing store")
+        } /* end if */
         /* Use the dirty list, if available */
-        if(file->dirty_list) {
+        else if(file->dirty_list) {
             H5FD_core_region_t *item = NULL;
             size_t size;
 
@@ -1415,6 +1767,16 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
                 HDmemset(x + file->eof, 0, (size_t)(new_eof - file->eof));
             file->mem = x;
 
+            /* Data in the backing store past a shrunk EOF is gone, as far
+             * as a lazily loaded file is concerned.
+             */
+            if(file->lazy_load) {
+                if(file->bstore_eof > (haddr_t)new_eof)
+                    file->bstore_eof = (haddr_t)new_eof;
+                if(H5FD__core_resize_page_state(file, new_eof) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to resize core VFD page state")
+            } /* end if */
+
             /* Update backing store, if using it and if closing */
             if(closing && (file->fd >= 0) && file->backing_store) {
 #ifdef H5_HAVE_WIN32_API
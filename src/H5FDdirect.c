@@ -71,6 +71,19 @@ typedef struct H5FD_direct_t {
     haddr_t  pos;      /*current file I/O position  */
     int    op;      /*last operation    */
     H5FD_direct_fapl_t  fa;    /*file access properties  */
+
+    /*
+     * Write-combining buffer for unaligned writes.  It holds the file
+     * blocks starting at the aligned address `wc_addr', of which the first
+     * `wc_len' bytes are valid.  Adjacent writes are merged into it; whole
+     * blocks are written out when it fills, and the last, partially
+     * filled block only when a write is not adjacent, and on flush,
+     * truncate and close.  The buffer is `fa.cbsize' bytes, allocated on
+     * the first unaligned write.
+     */
+    unsigned char *wc_buf;    /*write-combining buffer  */
+    haddr_t  wc_addr;    /*file address of wc_buf  */
+    size_t  wc_len;      /*bytes of wc_buf in use  */
 #ifndef H5_HAVE_WIN32_API
     /*
      * On most systems the combination of device and i-node number uniquely
@@ -134,9 +147,16 @@ static herr_t H5FD_direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
            size_t size, void *buf);
 static herr_t H5FD_direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_direct_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_direct_unlock(H5FD_t *_file);
+static herr_t H5FD__direct_read_block(H5FD_direct_t *file, haddr_t addr, void *buf);
+static herr_t H5FD__direct_write_aligned(H5FD_direct_t *file, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD__direct_wc_flush(H5FD_direct_t *file, hbool_t all);
+static herr_t H5FD__direct_wc_write(H5FD_direct_t *file, haddr_t addr,
+            size_t size, const void *buf);
 
 
 static const H5FD_class_t H5FD_direct_g = {
@@ -167,7 +187,7 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD_direct_get_handle,                     /*get_handle            */
     H5FD_direct_read,        /*read      */
     H5FD_direct_write,        /*write      */
-    NULL,          /*flush      */
+    H5FD_direct_flush,        /*flush      */
     H5FD_direct_truncate,      	/*truncate    */
     H5FD_direct_lock,          	/*lock                  */
     H5FD_direct_unlock,        	/*unlock                */
@@ -602,9 +622,16 @@ H5FD_direct_close(H5FD_t *_file)
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* Write out any combined writes */
+    if (H5FD__direct_wc_flush(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write out combined writes")
+
     if (HDclose(file->fd)<0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
 
+    /* Free with HDfree since it came from posix_memalign */
+    if (file->wc_buf)
+        HDfree(file->wc_buf);
     H5FL_FREE(H5FD_direct_t,file);
 
 done:
@@ -867,6 +894,9 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     haddr_t    read_size;              /* Size to read into copy buffer */
     size_t    copy_size = size;       /* Size remaining to read when using copy buffer */
     size_t              copy_offset;            /* Offset into copy buffer of the requested data */
+    haddr_t             req_addr = addr;        /* Address of the request */
+    size_t              req_size = size;        /* Size of the request */
+    unsigned char       *req_buf = (unsigned char *)buf;    /* Buffer of the request */
 
     FUNC_ENTER_NOAPI_NOINIT
 
@@ -999,6 +1029,16 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
             } /* end if */
     }
 
+    /* Data in the write-combining buffer is newer than the file's */
+    if(file->wc_len > 0 && req_addr < file->wc_addr + file->wc_len &&
+            req_addr + req_size > file->wc_addr) {
+        haddr_t overlay_start = MAX(req_addr, file->wc_addr);
+        haddr_t overlay_end = MIN(req_addr + req_size, file->wc_addr + file->wc_len);
+
+        HDmemcpy(req_buf + (overlay_start - req_addr), file->wc_buf + (overlay_start - file->wc_addr),
+                (size_t)(overlay_end - overlay_start));
+    } /* end if */
+
     /* Update current position */
     file->pos = addr;
     file->op = OP_READ;
@@ -1041,20 +1081,7 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     size_t size, const void *buf)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
-    ssize_t    nbytes;
-    hbool_t    _must_align = TRUE;
     herr_t        ret_value=SUCCEED;       /* Return value */
-    size_t    alloc_size;
-    void    *copy_buf = NULL, *p1;
-    const void    *p3;
-    size_t    _boundary;
-    size_t    _fbsize;
-    size_t    _cbsize;
-    haddr_t             write_addr;             /* Address to write copy buffer */
-    haddr_t             write_size;             /* Size to write from copy buffer */
-    haddr_t             read_size;              /* Size to read into copy buffer */
-    size_t              copy_size = size;       /* Size remaining to write when using copy buffer */
-    size_t              copy_offset;            /* Offset into copy buffer of the data to write */
 
     FUNC_ENTER_NOAPI_NOINIT
 
@@ -1067,192 +1094,327 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     if (REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow")
 
-    /* If the system doesn't require data to be aligned, read the data in
-     * the same way as sec2 driver.
+    /* If the system doesn't require data to be aligned, write the data in
+     * the same way as sec2 driver.  If it does, go through the
+     * write-combining buffer, which writes aligned data straight from the
+     * caller's buffer.
      */
-    _must_align = file->fa.must_align;
+    if(!file->fa.must_align) {
+        if(H5FD__direct_write_aligned(file, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    } /* end if */
+    else if(H5FD__direct_wc_write(file, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
-    /* Get the memory boundary for alignment, file system block size, and maximal
-     * copy buffer size.
-     */
-    _boundary = file->fa.mboundary;
-    _fbsize = file->fa.fbsize;
-    _cbsize = file->fa.cbsize;
+    /* Update eof */
+    if (addr + size > file->eof)
+        file->eof = addr + size;
 
-    /* if the data is aligned or the system doesn't require data to be aligned,
-     * write it directly to the file.  If not, read a bigger and aligned data
-     * first, update buffer with user data, then write the data out.
-     */
-    if(!_must_align || ((addr%_fbsize==0) && (size%_fbsize==0) && ((size_t)buf%_boundary==0))) {
-      /* Seek to the correct location */
-      if ((addr!=file->pos || OP_WRITE!=file->op) &&
-        HDlseek(file->fd, (HDoff_t)addr, SEEK_SET)<0)
-    HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-      while (size>0) {
-    do {
-        nbytes = HDwrite(file->fd, buf, size);
-    } while (-1==nbytes && EINTR==errno);
-    if (-1==nbytes) /* error */
-        HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-    HDassert(nbytes>0);
-    HDassert((size_t)nbytes<=size);
-    H5_CHECK_OVERFLOW(nbytes,ssize_t,size_t);
-    size -= (size_t)nbytes;
-    H5_CHECK_OVERFLOW(nbytes,ssize_t,haddr_t);
-    addr += (haddr_t)nbytes;
-    buf = (const char*)buf + nbytes;
-      }
-    } else {
-            /* Calculate where we will begin reading from (on disk) and where we
-             * will begin copying from the copy buffer */
-            write_addr = (addr / _fbsize) * _fbsize;
-            copy_offset = (size_t)(addr % _fbsize);
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}
 
-      /* allocate memory needed for the Direct IO option up to the maximal
-       * copy buffer size. Make a bigger buffer for aligned I/O if size is
-       * smaller than maximal copy buffer.
-       */
-      alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-            if(alloc_size > _cbsize)
-                alloc_size = _cbsize;
-            HDassert(!(alloc_size % _fbsize));
 
-      if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_read_block
+ *
+ * Purpose:  Reads the file system block at the aligned address ADDR into
+ *    the aligned buffer BUF.  The part of the block past the end
+ *    of the file reads as zeros.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_read_block(H5FD_direct_t *file, haddr_t addr, void *buf)
+{
+    ssize_t    nbytes;
+    herr_t        ret_value = SUCCEED;       /* Return value */
 
-            /* look for the right position for reading or writing the data */
-            if(HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    FUNC_ENTER_STATIC
 
-      p3 = buf;
-      do {
-                /* Calculate how much data we have to write in this iteration
-                 * (including unused parts of blocks) */
-                if((copy_size + copy_offset) < alloc_size)
-                    write_size = ((copy_size + copy_offset - 1) / _fbsize + 1)
-                            * _fbsize;
-                else
-                    write_size = alloc_size;
+    HDassert(!(addr % file->fa.fbsize));
+    HDassert(!((size_t)buf % file->fa.mboundary));
 
-        /*
-          * Read the aligned data first if the aligned region doesn't fall
-         * entirely in the range to be writen.  Not able to handle interrupted
-     * system calls and partial results like sec2 driver does because the
-     * data may no longer be aligned. It's expecially true when the data in
-     * file is smaller than ALLOC_SIZE.  Only read the entire section if
-                 * both ends are misaligned, otherwise only read the block on the
-                 * misaligned end.
-         */
-        HDmemset(copy_buf, 0, _fbsize);
-
-                if(copy_offset > 0) {
-                    if((write_addr + write_size) > (addr + size)) {
-                        HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                        read_size = write_size;
-                        p1 = copy_buf;
-                    } /* end if */
-                    else {
-                        read_size = _fbsize;
-                        p1 = copy_buf;
-                    } /* end else */
-                } /* end if */
-                else if((write_addr + write_size) > (addr + size)) {
-                    HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                    read_size = _fbsize;
-                    p1 = (unsigned char *)copy_buf + write_size - _fbsize;
-
-                    /* Seek to the last block, for reading */
-                    HDassert(!((write_addr + write_size - _fbsize) % _fbsize));
-                    if(HDlseek(file->fd,
-                            (HDoff_t)(write_addr + write_size - _fbsize),
-                            SEEK_SET) < 0)
-                        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-                } /* end if */
-                else
-                    p1 = NULL;
+    HDmemset(buf, 0, file->fa.fbsize);
 
-                if(p1) {
-                    HDassert(!(read_size % _fbsize));
-                    do {
-                        nbytes = HDread(file->fd, p1, read_size);
-                    } while (-1==nbytes && EINTR==errno);
+    /* Reset last file I/O information, as we move the position */
+    file->pos = HADDR_UNDEF;
+    file->op = OP_UNKNOWN;
 
-                    if (-1==nbytes) /* error */
-                        HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-                } /* end if */
+    if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    do {
+        nbytes = HDread(file->fd, buf, file->fa.fbsize);
+    } while(-1 == nbytes && EINTR == errno);
+    if(-1 == nbytes)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
 
-        /* look for the right position and append or copy the data to be written to
-          * the aligned buffer.
-               * Consider all possible situations here: file address is not aligned on
-               * file block size; the end of data address is not aligned; the end of data
-               * address is aligned; data size is smaller or bigger than maximal copy size.
-         */
-        p1 = (unsigned char *)copy_buf + copy_offset;
-        if((copy_size + copy_offset) <= alloc_size) {
-                    HDmemcpy(p1, p3, copy_size);
-                    copy_size = 0;
-                } /* end if */
-                else {
-                    HDmemcpy(p1, p3, alloc_size - copy_offset);
-                    p3 = (const unsigned char *)p3 + (alloc_size - copy_offset);
-                    copy_size -= alloc_size - copy_offset;
-                    copy_offset = 0;
-                } /* end else */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_read_block() */
 
-        /*look for the aligned position for writing the data*/
-        HDassert(!(write_addr % _fbsize));
-        if(HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
 
-        /*
-          * Write the data. It doesn't truncate the extra data introduced by
-     * alignment because that step is done in H5FD_direct_flush.
-         */
-        HDassert(!(write_size % _fbsize));
-    do {
-        nbytes = HDwrite(file->fd, copy_buf, write_size);
-    } while (-1==nbytes && EINTR==errno);
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_write_aligned
+ *
+ * Purpose:  Writes SIZE bytes from BUF to the file at ADDR without
+ *    copying.  When the file system requires alignment, ADDR and
+ *    SIZE must be multiples of the block size and BUF must be
+ *    aligned on the memory boundary.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_write_aligned(H5FD_direct_t *file, haddr_t addr, size_t size,
+    const void *buf)
+{
+    ssize_t    nbytes;
+    herr_t        ret_value = SUCCEED;       /* Return value */
 
-    if (-1==nbytes) /* error */
-        HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    FUNC_ENTER_STATIC
 
-              /* update the write address */
-              write_addr += write_size;
-  } while (copy_size > 0);
+    HDassert(!file->fa.must_align || !(addr % file->fa.fbsize));
+    HDassert(!file->fa.must_align || !(size % file->fa.fbsize));
+    HDassert(!file->fa.must_align || !((size_t)buf % file->fa.mboundary));
 
-  /*Update the address and size*/
-  addr = write_addr;
-  buf = (const char*)buf + size;
+    /* Seek to the correct location */
+    if ((addr!=file->pos || OP_WRITE!=file->op) &&
+            HDlseek(file->fd, (HDoff_t)addr, SEEK_SET)<0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
 
-  if(copy_buf) {
-    /* Free with HDfree since it came from posix_memalign */
-      HDfree(copy_buf);
-      copy_buf = NULL;
-        } /* end if */
+    while (size>0) {
+        do {
+            nbytes = HDwrite(file->fd, buf, size);
+        } while (-1==nbytes && EINTR==errno);
+        if (-1==nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        HDassert(nbytes>0);
+        HDassert((size_t)nbytes<=size);
+        H5_CHECK_OVERFLOW(nbytes,ssize_t,size_t);
+        size -= (size_t)nbytes;
+        H5_CHECK_OVERFLOW(nbytes,ssize_t,haddr_t);
+        addr += (haddr_t)nbytes;
+        buf = (const char*)buf + nbytes;
     }
 
-    /* Update current position and eof */
+    /* Update current position */
     file->pos = addr;
     file->op = OP_WRITE;
-    if (file->pos>file->eof)
-        file->eof = file->pos;
 
 done:
     if(ret_value<0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if(copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
     } /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
-}
+} /* end H5FD__direct_write_aligned() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_wc_flush
+ *
+ * Purpose:  Writes the full blocks in the write-combining buffer to the
+ *    file and moves the partially filled last block, if any, to
+ *    the start of the buffer.  If ALL is set, the last block is
+ *    also written, completed from the file if there is data after
+ *    the buffered data, and the buffer is left empty.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_wc_flush(H5FD_direct_t *file, hbool_t all)
+{
+    size_t    fbsize = file->fa.fbsize;
+    size_t    nfull;                  /* Bytes in full blocks */
+    void    *block = NULL;          /* Last block as stored in the file */
+    herr_t        ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(0 == file->wc_len)
+        HGOTO_DONE(SUCCEED)
+
+    /* Write the full blocks */
+    nfull = (file->wc_len / fbsize) * fbsize;
+    if(nfull > 0) {
+        if(H5FD__direct_write_aligned(file, file->wc_addr, nfull, file->wc_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        file->wc_addr += nfull;
+        file->wc_len -= nfull;
+        if(file->wc_len > 0)
+            HDmemmove(file->wc_buf, file->wc_buf + nfull, file->wc_len);
+    } /* end if */
+
+    /* Write the last, partially filled block */
+    if(all && file->wc_len > 0) {
+        if(file->wc_addr + file->wc_len < file->eof) {
+            if(HDposix_memalign(&block, file->fa.mboundary, fbsize) != 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+            if(H5FD__direct_read_block(file, file->wc_addr, block) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            HDmemcpy(file->wc_buf + file->wc_len, (unsigned char *)block + file->wc_len, fbsize - file->wc_len);
+        } /* end if */
+        else
+            HDmemset(file->wc_buf + file->wc_len, 0, fbsize - file->wc_len);
+
+        /* The padding past the end of file is removed by truncate */
+        if(H5FD__direct_write_aligned(file, file->wc_addr, fbsize, file->wc_buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        file->wc_len = 0;
+    } /* end if */
+
+done:
+    /* Free with HDfree since it came from posix_memalign */
+    if(block)
+        HDfree(block);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_wc_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD__direct_wc_write
+ *
+ * Purpose:  Writes SIZE bytes from BUF to the file at ADDR through the
+ *    write-combining buffer.  Whole blocks from an aligned caller
+ *    buffer are written directly.  Other data is merged into the
+ *    buffer when it starts within or right after the buffered
+ *    data; otherwise the buffer is written out first.  A block is
+ *    only read from the file when a new run of writes starts
+ *    inside it.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_wc_write(H5FD_direct_t *file, haddr_t addr, size_t size,
+    const void *buf)
+{
+    size_t    fbsize = file->fa.fbsize;
+    size_t    cbsize = file->fa.cbsize;
+    herr_t        ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while(size > 0) {
+        size_t  offset;         /* Offset of ADDR in the buffer */
+        size_t  nbytes;         /* Bytes copied into the buffer */
+
+        if(0 == file->wc_len) {
+            /* Write whole blocks directly from an aligned caller buffer */
+            if(!(addr % fbsize) && size >= fbsize && !((size_t)buf % file->fa.mboundary)) {
+                nbytes = (size / fbsize) * fbsize;
+                if(H5FD__direct_write_aligned(file, addr, nbytes, buf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                addr += nbytes;
+                size -= nbytes;
+                buf = (const unsigned char *)buf + nbytes;
+                continue;
+            } /* end if */
+
+            /* Start a new run of writes in the buffer */
+            if(NULL == file->wc_buf) {
+                void *wc_buf;
+
+                if(HDposix_memalign(&wc_buf, file->fa.mboundary, cbsize) != 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+                file->wc_buf = (unsigned char *)wc_buf;
+            } /* end if */
+            file->wc_addr = (addr / fbsize) * fbsize;
+            file->wc_len = (size_t)(addr - file->wc_addr);
+
+            /* Get the start of the first block from the file */
+            if(file->wc_len > 0) {
+                if(file->wc_addr < file->eof) {
+                    if(H5FD__direct_read_block(file, file->wc_addr, file->wc_buf) < 0) {
+                        file->wc_len = 0;
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+                    } /* end if */
+                } /* end if */
+                else
+                    HDmemset(file->wc_buf, 0, file->wc_len);
+            } /* end if */
+        } /* end if */
+        else if(addr < file->wc_addr || addr > file->wc_addr + file->wc_len) {
+            /* Not adjacent to the buffered data */
+            if(H5FD__direct_wc_flush(file, TRUE) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write out combined writes")
+            continue;
+        } /* end if */
+        else if(addr == file->wc_addr + file->wc_len && !(file->wc_len % fbsize) &&
+                size >= fbsize && !((size_t)buf % file->fa.mboundary)) {
+            /* Only whole blocks are buffered and the caller's buffer can be
+             * written directly: write out the buffered blocks first */
+            if(H5FD__direct_wc_flush(file, FALSE) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write out combined writes")
+            continue;
+        } /* end if */
+
+        /* Copy as much as fits into the buffer */
+        offset = (size_t)(addr - file->wc_addr);
+        nbytes = MIN(size, cbsize - offset);
+        HDmemcpy(file->wc_buf + offset, buf, nbytes);
+        file->wc_len = MAX(file->wc_len, offset + nbytes);
+        addr += nbytes;
+        size -= nbytes;
+        buf = (const unsigned char *)buf + nbytes;
+
+        /* Write out the buffer when it is full */
+        if(file->wc_len == cbsize && H5FD__direct_wc_flush(file, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write out combined writes")
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_wc_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD_direct_flush
+ *
+ * Purpose:  Writes out the data in the write-combining buffer.
+ *
+ * Return:  Success:  Non-negative
+ *
+ *    Failure:  Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_direct_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_direct_t  *file = (H5FD_direct_t*)_file;
+    herr_t        ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(H5FD__direct_wc_flush(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write out combined writes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_direct_flush() */
+
 
-
 /*-------------------------------------------------------------------------
  * Function:  H5FD_direct_truncate
  *
@@ -1278,6 +1440,10 @@ H5FD_direct_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATT
 
     HDassert(file);
 
+    /* Write out the combined writes, so the file is truncated after them */
+    if (H5FD__direct_wc_flush(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write out combined writes")
+
     /* Extend the file to make sure it's large enough */
     if (file->eoa!=file->eof) {
 #ifdef H5_HAVE_WIN32_API
@@ -1344,8 +1510,8 @@ H5FD_direct_lock(H5FD_t *_file, hbool_t rw)
     HDassert(file);
 
     /* Determine the type of lock */
-    int lock = rw ? LOCK_EX : LOCK_SH;
-    
+    lock = rw ? LOCK_EX : LOCK_SH;
+
     /* Place the lock with non-blocking */
     if(HDflock(file->fd, lock | LOCK_NB) < 0)
         HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to flock file")
@@ -0,0 +1,633 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A read-only file driver that reads an HDF5 file image from a
+ *          buffer owned by the application, e.g. a file received over the
+ *          network.  The buffer is never copied, reallocated or freed by
+ *          the library, and must stay unchanged until the file is closed.
+ *          Reads are served by copying out of the buffer, and the name
+ *          given to H5Fopen() is only used to tell images apart in error
+ *          messages.
+ *
+ *          Unlike the core driver opened with a file image, nothing is
+ *          allocated for the file data, opening the image does no more
+ *          than parse the superblock, and attempts to open the image for
+ *          writing fail immediately.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDimage.h"      /* Read-only image driver   */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IMAGE_g = 0;
+
+/* Driver-specific file access properties: the image */
+typedef struct H5FD_image_fapl_t {
+    const void      *buf;       /* the application's buffer         */
+    size_t          size;       /* size of the image in bytes       */
+} H5FD_image_fapl_t;
+
+/* The description of a file belonging to this driver.  The 'eof' is the
+ * size of the image.
+ */
+typedef struct H5FD_image_t {
+    H5FD_t          pub;        /* public stuff, must be first      */
+    const void      *mem;       /* the application's buffer         */
+    haddr_t         eoa;        /* end of allocated region          */
+    haddr_t         eof;        /* end of file; size of the image   */
+    char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+} H5FD_image_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely in memory.
+ */
+#define MAXADDR                 ((haddr_t)((~(size_t)0) - 1))
+#define ADDR_OVERFLOW(A)        (HADDR_UNDEF == (A) || (A) > (haddr_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || (haddr_t)(Z) > (haddr_t)MAXADDR ||  \
+                                 (A) + (Z) > (haddr_t)MAXADDR)
+
+/* Prototypes */
+static herr_t H5FD_image_term(void);
+static void *H5FD_image_fapl_get(H5FD_t *_file);
+static H5FD_t *H5FD_image_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_image_close(H5FD_t *_file);
+static int H5FD_image_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_image_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_image_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_image_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_image_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_image_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_image_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_image_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+
+static const H5FD_class_t H5FD_image_g = {
+    "image",                    /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_image_term,            /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_image_fapl_t),  /* fapl_size            */
+    H5FD_image_fapl_get,        /* fapl_get             */
+    NULL,                       /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_image_open,            /* open                 */
+    H5FD_image_close,           /* close                */
+    H5FD_image_cmp,             /* cmp                  */
+    H5FD_image_query,           /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_image_get_eoa,         /* get_eoa              */
+    H5FD_image_set_eoa,         /* set_eoa              */
+    H5FD_image_get_eof,         /* get_eof              */
+    H5FD_image_get_handle,      /* get_handle           */
+    H5FD_image_read,            /* read                 */
+    H5FD_image_write,           /* write                */
+    NULL,                       /* flush                */
+    NULL,                       /* truncate             */
+    NULL,                       /* lock                 */
+    NULL,                       /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_image_t struct */
+H5FL_DEFINE_STATIC(H5FD_image_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_image_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize image VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the image driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_image_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_IMAGE_g))
+        H5FD_IMAGE_g = H5FD_register(&H5FD_image_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IMAGE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_image_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IMAGE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_image_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_image
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_IMAGE
+ *              driver defined in this source file, reading the file image
+ *              of SIZE bytes at BUF.  Only the pointer is stored: the
+ *              buffer must stay valid and unchanged as long as the
+ *              property list or a file opened with it is in use.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_image(hid_t fapl_id, const void *buf, size_t size)
+{
+    H5FD_image_fapl_t fa;       /* Image VFD info */
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*xz", fapl_id, buf, size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(NULL == buf || 0 == size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no file image")
+
+    fa.buf = buf;
+    fa.size = size;
+
+    ret_value = H5P_set_driver(plist, H5FD_IMAGE, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_image() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_image
+ *
+ * Purpose:     Returns the file image set with H5Pset_fapl_image().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_image(hid_t fapl_id, const void **buf/*out*/, size_t *size/*out*/)
+{
+    const H5FD_image_fapl_t *fa;        /* Image VFD info */
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i**xx", fapl_id, buf, size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(H5FD_IMAGE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_image_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if(buf)
+        *buf = fa->buf;
+    if(size)
+        *size = fa->size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_image() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed.
+ *
+ * Return:      Success:    Ptr to new file access property list.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_image_fapl_get(H5FD_t *_file)
+{
+    H5FD_image_t        *file = (H5FD_image_t *)_file;
+    H5FD_image_fapl_t   *fa;
+    void                *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (fa = (H5FD_image_fapl_t *)H5MM_malloc(sizeof(H5FD_image_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    fa->buf = file->mem;
+    fa->size = (size_t)file->eof;
+
+    /* Set return value */
+    ret_value = fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_open
+ *
+ * Purpose:     Opens the file image set in the file access property list
+ *              for reading.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_image_open(const char *name, unsigned flags, hid_t fapl_id,
+    haddr_t maxaddr)
+{
+    H5FD_image_t            *file = NULL;   /* Image VFD info       */
+    const H5FD_image_fapl_t *fa;            /* Image fapl info      */
+    H5P_genplist_t          *plist;         /* Property list        */
+    H5FD_t                  *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+    if(flags & (H5F_ACC_RDWR | H5F_ACC_TRUNC | H5F_ACC_CREAT | H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "file images opened with the image driver are read-only")
+
+    /* Get the image */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_image_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+    HDassert(fa->buf && fa->size > 0);
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_image_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->mem = fa->buf;
+    file->eof = (haddr_t)fa->size;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_close
+ *
+ * Purpose:     Closes a file image.  The application's buffer is left
+ *              alone.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_close(H5FD_t *_file)
+{
+    H5FD_image_t *file = (H5FD_image_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_image_t, file);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_image_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver by the address
+ *              and size of their images, so opening the same buffer twice
+ *              opens the same file.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_image_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_image_t  *f1 = (const H5FD_image_t *)_f1;
+    const H5FD_image_t  *f2 = (const H5FD_image_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if((const char *)f1->mem < (const char *)f2->mem) HGOTO_DONE(-1)
+    if((const char *)f1->mem > (const char *)f2->mem) HGOTO_DONE(1)
+    if(f1->eof < f2->eof) HGOTO_DONE(-1)
+    if(f1->eof > f2->eof) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Reads are copies out of the image, so neither metadata
+ *              accumulation nor data sieving would save anything: both
+ *              are left off, so that nothing bigger than requested is
+ *              ever copied.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_image_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_image_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_image_t	*file = (const H5FD_image_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_image_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_image_t	*file = (H5FD_image_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_image_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              image.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              image.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_image_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_image_t  *file = (const H5FD_image_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_image_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_image_get_handle
+ *
+ * Purpose:        Returns a pointer to the pointer to the image, which is
+ *                 the application's buffer.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_image_t        *file = (H5FD_image_t *)_file;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = (void *)&(file->mem);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF, by copying them out of the image.  Bytes
+ *              past the end of the image are returned as zeros.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_image_t    *file       = (H5FD_image_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Copy the part of the request that's in the image */
+    if(addr < file->eof) {
+        size_t nbytes = (size_t)MIN((haddr_t)size, file->eof - addr);
+
+        HDmemcpy(buf, (const unsigned char *)file->mem + addr, nbytes);
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    } /* end if */
+
+    /* End of file but not end of format address space */
+    if(size > 0)
+        HDmemset(buf, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_image_write
+ *
+ * Purpose:     Fails: file images opened with this driver are read-only.
+ *
+ * Return:      FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_image_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    H5FD_image_t    *file       = (H5FD_image_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file image '%s' is read-only", file->filename)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_image_write() */
+
@@ -0,0 +1,35 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only file image driver.
+ */
+#ifndef H5FDimage_H
+#define H5FDimage_H
+
+#define H5FD_IMAGE	(H5FD_image_init())
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t H5FD_image_init(void);
+H5_DLL herr_t H5Pset_fapl_image(hid_t fapl_id, const void *buf, size_t size);
+H5_DLL herr_t H5Pget_fapl_image(hid_t fapl_id, const void **buf/*out*/,
+    size_t *size/*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,726 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A read-only file driver that maps the file into memory with
+ *          mmap() the first time it is accessed, and serves reads by
+ *          copying out of the mapping.  The pages of the file are shared
+ *          through the operating system's page cache with every other
+ *          process that maps or reads the file.
+ *
+ *          The driver doesn't allow data sieving, so contiguous dataset
+ *          reads are copied straight from the mapping into the
+ *          application's buffer.  H5Fget_vfd_handle() returns a pointer
+ *          to the mapping, which applications can combine with
+ *          H5Dget_offset() to access contiguous, unfiltered dataset
+ *          storage in place.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDmmap.h"       /* mmap file driver         */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+#ifdef H5_HAVE_MMAP
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_MMAP_g = 0;
+
+/* The description of a file belonging to this driver.  The 'eof' is the
+ * size of the file when it was opened, which is also the size of the
+ * mapping.  'mem' is NULL until the file is first accessed.  The file
+ * must not be truncated while it is mapped (see H5Pset_fapl_mmap).
+ */
+typedef struct H5FD_mmap_t {
+    H5FD_t          pub;        /* public stuff, must be first      */
+    int             fd;         /* the filesystem file descriptor   */
+    haddr_t         eoa;        /* end of allocated region          */
+    haddr_t         eof;        /* end of file; current file size   */
+    void            *mem;       /* the mapping of the file          */
+    char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t           device;     /* file device number   */
+    ino_t           inode;      /* file i-node number   */
+} H5FD_mmap_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Prototypes */
+static herr_t H5FD_mmap_term(void);
+static H5FD_t *H5FD_mmap_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_mmap_close(H5FD_t *_file);
+static int H5FD_mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_mmap_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_mmap_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_mmap_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_mmap_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_mmap_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_mmap_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_mmap_unlock(H5FD_t *_file);
+static herr_t H5FD_mmap_map(H5FD_mmap_t *file);
+
+static const H5FD_class_t H5FD_mmap_g = {
+    "mmap",                     /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_mmap_term,             /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    0,                          /* fapl_size            */
+    NULL,                       /* fapl_get             */
+    NULL,                       /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_mmap_open,             /* open                 */
+    H5FD_mmap_close,            /* close                */
+    H5FD_mmap_cmp,              /* cmp                  */
+    H5FD_mmap_query,            /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_mmap_get_eoa,          /* get_eoa              */
+    H5FD_mmap_set_eoa,          /* set_eoa              */
+    H5FD_mmap_get_eof,          /* get_eof              */
+    H5FD_mmap_get_handle,       /* get_handle           */
+    H5FD_mmap_read,             /* read                 */
+    H5FD_mmap_write,            /* write                */
+    NULL,                       /* flush                */
+    NULL,                       /* truncate             */
+    H5FD_mmap_lock,             /* lock                 */
+    H5FD_mmap_unlock,           /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_mmap_t struct */
+H5FL_DEFINE_STATIC(H5FD_mmap_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_mmap_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize mmap VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the mmap driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_mmap_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_MMAP_g))
+        H5FD_MMAP_g = H5FD_register(&H5FD_mmap_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_MMAP_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_mmap_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_MMAP_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mmap_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_mmap
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_MMAP
+ *              driver defined in this source file.  There are no driver
+ *              specific properties.
+ *
+ *              Reads are copied out of a mapping of the file, so the file
+ *              must not be truncated by another process while it is open:
+ *              touching the part of the mapping past the new end of the
+ *              file raises SIGBUS.  A file found to be shorter than when
+ *              it was opened by the time it is mapped is refused.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mmap(hid_t fapl_id)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", fapl_id);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    ret_value = H5P_set_driver(plist, H5FD_MMAP, NULL);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mmap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_open
+ *
+ * Purpose:     Opens an existing HDF5 file for reading.  The file isn't
+ *              mapped until it is first accessed.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_mmap_open(const char *name, unsigned flags, hid_t H5_ATTR_UNUSED fapl_id,
+    haddr_t maxaddr)
+{
+    H5FD_mmap_t     *file       = NULL;     /* mmap VFD info            */
+    int             fd          = -1;       /* File descriptor          */
+    h5_stat_t       sb;
+    H5FD_t          *ret_value = NULL;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+    if(flags & (H5F_ACC_RDWR | H5F_ACC_TRUNC | H5F_ACC_CREAT | H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "the mmap driver only supports opening existing files read-only")
+
+    /* Open the file */
+    if((fd = HDopen(name, O_RDONLY, 0666)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x", name, myerrno, HDstrerror(myerrno), flags);
+    } /* end if */
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* The whole file must fit in the address space */
+    if((h5_stat_size_t)((size_t)sb.st_size) != sb.st_size)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "file is too large to map: name = '%s'", name)
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_mmap_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    if(NULL == ret_value) {
+        if(fd >= 0)
+            HDclose(fd);
+        if(file)
+            file = H5FL_FREE(H5FD_mmap_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_close
+ *
+ * Purpose:     Unmaps and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_close(H5FD_t *_file)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+    herr_t      ret_value = SUCCEED;                /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Remove the mapping */
+    if(file->mem && HDmunmap(file->mem, (size_t)file->eof) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to unmap file")
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_mmap_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_mmap_t   *f1 = (const H5FD_mmap_t *)_f1;
+    const H5FD_mmap_t   *f2 = (const H5FD_mmap_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Reads are copies out of the mapping, so neither metadata
+ *              accumulation nor data sieving would save anything: both
+ *              are left off, and raw data is copied straight into the
+ *              application's buffer.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mmap_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t	*file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_mmap_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_mmap_t	*file = (H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mmap_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              file when it was opened.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_mmap_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t   *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_mmap_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_mmap_get_handle
+ *
+ * Purpose:        Returns a pointer to the address of the mapping of the
+ *                 file, mapping it first if necessary.  The mapping is
+ *                 read-only and stays valid until the file is closed.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_mmap_t         *file = (H5FD_mmap_t *)_file;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    if(H5FD_mmap_map(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to map file")
+
+    *file_handle = &(file->mem);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF, by copying them out of the mapping of the
+ *              file.  Bytes past the end of the file are returned as zeros.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_mmap_t     *file       = (H5FD_mmap_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Map the file on first access */
+    if(H5FD_mmap_map(file) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to map file")
+
+    /* Copy the part of the request that's in the file */
+    if(addr < file->eof) {
+        size_t nbytes = (size_t)MIN((haddr_t)size, file->eof - addr);
+
+        HDmemcpy(buf, (const unsigned char *)file->mem + addr, nbytes);
+        size -= nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    } /* end if */
+
+    /* End of file but not end of format address space */
+    if(size > 0)
+        HDmemset(buf, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_write
+ *
+ * Purpose:     Fails: files opened with this driver are read-only.
+ *
+ * Return:      FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "files opened with the mmap driver are read-only")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;   /* VFD file struct          */
+    int lock_flags;                             /* file locking flags       */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if(HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to lock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_unlock(H5FD_t *_file)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;   /* VFD file struct          */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to unlock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_unlock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_map
+ *
+ * Purpose:     Maps the whole file into memory, read-only, if it isn't
+ *              mapped yet.  Empty files are never mapped.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_map(H5FD_mmap_t *file)
+{
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(NULL == file->mem && file->eof > 0) {
+        void *mem;                              /* Address of the mapping   */
+        h5_stat_t sb;                           /* Current info about the file */
+
+        /* Don't map past the end of a file truncated since it was opened */
+        if(HDfstat(file->fd, &sb) < 0)
+            HSYS_GOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to fstat file")
+        if((haddr_t)sb.st_size < file->eof)
+            HGOTO_ERROR(H5E_IO, H5E_TRUNCATED, FAIL, "file was truncated since it was opened: filename = '%s', eof = %llu, current size = %llu", file->filename, (unsigned long long)file->eof, (unsigned long long)sb.st_size);
+
+        if(MAP_FAILED == (mem = HDmmap(NULL, (size_t)file->eof, PROT_READ, MAP_SHARED, file->fd, (HDoff_t)0))) {
+            int myerrno = errno;
+            HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to map file: filename = '%s', errno = %d, error message = '%s', size = %llu", file->filename, myerrno, HDstrerror(myerrno), (unsigned long long)file->eof);
+        } /* end if */
+        file->mem = mem;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_map() */
+
+#endif /* H5_HAVE_MMAP */
+
@@ -67,6 +67,10 @@ typedef struct H5FD_mpio_t {
     haddr_t	eoa;		/*end-of-address marker			*/
     haddr_t	last_eoa;	/* Last known end-of-address marker	*/
     haddr_t	local_eof;	/* Local end-of-file address for each process */
+    hsize_t	stripe_size;	/* File system stripe size, 0 if unknown */
+    size_t	open_image_size; /* Bytes to broadcast at open, from the fapl */
+    unsigned char *open_image;	/* Start of the file, broadcast at open	*/
+    size_t	open_image_len;	/* Number of bytes in open_image	*/
 } H5FD_mpio_t;
 
 /* Private Prototypes */
@@ -320,6 +324,7 @@ H5Pset_fapl_mpio(hid_t fapl_id, MPI_Comm comm, MPI_Info info)
     /* Initialize driver specific properties */
     fa.comm = comm;
     fa.info = info;
+    fa.open_image_size = 0;
 
     /* duplication is done during driver setting. */
     ret_value = H5P_set_driver(plist, H5FD_MPIO, &fa);
@@ -406,6 +411,105 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_fapl_mpio() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_mpio_open_image
+ *
+ * Purpose:	Makes files opened with FAPL_ID read the first SIZE bytes
+ *		of the file on process 0 only and broadcast them to the
+ *		other processes, which then read the superblock and the
+ *		root group metadata found there from memory.  This avoids
+ *		having every process issue the same small reads when
+ *		opening an existing file.  Zero (the default) turns this
+ *		off.
+ *
+ *		Files opened read-only keep the image until they are
+ *		closed, files opened read-write drop it at the end of the
+ *		open.  The image is not used with SWMR reading.
+ *
+ *		The file access property list must already use the MPI-IO
+ *		driver, and calling H5Pset_fapl_mpio() again resets SIZE.
+ *		All processes must use the same SIZE.
+ *
+ * Return:	Success:	Non-negative
+ *
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mpio_open_image(hid_t fapl_id, size_t size)
+{
+    const H5FD_mpio_fapl_t *old_fa;   /* Current MPIO fapl info */
+    H5FD_mpio_fapl_t	fa;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, size);
+
+    if(fapl_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list")
+
+    /* Check arguments */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_MPIO != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (old_fa = (const H5FD_mpio_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(size >= (size_t)INT_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "open image size too large")
+
+    /* Update driver specific properties */
+    HDmemcpy(&fa, old_fa, sizeof(H5FD_mpio_fapl_t));
+    fa.open_image_size = size;
+
+    /* duplication is done during driver setting. */
+    ret_value = H5P_set_driver(plist, H5FD_MPIO, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mpio_open_image() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_mpio_open_image
+ *
+ * Purpose:	Returns the number of bytes at the start of the file that
+ *		are broadcast from process 0 when a file is opened with
+ *		FAPL_ID, see H5Pset_fapl_mpio_open_image().
+ *
+ * Return:	Success:	Non-negative
+ *
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_mpio_open_image(hid_t fapl_id, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_mpio_fapl_t *fa;       /* MPIO fapl info */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_MPIO != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_mpio_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if(size)
+        *size = fa->open_image_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_mpio_open_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_dxpl_mpio
@@ -704,6 +808,7 @@ H5FD_mpio_fapl_get(H5FD_t *_file)
     /* Duplicate communicator and Info object. */
     if(FAIL == H5FD_mpi_comm_info_dup(file->comm, file->info, &fa->comm, &fa->info))
 	HGOTO_ERROR(H5E_INTERNAL, H5E_CANTCOPY, NULL, "Communicator/Info duplicate failed")
+    fa->open_image_size = file->open_image_size;
 
     /* Set return value */
     ret_value = fa;
@@ -901,6 +1006,68 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_get_mpio_stripe_size
+ *
+ * Purpose:	Returns the stripe size of the file system holding the
+ *		file, as reported by the "striping_unit" hint of the
+ *		MPI-IO implementation when the file was opened.  Zero
+ *		means the stripe size is unknown.
+ *
+ * Return:	Success:	Non-negative
+ *
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_get_mpio_stripe_size(const H5FD_t *_file, hsize_t *stripe_size)
+{
+    const H5FD_mpio_t *file = (const H5FD_mpio_t*)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+    HDassert(stripe_size);
+
+    *stripe_size = file->stripe_size;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_get_mpio_stripe_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_free_open_image
+ *
+ * Purpose:	Frees the image of the start of the file broadcast when the
+ *		file was opened, if any.  Called at the end of opening a
+ *		file for writing: from then on other processes may write
+ *		to the file, so reads must go to the file.
+ *
+ * Return:	Success:	Non-negative
+ *
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_mpio_free_open_image(H5FD_t *_file)
+{
+    H5FD_mpio_t *file = (H5FD_mpio_t*)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+
+    file->open_image = (unsigned char *)H5MM_xfree(file->open_image);
+    file->open_image_len = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mpio_free_open_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_mpio_open
@@ -955,6 +1122,7 @@ H5FD_mpio_open(const char *name, unsigned flags, hid_t fapl_id,
     if(H5P_FILE_ACCESS_DEFAULT == fapl_id || H5FD_MPIO != H5P_peek_driver(plist)) {
 	_fa.comm = MPI_COMM_SELF; /*default*/
 	_fa.info = MPI_INFO_NULL; /*default*/
+	_fa.open_image_size = 0; /*default*/
 	fa = &_fa;
     } /* end if */
     else {
@@ -1012,6 +1180,25 @@ H5FD_mpio_open(const char *name, unsigned flags, hid_t fapl_id,
     file->mpi_rank = mpi_rank;
     file->mpi_size = mpi_size;
 
+    /* Get the stripe size the MPI-IO layer uses for the file, if any */
+    {
+        MPI_Info    info_used = MPI_INFO_NULL;
+        char        value[MPI_MAX_INFO_VAL + 1];
+        int         flag = 0;
+
+        if(MPI_SUCCESS != (mpi_code = MPI_File_get_info(fh, &info_used)))
+            HMPI_GOTO_ERROR(NULL, "MPI_File_get_info failed", mpi_code)
+        if(MPI_INFO_NULL != info_used) {
+            if(MPI_SUCCESS == MPI_Info_get(info_used, "striping_unit", MPI_MAX_INFO_VAL, value, &flag) && flag) {
+                long long stripe = HDstrtoll(value, NULL, 10);
+
+                if(stripe > 0)
+                    file->stripe_size = (hsize_t)stripe;
+            } /* end if */
+            MPI_Info_free(&info_used);
+        } /* end if */
+    }
+
     /* Only processor p0 will get the filesize and broadcast it. */
     if (mpi_rank == 0) {
         if (MPI_SUCCESS != (mpi_code=MPI_File_get_size(fh, &size)))
@@ -1039,6 +1226,37 @@ H5FD_mpio_open(const char *name, unsigned flags, hid_t fapl_id,
     file->eof = H5FD_mpi_MPIOff_to_haddr(size);
     file->local_eof = file->eof;
 
+    /* Have process 0 read the start of the file and broadcast it, so the
+     * other processes can read the superblock and root metadata from
+     * memory.  The byte after the image tells whether process 0 read it
+     * successfully -- if not, all processes just read the file.
+     */
+    file->open_image_size = fa->open_image_size;
+    if(fa->open_image_size > 0 && size > 0 && !(flags & H5F_ACC_SWMR_READ)) {
+        size_t image_len = (size_t)MIN((MPI_Offset)fa->open_image_size, size);
+
+        if(NULL == (file->open_image = (unsigned char *)H5MM_malloc(image_len + 1)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for open image")
+
+        if(mpi_rank == 0) {
+            MPI_Status mpi_stat;
+            int bytes_read = 0;
+
+            HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+            file->open_image[image_len] = (unsigned char)(MPI_SUCCESS == MPI_File_read_at(fh, (MPI_Offset)0, file->open_image, (int)image_len, MPI_BYTE, &mpi_stat)
+                    && MPI_SUCCESS == MPI_Get_count(&mpi_stat, MPI_BYTE, &bytes_read)
+                    && (size_t)bytes_read == image_len);
+        } /* end if */
+
+        if(MPI_SUCCESS != (mpi_code = MPI_Bcast(file->open_image, (int)(image_len + 1), MPI_BYTE, 0, comm_dup)))
+            HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
+
+        if(file->open_image[image_len])
+            file->open_image_len = image_len;
+        else
+            file->open_image = (unsigned char *)H5MM_xfree(file->open_image);
+    } /* end if */
+
     /* Set return value */
     ret_value=(H5FD_t*)file;
 
@@ -1050,8 +1268,10 @@ done:
 	    MPI_Comm_free(&comm_dup);
 	if (MPI_INFO_NULL != info_dup)
 	    MPI_Info_free(&info_dup);
-	if (file)
+	if (file) {
+	    H5MM_xfree(file->open_image);
 	    H5MM_xfree(file);
+	} /* end if */
     } /* end if */
 
 #ifdef H5FDmpio_DEBUG
@@ -1107,6 +1327,7 @@ H5FD_mpio_close(H5FD_t *_file)
 
     /* Clean up other stuff */
     H5FD_mpi_comm_info_free(&file->comm, &file->info);
+    H5MM_xfree(file->open_image);
     H5MM_xfree(file);
 
 done:
@@ -1462,6 +1683,15 @@ H5FD_mpio_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t dxpl_id, had
 		(long)mpi_off, size_i );
 #endif
 
+    /* Metadata within the start of the file broadcast at open is read
+     * from memory.  Every process holds the same image, so the processes
+     * still agree on which reads reach the file.
+     */
+    if(file->open_image && type != H5FD_MEM_DRAW && (addr + size) <= file->open_image_len) {
+        HDmemcpy(buf, file->open_image + addr, size);
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Only look for MPI views for raw data transfers */
     if(type == H5FD_MEM_DRAW) {
         H5FD_mpio_xfer_t            xfer_mode;   /* I/O tranfer mode */
@@ -1755,6 +1985,12 @@ H5FD_mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     if((hsize_t)size_i != size)
         HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from size to size_i")
 
+    /* The image of the start of the file broadcast at open is stale now */
+    if(file->open_image) {
+        file->open_image = (unsigned char *)H5MM_xfree(file->open_image);
+        file->open_image_len = 0;
+    } /* end if */
+
 #ifdef H5FDmpio_DEBUG
     if(H5FD_mpio_Debug[(int)'w'])
         fprintf(stdout, "in H5FD_mpio_write  mpi_off=%ld  size_i=%d\n", (long)mpi_off, size_i);
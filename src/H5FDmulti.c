@@ -33,6 +33,19 @@
 
 #include "hdf5.h"
 
+/*
+ * Asynchronous members are written behind by one thread each.  Without
+ * thread support their writes are simply performed synchronously.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#define H5FD_MULTI_USE_THREADS
+#endif
+#ifdef H5_HAVE_GETTIMEOFDAY
+#include <sys/time.h>
+#endif
 
 #ifndef FALSE
 #define FALSE		0
@@ -68,6 +81,9 @@
 
 #define H5FD_MULT_MAX_FILE_NAME_LEN     1024
 
+/* Bytes which may be queued behind an asynchronous member before writers block */
+#define H5FD_MULTI_MAX_QUEUED           (64 * 1024 * 1024)
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_MULTI_g = 0;
 
@@ -78,8 +94,43 @@ typedef struct H5FD_multi_fapl_t {
     char        *memb_name[H5FD_MEM_NTYPES];    /*name generators               */
     haddr_t     memb_addr[H5FD_MEM_NTYPES];     /*starting addr per member      */
     hbool_t     relax;                          /*less stringent error checking	*/
+    hbool_t     memb_async[H5FD_MEM_NTYPES];    /*write members behind?         */
+    H5FD_multi_stats_t memb_stats[H5FD_MEM_NTYPES]; /*I/O statistics snapshot   */
 } H5FD_multi_fapl_t;
 
+#ifdef H5FD_MULTI_USE_THREADS
+/* A write queued for an asynchronous member */
+typedef struct H5FD_multi_req_t {
+    struct H5FD_multi_req_t *next;              /*next request in FIFO order    */
+    H5FD_mem_t  type;                           /*memory usage type             */
+    haddr_t     addr;                           /*member-relative address       */
+    size_t      size;                           /*number of bytes               */
+    unsigned char *buf;                         /*private copy of the data      */
+} H5FD_multi_req_t;
+#endif /* H5FD_MULTI_USE_THREADS */
+
+/* Per-member I/O state */
+typedef struct H5FD_multi_io_t {
+    H5FD_multi_stats_t  stats;                  /*I/O statistics                */
+#ifdef H5FD_MULTI_USE_THREADS
+    int         fd;                             /*descriptor owned by the thread*/
+    haddr_t     base_addr;                      /*member's base address         */
+    hbool_t     running;                        /*writer thread started?        */
+    hbool_t     sync_only;                      /*member can't be written behind*/
+    hbool_t     busy;                           /*writer thread in a write?     */
+    hbool_t     shutdown;                       /*writer thread asked to exit?  */
+    int         nerrors;                        /*failed background writes      */
+    int         error;                          /*errno of the first failure    */
+    haddr_t     err_addr;                       /*address of the first failure  */
+    haddr_t     end;                            /*end of the data written behind*/
+    size_t      queued;                         /*bytes waiting to be written   */
+    H5FD_multi_req_t *head, *tail;              /*queued writes                 */
+    pthread_t   thread;                         /*the writer thread             */
+    pthread_mutex_t mutex;                      /*protects all of the above     */
+    pthread_cond_t cond;                        /*signals queue changes         */
+#endif /* H5FD_MULTI_USE_THREADS */
+} H5FD_multi_io_t;
+
 /*
  * The description of a file belonging to this driver. The file access
  * properties and member names do not have to be copied into this struct
@@ -98,6 +149,7 @@ typedef struct H5FD_multi_t {
                                                      *with the EOAs for individual files        */
     unsigned            flags;                      /*file open flags saved for debugging       */
     char               *name;                       /*name passed to H5Fopen or H5Fcreate       */
+    H5FD_multi_io_t     io[H5FD_MEM_NTYPES];        /*per-member statistics and write queues    */
 } H5FD_multi_t;
 
 /* Driver specific data transfer properties */
@@ -109,6 +161,19 @@ typedef struct H5FD_multi_dxpl_t {
 static char *my_strdup(const char *s);
 static int compute_next(H5FD_multi_t *file);
 static int open_members(H5FD_multi_t *file);
+static double get_time(void);
+static int memb_sync(H5FD_multi_t *file, H5FD_mem_t mt);
+static int memb_stop(H5FD_multi_t *file, H5FD_mem_t mt);
+static haddr_t memb_get_eof(H5FD_multi_t *file, H5FD_mem_t mt, haddr_t eof);
+static void memb_truncated(H5FD_multi_t *file, H5FD_mem_t mt);
+static void memb_get_stats(H5FD_multi_t *file, H5FD_mem_t mt,
+			   H5FD_multi_stats_t *stats/*out*/);
+#ifdef H5FD_MULTI_USE_THREADS
+static void *memb_writer(void *_io);
+static int memb_queue(H5FD_multi_t *file, H5FD_mem_t mt, H5FD_mem_t type,
+		      haddr_t addr, size_t size, const void *buf);
+#endif /* H5FD_MULTI_USE_THREADS */
+static const H5FD_multi_fapl_t *get_multi_fapl(hid_t fapl_id, const char *func);
 
 /* Callback prototypes */
 static herr_t H5FD_multi_term(void);
@@ -502,6 +567,8 @@ H5Pset_fapl_multi(hid_t fapl_id, const H5FD_mem_t *memb_map,
     memcpy(fa.memb_name, memb_name, H5FD_MEM_NTYPES*sizeof(char*));
     memcpy(fa.memb_addr, memb_addr, H5FD_MEM_NTYPES*sizeof(haddr_t));
     fa.relax = relax;
+    memset(fa.memb_async, 0, sizeof(fa.memb_async));
+    memset(fa.memb_stats, 0, sizeof(fa.memb_stats));
 
     /* Patch up H5P_DEFAULT property lists for members */
     for (mt=H5FD_MEM_DEFAULT; mt<H5FD_MEM_NTYPES; mt=(H5FD_mem_t)(mt+1)) {
@@ -576,6 +643,152 @@ H5Pget_fapl_multi(hid_t fapl_id, H5FD_mem_t *memb_map/*out*/,
     return 0;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_multi_async
+ *
+ * Purpose:	Makes the member file holding memory usage type TYPE of a
+ *		multi file access property list asynchronous (or synchronous
+ *		again when ASYNC is false).  Writes to an asynchronous member
+ *		are copied and queued to a thread of its own, so that raw
+ *		data can be written while meta data I/O continues on the
+ *		other members.  Any other operation on the member waits for
+ *		its queued writes first.  For example, to keep the meta data
+ *		of a split file on one device and write the raw data behind
+ *		to another:
+ *
+ *		    H5Pset_fapl_split(fapl, ".meta", sec2_fapl,
+ *		                      ".raw", sec2_fapl);
+ *		    H5Pset_fapl_multi_async(fapl, H5FD_MEM_DRAW, TRUE);
+ *
+ *		The writer thread never enters the library: it writes
+ *		with pwrite() on its own duplicate of the member's file
+ *		descriptor, so only members using the sec2 driver are
+ *		written behind and writes to other members are performed
+ *		synchronously, as they are when the library is built
+ *		without thread-safety.  A failed queued write is reported
+ *		by the next operation on the member, at the latest when
+ *		the file is flushed or closed.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_multi_async(hid_t fapl_id, H5FD_mem_t type, hbool_t async)
+{
+    const H5FD_multi_fapl_t *old_fa;
+    H5FD_multi_fapl_t	fa;
+    H5FD_mem_t		mmt;
+    static const char *func="H5FDset_fapl_multi_async";  /* Function Name for error reporting */
+
+    /*NO TRACE*/
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(NULL == (old_fa = get_multi_fapl(fapl_id, func)))
+        return -1;
+    if(type <= H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADRANGE, "file resource type out of range", -1)
+
+    /* The driver info is copied again by H5Pset_driver() */
+    memcpy(&fa, old_fa, sizeof(H5FD_multi_fapl_t));
+    mmt = fa.memb_map[type];
+    if(H5FD_MEM_DEFAULT == mmt)
+        mmt = type;
+    fa.memb_async[mmt] = async;
+
+    return H5Pset_driver(fapl_id, H5FD_MULTI, &fa);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_multi_async
+ *
+ * Purpose:	Returns whether the member file holding memory usage type
+ *		TYPE is written asynchronously.  See
+ *		H5Pset_fapl_multi_async().
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_multi_async(hid_t fapl_id, H5FD_mem_t type, hbool_t *async/*out*/)
+{
+    const H5FD_multi_fapl_t *fa;
+    H5FD_mem_t		mmt;
+    static const char *func="H5FDget_fapl_multi_async";  /* Function Name for error reporting */
+
+    /*NO TRACE*/
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(NULL == (fa = get_multi_fapl(fapl_id, func)))
+        return -1;
+    if(type <= H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADRANGE, "file resource type out of range", -1)
+
+    mmt = fa->memb_map[type];
+    if(H5FD_MEM_DEFAULT == mmt)
+        mmt = type;
+    if(async)
+        *async = fa->memb_async[mmt];
+
+    return 0;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_multi_stats
+ *
+ * Purpose:	Returns the I/O statistics of the member file holding memory
+ *		usage type TYPE.  The statistics are those of the open file
+ *		at the time its access property list was retrieved with
+ *		H5Fget_access_plist(); for any other property list they are
+ *		all zero.  Write statistics of an asynchronous member only
+ *		cover the writes which have completed.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_multi_stats(hid_t fapl_id, H5FD_mem_t type,
+			H5FD_multi_stats_t *stats/*out*/)
+{
+    const H5FD_multi_fapl_t *fa;
+    H5FD_mem_t		mmt;
+    static const char *func="H5FDget_fapl_multi_stats";  /* Function Name for error reporting */
+
+    /*NO TRACE*/
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(NULL == (fa = get_multi_fapl(fapl_id, func)))
+        return -1;
+    if(type <= H5FD_MEM_DEFAULT || type >= H5FD_MEM_NTYPES)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADRANGE, "file resource type out of range", -1)
+    if(!stats)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_ARGS, H5E_BADVALUE, "no statistics buffer", -1)
+
+    mmt = fa->memb_map[type];
+    if(H5FD_MEM_DEFAULT == mmt)
+        mmt = type;
+    memcpy(stats, &fa->memb_stats[mmt], sizeof(H5FD_multi_stats_t));
+
+    return 0;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_multi_sb_size
@@ -808,6 +1021,7 @@ H5FD_multi_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
         } END_MEMBERS;
         ALL_MEMBERS(mt) {
             if (!in_use[mt] && file->memb[mt]) {
+                (void)memb_stop(file, mt);
                 (void)H5FDclose(file->memb[mt]);
                 file->memb[mt] = NULL;
             }
@@ -866,11 +1080,20 @@ static void *
 H5FD_multi_fapl_get(H5FD_t *_file)
 {
     H5FD_multi_t	*file = (H5FD_multi_t*)_file;
+    H5FD_multi_fapl_t	*fa;
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
-    return H5FD_multi_fapl_copy(&(file->fa));
+    if(NULL == (fa = (H5FD_multi_fapl_t *)H5FD_multi_fapl_copy(&(file->fa))))
+        return NULL;
+
+    /* Take a snapshot of the member statistics */
+    ALL_MEMBERS(mt) {
+        memb_get_stats(file, mt, &fa->memb_stats[mt]);
+    } END_MEMBERS;
+
+    return fa;
 }
 
 
@@ -1029,6 +1252,7 @@ H5FD_multi_open(const char *name, unsigned flags, hid_t fapl_id,
 	    file->fa.memb_name[mt] = my_strdup(fa->memb_name[mt]);
 	else
 	    file->fa.memb_name[mt] = NULL;
+	file->fa.memb_async[mt] = fa->memb_async[mt];
     } END_MEMBERS;
     file->fa.relax = fa->relax;
     file->flags = flags;
@@ -1092,10 +1316,10 @@ H5FD_multi_close(H5FD_t *_file)
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
-    /* Close as many members as possible */
+    /* Close as many members as possible, once their queued writes are done */
     ALL_MEMBERS(mt) {
 	if (file->memb[mt]) {
-	    if (H5FDclose(file->memb[mt])<0) {
+	    if (memb_stop(file, mt)<0 || H5FDclose(file->memb[mt])<0) {
             nerrors++;
 	    } else {
             file->memb[mt] = NULL;
@@ -1417,7 +1641,7 @@ H5FD_multi_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t eoa)
 static haddr_t
 H5FD_multi_get_eof(const H5FD_t *_file, H5FD_mem_t type)
 {
-    const H5FD_multi_t	*file = (const H5FD_multi_t*)_file;
+    H5FD_multi_t	*file = (H5FD_multi_t*)_file;
     haddr_t		eof = 0;
     static const char *func="H5FD_multi_get_eof";  /* Function Name for error reporting */
 
@@ -1429,6 +1653,10 @@ H5FD_multi_get_eof(const H5FD_t *_file, H5FD_mem_t type)
             haddr_t tmp_eof;
 
             if(file->memb[mt]) {
+                /* Queued writes may still extend the member */
+                if(memb_sync(file, mt) < 0)
+                    H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "member file has unknown eof", HADDR_UNDEF)
+
                 /* Retrieve EOF */
                 H5E_BEGIN_TRY {
                     tmp_eof = H5FDget_eof(file->memb[mt], type);
@@ -1436,6 +1664,7 @@ H5FD_multi_get_eof(const H5FD_t *_file, H5FD_mem_t type)
 
                 if(HADDR_UNDEF == tmp_eof)
                     H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "member file has unknown eof", HADDR_UNDEF)
+                tmp_eof = memb_get_eof(file, mt, tmp_eof);
                 if(tmp_eof > 0)
                     tmp_eof += file->fa.memb_addr[mt];
             } else if(file->fa.relax) {
@@ -1458,6 +1687,10 @@ H5FD_multi_get_eof(const H5FD_t *_file, H5FD_mem_t type)
             mmt = type;
 
 	if(file->memb[mmt]) {
+            /* Queued writes may still extend the member */
+            if(memb_sync(file, mmt) < 0)
+                H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "member file has unknown eof", HADDR_UNDEF)
+
             /* Retrieve EOF */
             H5E_BEGIN_TRY {
 	        eof = H5FDget_eof(file->memb[mmt], mmt);
@@ -1465,6 +1698,7 @@ H5FD_multi_get_eof(const H5FD_t *_file, H5FD_mem_t type)
 
 	    if(HADDR_UNDEF == eof)
                 H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "member file has unknown eof", HADDR_UNDEF)
+            eof = memb_get_eof(file, mmt, eof);
 	    if(eof > 0)
                 eof += file->fa.memb_addr[mmt];
 	} else if(file->fa.relax) {
@@ -1509,6 +1743,10 @@ H5FD_multi_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
     mmt = file->fa.memb_map[type];
     if(H5FD_MEM_DEFAULT==mmt) mmt = type;
 
+    /* The caller may use the handle directly */
+    if(memb_sync(file, mmt) < 0)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_INTERNAL, H5E_BADVALUE, "can't finish queued writes", -1)
+
     return (H5FDget_vfd_handle(file->memb[mmt], fapl, file_handle));
 }
 
@@ -1624,6 +1862,8 @@ H5FD_multi_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     H5FD_multi_t	*file = (H5FD_multi_t*)_file;
     H5FD_mem_t		mt, mmt, hi = H5FD_MEM_DEFAULT;
     haddr_t		start_addr = 0;
+    double		start_time;
+    static const char *func="H5FD_multi_read";  /* Function Name for error reporting */
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
@@ -1644,8 +1884,17 @@ H5FD_multi_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     } /* end for */
     assert(hi > 0);
 
-    /* Read from that member */
-    return H5FDread(file->memb[hi], type, dxpl_id, addr - start_addr, size, _buf);
+    /* Read from that member, after any writes queued for it */
+    if(memb_sync(file, hi) < 0)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "can't finish queued writes", -1)
+    start_time = get_time();
+    if(H5FDread(file->memb[hi], type, dxpl_id, addr - start_addr, size, _buf) < 0)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_READERROR, "member file read failed", -1)
+    file->io[hi].stats.read_time += get_time() - start_time;
+    file->io[hi].stats.nreads++;
+    file->io[hi].stats.bytes_read += size;
+
+    return 0;
 } /* end H5FD_multi_read() */
 
 
@@ -1672,6 +1921,8 @@ H5FD_multi_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     H5FD_multi_t	*file = (H5FD_multi_t*)_file;
     H5FD_mem_t		mt, mmt, hi = H5FD_MEM_DEFAULT;
     haddr_t		start_addr = 0;
+    double		start_time;
+    static const char *func="H5FD_multi_write";  /* Function Name for error reporting */
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
@@ -1692,8 +1943,27 @@ H5FD_multi_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     } /* end for */
     assert(hi > 0);
 
+#ifdef H5FD_MULTI_USE_THREADS
+    /* Hand the write to the member's writer thread */
+    if(file->fa.memb_async[hi]) {
+        int status = memb_queue(file, hi, type, addr - start_addr, size, _buf);
+
+        if(status < 0)
+            H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "can't queue write to member file", -1)
+        if(0 == status)
+            return 0;
+    } /* end if */
+#endif /* H5FD_MULTI_USE_THREADS */
+
     /* Write to that member */
-    return H5FDwrite(file->memb[hi], type, dxpl_id, addr - start_addr, size, _buf);
+    start_time = get_time();
+    if(H5FDwrite(file->memb[hi], type, dxpl_id, addr - start_addr, size, _buf) < 0)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "member file write failed", -1)
+    file->io[hi].stats.write_time += get_time() - start_time;
+    file->io[hi].stats.nwrites++;
+    file->io[hi].stats.bytes_written += size;
+
+    return 0;
 } /* end H5FD_multi_write() */
 
 
@@ -1754,9 +2024,10 @@ H5FD_multi_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
-    /* Flush each file */
+    /* Flush each file, once its queued writes are done */
     for (mt=H5FD_MEM_SUPER; mt<H5FD_MEM_NTYPES; mt=(H5FD_mem_t)(mt+1)) {
 	if (file->memb[mt]) {
+	    if (memb_sync(file, mt)<0) nerrors++;
 	    H5E_BEGIN_TRY {
 		if (H5FDflush(file->memb[mt],dxpl_id,closing)<0) nerrors++;
 	    } H5E_END_TRY;
@@ -1796,9 +2067,13 @@ H5FD_multi_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
     /* Truncate each file */
     for(mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
 	if(file->memb[mt]) {
+	    if(memb_sync(file, mt) < 0)
+                nerrors++;
 	    H5E_BEGIN_TRY {
 		if(H5FDtruncate(file->memb[mt], dxpl_id, closing) < 0)
                     nerrors++;
+                else
+                    memb_truncated(file, mt);
 	    } H5E_END_TRY;
 	}
     }
@@ -1993,6 +2268,430 @@ open_members(H5FD_multi_t *file)
     return 0;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	get_multi_fapl
+ *
+ * Purpose:	Checks that FAPL_ID is a file access property list using
+ *		the multi driver and returns its driver information.
+ *
+ * Return:	Success:	Ptr to the driver information
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5FD_multi_fapl_t *
+get_multi_fapl(hid_t fapl_id, const char *func)
+{
+    const H5FD_multi_fapl_t *fa;
+
+    if(H5I_GENPROP_LST != H5Iget_type(fapl_id) ||
+            TRUE != H5Pisa_class(fapl_id, H5P_FILE_ACCESS))
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADTYPE, "not an access list", NULL)
+    if(H5FD_MULTI != H5Pget_driver(fapl_id))
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADVALUE, "incorrect VFL driver", NULL)
+    if(NULL == (fa = (const H5FD_multi_fapl_t *)H5Pget_driver_info(fapl_id)))
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_PLIST, H5E_BADVALUE, "bad VFL driver info", NULL)
+
+    return fa;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	get_time
+ *
+ * Purpose:	Returns the wall clock time in seconds, for the member
+ *		statistics.
+ *
+ * Return:	Seconds since some fixed time, or zero when the time is
+ *		not available.
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+get_time(void)
+{
+#ifdef H5_HAVE_GETTIMEOFDAY
+    struct timeval	tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+#else
+    return 0.0;
+#endif
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_get_stats
+ *
+ * Purpose:	Copies the I/O statistics of member MT into STATS.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+memb_get_stats(H5FD_multi_t *file, H5FD_mem_t mt, H5FD_multi_stats_t *stats/*out*/)
+{
+#ifdef H5FD_MULTI_USE_THREADS
+    H5FD_multi_io_t	*io = &file->io[mt];
+
+    if(io->running) {
+        pthread_mutex_lock(&io->mutex);
+        memcpy(stats, &io->stats, sizeof(H5FD_multi_stats_t));
+        pthread_mutex_unlock(&io->mutex);
+        return;
+    }
+#endif /* H5FD_MULTI_USE_THREADS */
+
+    memcpy(stats, &file->io[mt].stats, sizeof(H5FD_multi_stats_t));
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_sync
+ *
+ * Purpose:	Waits until all writes queued for member MT are done.  Any
+ *		other operation on an asynchronous member must call this
+ *		first, so that it sees the data written behind.  Queued
+ *		writes which failed since the last call are reported here,
+ *		since the writer thread can't push errors itself.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1, some queued write failed
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+memb_sync(H5FD_multi_t *file, H5FD_mem_t mt)
+{
+#ifdef H5FD_MULTI_USE_THREADS
+    H5FD_multi_io_t	*io = &file->io[mt];
+    int			nerrors, error;
+    haddr_t		err_addr;
+    static const char *func="(H5FD_multi)memb_sync";  /* Function Name for error reporting */
+
+    if(!io->running)
+        return 0;
+
+    pthread_mutex_lock(&io->mutex);
+    if(io->head || io->busy) {
+        double start_time = get_time();
+
+        while(io->head || io->busy)
+            pthread_cond_wait(&io->cond, &io->mutex);
+        io->stats.wait_time += get_time() - start_time;
+    }
+    nerrors = io->nerrors;
+    error = io->error;
+    err_addr = io->err_addr;
+    io->nerrors = 0;
+    io->error = 0;
+    pthread_mutex_unlock(&io->mutex);
+
+    if(nerrors) {
+        H5Epush2(H5E_DEFAULT, __FILE__, func, __LINE__, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR,
+                "%d queued write(s) to member file failed, first at addr = %llu, errno = %d, error message = '%s'",
+                nerrors, (unsigned long long)err_addr, error, strerror(error));
+        return -1;
+    } /* end if */
+#else /* H5FD_MULTI_USE_THREADS */
+    (void)file;
+    (void)mt;
+#endif /* H5FD_MULTI_USE_THREADS */
+
+    return 0;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_stop
+ *
+ * Purpose:	Waits for the writes queued for member MT and stops its
+ *		writer thread, which closes its descriptor, before the
+ *		member is closed.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1, some queued write failed.  The thread is
+ *				stopped regardless.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+memb_stop(H5FD_multi_t *file, H5FD_mem_t mt)
+{
+    int		ret_value = memb_sync(file, mt);
+#ifdef H5FD_MULTI_USE_THREADS
+    H5FD_multi_io_t	*io = &file->io[mt];
+
+    if(io->running) {
+        pthread_mutex_lock(&io->mutex);
+        io->shutdown = TRUE;
+        pthread_cond_broadcast(&io->cond);
+        pthread_mutex_unlock(&io->mutex);
+        pthread_join(io->thread, NULL);
+
+        pthread_cond_destroy(&io->cond);
+        pthread_mutex_destroy(&io->mutex);
+        io->running = FALSE;
+        io->fd = -1;
+    }
+#endif /* H5FD_MULTI_USE_THREADS */
+
+    return ret_value;
+}
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_get_eof
+ *
+ * Purpose:	Adjusts the end of file EOF reported by member MT for the
+ *		data written behind, which the member driver doesn't know
+ *		about.  The member must be synchronized.
+ *
+ * Return:	The member's end of file
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+memb_get_eof(H5FD_multi_t *file, H5FD_mem_t mt, haddr_t eof)
+{
+#ifdef H5FD_MULTI_USE_THREADS
+    H5FD_multi_io_t	*io = &file->io[mt];
+
+    if(io->running && io->end > eof)
+        eof = io->end;
+#else /* H5FD_MULTI_USE_THREADS */
+    (void)file;
+    (void)mt;
+#endif /* H5FD_MULTI_USE_THREADS */
+
+    return eof;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_truncated
+ *
+ * Purpose:	Forgets the end of the data written behind to member MT
+ *		once the member has been truncated, since the member's own
+ *		end of file is then current again.  The member must be
+ *		synchronized.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+memb_truncated(H5FD_multi_t *file, H5FD_mem_t mt)
+{
+#ifdef H5FD_MULTI_USE_THREADS
+    H5FD_multi_io_t	*io = &file->io[mt];
+
+    if(io->running) {
+        pthread_mutex_lock(&io->mutex);
+        io->end = 0;
+        pthread_mutex_unlock(&io->mutex);
+    }
+#else /* H5FD_MULTI_USE_THREADS */
+    (void)file;
+    (void)mt;
+#endif /* H5FD_MULTI_USE_THREADS */
+}
+
+#ifdef H5FD_MULTI_USE_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_writer
+ *
+ * Purpose:	Writer thread of an asynchronous member: performs the queued
+ *		writes in order until asked to stop, then closes its
+ *		descriptor.  Nothing here may call into the library, which
+ *		the thread that queued the writes may hold locked, so the
+ *		data is written with pwrite() and failures are only
+ *		recorded for memb_sync() to report.
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+memb_writer(void *_io)
+{
+    H5FD_multi_io_t	*io = (H5FD_multi_io_t *)_io;
+    H5FD_multi_req_t	*req;
+    unsigned char	*buf;
+    size_t		size;
+    off_t		offset;
+    ssize_t		nwritten;
+    double		start_time, elapsed;
+    int			error;
+
+    pthread_mutex_lock(&io->mutex);
+    for(;;) {
+        while(NULL == io->head && !io->shutdown)
+            pthread_cond_wait(&io->cond, &io->mutex);
+        if(NULL == (req = io->head))
+            break;
+        if(NULL == (io->head = req->next))
+            io->tail = NULL;
+        io->busy = TRUE;
+        pthread_mutex_unlock(&io->mutex);
+
+        /* Write the data, being careful of interrupted system calls and
+         * partial results */
+        start_time = get_time();
+        buf = req->buf;
+        size = req->size;
+        offset = (off_t)(req->addr + io->base_addr);
+        error = 0;
+        while(size > 0) {
+            do {
+                nwritten = pwrite(io->fd, buf, size, offset);
+            } while(-1 == nwritten && EINTR == errno);
+            if(-1 == nwritten) {
+                error = errno;
+                break;
+            }
+            if(0 == nwritten) {
+                error = EIO;
+                break;
+            }
+            size -= (size_t)nwritten;
+            offset += (off_t)nwritten;
+            buf += nwritten;
+        }
+        elapsed = get_time() - start_time;
+
+        pthread_mutex_lock(&io->mutex);
+        if(error) {
+            if(0 == io->nerrors++) {
+                io->error = error;
+                io->err_addr = req->addr;
+            }
+        }
+        else {
+            io->stats.nwrites++;
+            io->stats.bytes_written += req->size;
+            if(req->addr + req->size > io->end)
+                io->end = req->addr + req->size;
+        }
+        io->stats.write_time += elapsed;
+        io->queued -= req->size;
+        io->busy = FALSE;
+        pthread_cond_broadcast(&io->cond);
+        free(req);
+    }
+    pthread_mutex_unlock(&io->mutex);
+
+    close(io->fd);
+
+    return NULL;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	memb_queue
+ *
+ * Purpose:	Queues a copy of a write to asynchronous member MT, starting
+ *		its writer thread on first use.  Blocks while too much data
+ *		is already queued for the member.  Only a member using the
+ *		sec2 driver can be written behind; the writer thread gets a
+ *		duplicate of its file descriptor.
+ *
+ * Return:	Success:	0, the write was queued
+ *				1, the member must be written synchronously
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+memb_queue(H5FD_multi_t *file, H5FD_mem_t mt, H5FD_mem_t type, haddr_t addr,
+	   size_t size, const void *buf)
+{
+    H5FD_multi_io_t	*io = &file->io[mt];
+    H5FD_multi_req_t	*req;
+    haddr_t		eoa;
+    void		*handle = NULL;
+    static const char *func="(H5FD_multi)memb_queue";  /* Function Name for error reporting */
+
+    if(io->sync_only)
+        return 1;
+
+    /* Check the request here, since the writer thread can't report it */
+    if(HADDR_UNDEF == (eoa = H5FDget_eoa(file->memb[mt], type)))
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_WRITEERROR, "member file has unknown eoa", -1)
+    if(addr + size > eoa)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_ARGS, H5E_OVERFLOW, "addr overflow", -1)
+
+    /* Start the writer thread */
+    if(!io->running) {
+        if(file->memb[mt]->driver_id != H5FD_SEC2) {
+            io->sync_only = TRUE;
+            return 1;
+        }
+        if(H5FDget_vfd_handle(file->memb[mt], H5P_DEFAULT, &handle) < 0 || NULL == handle)
+            H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_CANTGET, "can't get member file descriptor", -1)
+        if((io->fd = dup(*(int *)handle)) < 0)
+            H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, H5E_CANTOPENFILE, "can't duplicate member file descriptor", -1)
+        io->base_addr = file->memb[mt]->base_addr;
+        io->busy = FALSE;
+        io->shutdown = FALSE;
+        io->nerrors = 0;
+        io->error = 0;
+        io->end = 0;
+        io->queued = 0;
+        io->head = io->tail = NULL;
+        if(0 != pthread_mutex_init(&io->mutex, NULL)) {
+            close(io->fd);
+            H5Epush_ret(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_CANTINIT, "can't initialize mutex", -1)
+        }
+        if(0 != pthread_cond_init(&io->cond, NULL)) {
+            pthread_mutex_destroy(&io->mutex);
+            close(io->fd);
+            H5Epush_ret(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_CANTINIT, "can't initialize condition variable", -1)
+        }
+        if(0 != pthread_create(&io->thread, NULL, memb_writer, io)) {
+            pthread_cond_destroy(&io->cond);
+            pthread_mutex_destroy(&io->mutex);
+            close(io->fd);
+            H5Epush_ret(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_CANTINIT, "can't create writer thread", -1)
+        }
+        io->running = TRUE;
+    }
+
+    /* Copy the data, since the caller may reuse its buffer on return */
+    if(NULL == (req = (H5FD_multi_req_t *)malloc(sizeof(H5FD_multi_req_t) + size)))
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "memory allocation failed", -1)
+    req->next = NULL;
+    req->type = type;
+    req->addr = addr;
+    req->size = size;
+    req->buf = (unsigned char *)(req + 1);
+    memcpy(req->buf, buf, size);
+
+    pthread_mutex_lock(&io->mutex);
+    while(io->queued > 0 && io->queued + size > H5FD_MULTI_MAX_QUEUED)
+        pthread_cond_wait(&io->cond, &io->mutex);
+    if(io->tail)
+        io->tail->next = req;
+    else
+        io->head = req;
+    io->tail = req;
+    io->queued += size;
+    pthread_cond_broadcast(&io->cond);
+    pthread_mutex_unlock(&io->mutex);
+
+    return 0;
+}
+#endif /* H5FD_MULTI_USE_THREADS */
+
 
 #ifdef _H5private_H
 /*
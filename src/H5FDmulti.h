@@ -22,6 +22,17 @@
 
 #define H5FD_MULTI	(H5FD_multi_init())
 
+/* I/O statistics kept for each member file */
+typedef struct H5FD_multi_stats_t {
+    hsize_t	nreads;			/*number of read requests		*/
+    hsize_t	nwrites;		/*number of write requests		*/
+    hsize_t	bytes_read;		/*bytes read from the member		*/
+    hsize_t	bytes_written;		/*bytes written to the member		*/
+    double	read_time;		/*seconds spent in member reads		*/
+    double	write_time;		/*seconds spent in member writes	*/
+    double	wait_time;		/*seconds spent waiting for queued writes*/
+} H5FD_multi_stats_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -35,6 +46,12 @@ H5_DLL herr_t H5Pget_fapl_multi(hid_t fapl_id, H5FD_mem_t *memb_map/*out*/,
 H5_DLL herr_t H5Pset_fapl_split(hid_t fapl, const char *meta_ext,
 			 hid_t meta_plist_id, const char *raw_ext,
 			 hid_t raw_plist_id);
+H5_DLL herr_t H5Pset_fapl_multi_async(hid_t fapl_id, H5FD_mem_t type,
+			 hbool_t async);
+H5_DLL herr_t H5Pget_fapl_multi_async(hid_t fapl_id, H5FD_mem_t type,
+			 hbool_t *async/*out*/);
+H5_DLL herr_t H5Pget_fapl_multi_stats(hid_t fapl_id, H5FD_mem_t type,
+			 H5FD_multi_stats_t *stats/*out*/);
 #ifdef __cplusplus
 }
 #endif
@@ -100,6 +100,7 @@ typedef struct {
 typedef struct H5FD_mpio_fapl_t {
     MPI_Comm		comm;		/*communicator			*/
     MPI_Info		info;		/*file information		*/
+    size_t		open_image_size; /*bytes broadcast at open	*/
 } H5FD_mpio_fapl_t;
 #endif /* H5_HAVE_PARALLEL */
 
@@ -196,6 +197,8 @@ H5_DLL herr_t H5FD_mpi_setup_collective(hid_t dxpl_id, MPI_Datatype *btype,
     MPI_Datatype *ftype);
 H5_DLL herr_t H5FD_set_mpio_atomicity(H5FD_t *file, hbool_t flag);
 H5_DLL herr_t H5FD_get_mpio_atomicity(H5FD_t *file, hbool_t *flag);
+H5_DLL herr_t H5FD_mpio_free_open_image(H5FD_t *_file);
+H5_DLL herr_t H5FD_get_mpio_stripe_size(const H5FD_t *file, hsize_t *stripe_size);
 
 /* Driver specific methods */
 H5_DLL int H5FD_mpi_get_rank(const H5FD_t *file);
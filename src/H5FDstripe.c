@@ -0,0 +1,1721 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	Implements a striped set of files that acts as a single hdf5
+ *		file, like RAID-0 across the member files.
+ *
+ *		The logical file is divided into stripe units of a fixed
+ *		size, which are placed round-robin across a fixed number of
+ *		member files: unit K is stored in member K % N, at offset
+ *		(K / N) * STRIPE_SIZE in that member.  The member names are
+ *		generated from a printf-style template (like the family
+ *		driver), so members can be put on different disks by using
+ *		a template such as "/disk%d/file.h5".
+ *
+ *		When an existing file is opened only the first member is
+ *		opened; the others are only checked for with stat() and are
+ *		opened the first time they are accessed.  A request spanning
+ *		several members is split into one request per member.
+ *
+ *		In thread-safe builds, large requests to members that use
+ *		the sec2 driver are performed concurrently by a pool of
+ *		worker threads, started for the file by the first such
+ *		request.  The workers never call into the library: they
+ *		only pread() and pwrite() the members' file descriptors,
+ *		while the thread that made the request, which holds the
+ *		library's lock, waits for them and reports any errors.  The
+ *		sec2 driver doesn't see these writes, so the end of the data
+ *		written to each member that way is kept here.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5FDsec2.h"           /* Sec2 file driver			*/
+#include "H5FDstripe.h"         /* Striped file driver 			*/
+#include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Pprivate.h"		/* Property lists			*/
+
+/* The size of the member name buffers */
+#define H5FD_STRIPE_MEMB_NAME_BUF_SIZE 4096
+
+/* Issue requests to the members concurrently, when threads are available */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5FD_STRIPE_USE_THREADS
+#endif
+
+#ifdef H5FD_STRIPE_USE_THREADS
+/* Forward declaration of the worker thread pool of a file */
+struct H5FD_stripe_pool_t;
+#endif /* H5FD_STRIPE_USE_THREADS */
+
+/* Minimum size of a request to be issued to the members concurrently */
+#define H5FD_STRIPE_THREAD_MIN_SIZE (1024 * 1024)
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_STRIPE_g = 0;
+
+/* The description of a file belonging to this driver. */
+typedef struct H5FD_stripe_t {
+    H5FD_t	pub;		/*public stuff, must be first		*/
+    hid_t	memb_fapl_id;	/*file access property list for members	*/
+    hsize_t	stripe_size;	/*size of each stripe unit		*/
+    unsigned	nmembs;		/*number of member files		*/
+    H5FD_t	**memb;		/*member files, NULL until opened	*/
+    hsize_t	*memb_size;	/*size of each member not opened yet	*/
+    haddr_t	eoa;		/*end of allocated addresses		*/
+    char	*name;		/*name generator printf format		*/
+    unsigned	flags;		/*flags for opening members		*/
+    hbool_t	locked;		/*whether the members should be locked	*/
+    hbool_t	lock_rw;	/*type of lock on the members		*/
+#ifdef H5FD_STRIPE_USE_THREADS
+    struct H5FD_stripe_pool_t *pool; /*worker threads, NULL until needed	*/
+    haddr_t	*raw_eof;	/*end of the data written to each member
+				  by the worker threads			*/
+#endif /* H5FD_STRIPE_USE_THREADS */
+} H5FD_stripe_t;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_stripe_fapl_t {
+    hsize_t	stripe_size;	/*size of each stripe unit		*/
+    unsigned	nmembs;		/*number of member files		*/
+    hid_t	memb_fapl_id;	/*file access property list of each memb*/
+} H5FD_stripe_fapl_t;
+
+/* The part of a request that goes to one member */
+typedef struct H5FD_stripe_io_t {
+    const H5FD_stripe_t *file;	/*striped file				*/
+    unsigned	u;		/*index of the member			*/
+    H5FD_io_info_t fdio_info;	/*I/O info for the member		*/
+    H5FD_mem_t	type;		/*type of memory being accessed		*/
+    haddr_t	addr;		/*logical address of the whole request	*/
+    size_t	size;		/*size of the whole request		*/
+    unsigned char *rbuf;	/*buffer for the whole read request	*/
+    const unsigned char *wbuf;	/*buffer for the whole write request	*/
+    herr_t	status;		/*result of the member's part		*/
+#ifdef H5FD_STRIPE_USE_THREADS
+    int		fd;		/*member's file descriptor, for workers	*/
+    int		err;		/*errno of a failed worker system call	*/
+    haddr_t	memb_end;	/*end of the data written to the member	*/
+#endif /* H5FD_STRIPE_USE_THREADS */
+} H5FD_stripe_io_t;
+
+#ifdef H5FD_STRIPE_USE_THREADS
+/* The worker thread pool of a file.  The thread making a request queues
+ * one job per member and works on the jobs too; the workers take the
+ * jobs in turn.
+ */
+typedef struct H5FD_stripe_pool_t {
+    pthread_mutex_t mutex;	/*protects the rest of the pool		*/
+    pthread_cond_t work_cond;	/*signaled when jobs are queued		*/
+    pthread_cond_t done_cond;	/*signaled when the last job is done	*/
+    H5FD_stripe_io_t *jobs;	/*jobs of the current request		*/
+    unsigned	njobs;		/*number of jobs of the current request	*/
+    unsigned	next;		/*next job to be taken			*/
+    unsigned	nleft;		/*number of jobs not finished		*/
+    hbool_t	shutdown;	/*whether the workers should exit	*/
+    unsigned	nthreads;	/*number of worker threads		*/
+    pthread_t	*threads;	/*worker threads			*/
+} H5FD_stripe_pool_t;
+#endif /* H5FD_STRIPE_USE_THREADS */
+
+/* Callback prototypes */
+static herr_t H5FD_stripe_term(void);
+static void *H5FD_stripe_fapl_get(H5FD_t *_file);
+static void *H5FD_stripe_fapl_copy(const void *_old_fa);
+static herr_t H5FD_stripe_fapl_free(void *_fa);
+static hsize_t H5FD_stripe_sb_size(H5FD_t *_file);
+static herr_t H5FD_stripe_sb_encode(H5FD_t *_file, char *name/*out*/,
+		     unsigned char *buf/*out*/);
+static herr_t H5FD_stripe_sb_decode(H5FD_t *_file, const char *name,
+                    const unsigned char *buf);
+static H5FD_t *H5FD_stripe_open(const char *name, unsigned flags,
+				hid_t fapl_id, haddr_t maxaddr);
+static herr_t H5FD_stripe_close(H5FD_t *_file);
+static int H5FD_stripe_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_stripe_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_stripe_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_stripe_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t eoa);
+static haddr_t H5FD_stripe_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_stripe_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_stripe_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+			       size_t size, void *_buf/*out*/);
+static herr_t H5FD_stripe_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+				size_t size, const void *_buf);
+static herr_t H5FD_stripe_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_stripe_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_stripe_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_stripe_unlock(H5FD_t *_file);
+
+/* Helper routines */
+static haddr_t H5FD__stripe_memb_eoa(const H5FD_stripe_t *file, unsigned u, haddr_t eoa);
+static herr_t H5FD__stripe_open_memb(H5FD_stripe_t *file, unsigned u);
+static herr_t H5FD__stripe_memb_io(H5FD_stripe_io_t *io);
+#ifdef H5FD_STRIPE_USE_THREADS
+static void H5FD__stripe_memb_rawio(H5FD_stripe_io_t *io);
+static void *H5FD__stripe_pool_worker(void *_pool);
+static herr_t H5FD__stripe_pool_start(H5FD_stripe_t *file);
+static herr_t H5FD__stripe_pool_stop(H5FD_stripe_t *file);
+static void H5FD__stripe_pool_run(H5FD_stripe_pool_t *pool, H5FD_stripe_io_t *jobs,
+    unsigned njobs);
+#endif /* H5FD_STRIPE_USE_THREADS */
+static herr_t H5FD__stripe_io(H5FD_stripe_t *file, H5FD_mem_t type, hid_t dxpl_id,
+    haddr_t addr, size_t size, void *rbuf, const void *wbuf);
+
+/* The class struct */
+static const H5FD_class_t H5FD_stripe_g = {
+    "stripe",					/*name			*/
+    HADDR_MAX,					/*maxaddr		*/
+    H5F_CLOSE_WEAK,				/*fc_degree		*/
+    H5FD_stripe_term,                           /*terminate             */
+    H5FD_stripe_sb_size,			/*sb_size		*/
+    H5FD_stripe_sb_encode,			/*sb_encode		*/
+    H5FD_stripe_sb_decode,			/*sb_decode		*/
+    sizeof(H5FD_stripe_fapl_t),			/*fapl_size		*/
+    H5FD_stripe_fapl_get,			/*fapl_get		*/
+    H5FD_stripe_fapl_copy,			/*fapl_copy		*/
+    H5FD_stripe_fapl_free,			/*fapl_free		*/
+    0,						/*dxpl_size		*/
+    NULL,					/*dxpl_copy		*/
+    NULL,					/*dxpl_free		*/
+    H5FD_stripe_open,				/*open			*/
+    H5FD_stripe_close,				/*close			*/
+    H5FD_stripe_cmp,				/*cmp			*/
+    H5FD_stripe_query,		                /*query			*/
+    NULL,					/*get_type_map		*/
+    NULL,					/*alloc			*/
+    NULL,					/*free			*/
+    H5FD_stripe_get_eoa,			/*get_eoa		*/
+    H5FD_stripe_set_eoa,			/*set_eoa		*/
+    H5FD_stripe_get_eof,			/*get_eof		*/
+    H5FD_stripe_get_handle,                     /*get_handle            */
+    H5FD_stripe_read,				/*read			*/
+    H5FD_stripe_write,				/*write			*/
+    H5FD_stripe_flush,				/*flush			*/
+    H5FD_stripe_truncate,			/*truncate		*/
+    H5FD_stripe_lock,                           /*lock                  */
+    H5FD_stripe_unlock,                         /*unlock                */
+    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+};
+
+
+/*--------------------------------------------------------------------------
+NAME
+   H5FD__init_package -- Initialize interface-specific information
+USAGE
+    herr_t H5FD__init_package()
+RETURNS
+    Non-negative on success/Negative on failure
+DESCRIPTION
+    Initializes any interface-specific data or routines.  (Just calls
+    H5FD_stripe_init currently).
+
+--------------------------------------------------------------------------*/
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_stripe_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize stripe VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_init
+ *
+ * Purpose:	Initialize this driver by registering the driver with the
+ *		library.
+ *
+ * Return:	Success:	The driver ID for the stripe driver.
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_stripe_init(void)
+{
+    hid_t ret_value = H5FD_STRIPE_g;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_STRIPE_g))
+        H5FD_STRIPE_g = H5FD_register(&H5FD_stripe_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_STRIPE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD_stripe_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:	H5FD_stripe_term
+ *
+ * Purpose:	Shut down the VFD
+ *
+ * Returns:     Non-negative on success or negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_STRIPE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_stripe_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_stripe
+ *
+ * Purpose:	Sets the file access property list FAPL_ID to use the stripe
+ *		driver.  The file is striped in units of STRIPE_SIZE bytes
+ *		across NMEMBS member files, whose names are generated from
+ *		the file name with printf.  MEMB_FAPL_ID is a file access
+ *		property list to be used for each member.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_stripe(hid_t fapl_id, hsize_t stripe_size, unsigned nmembs,
+    hid_t memb_fapl_id)
+{
+    H5FD_stripe_fapl_t	fa;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ihIui", fapl_id, stripe_size, nmembs, memb_fapl_id);
+
+    /* Check arguments */
+    if(TRUE != H5P_isa_class(fapl_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(0 == stripe_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size must be positive")
+    if(0 == nmembs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of members must be positive")
+    if(H5P_DEFAULT == memb_fapl_id)
+        memb_fapl_id = H5P_FILE_ACCESS_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(memb_fapl_id, H5P_FILE_ACCESS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+
+    /* Initialize driver specific information. */
+    fa.stripe_size = stripe_size;
+    fa.nmembs = nmembs;
+    fa.memb_fapl_id = memb_fapl_id;
+
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    ret_value = H5P_set_driver(plist, H5FD_STRIPE, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_stripe() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_stripe
+ *
+ * Purpose:	Returns information about the stripe file access property
+ *		list though the function arguments.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_stripe(hid_t fapl_id, hsize_t *stripe_size/*out*/, unsigned *nmembs/*out*/,
+    hid_t *memb_fapl_id/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_stripe_fapl_t	*fa;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, stripe_size, nmembs, memb_fapl_id);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_STRIPE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_stripe_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(stripe_size)
+        *stripe_size = fa->stripe_size;
+    if(nmembs)
+        *nmembs = fa->nmembs;
+    if(memb_fapl_id) {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(fa->memb_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+        *memb_fapl_id = H5P_copy_plist(plist, TRUE);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_stripe() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_fapl_get
+ *
+ * Purpose:	Gets a file access property list which could be used to
+ *		create an identical file.
+ *
+ * Return:	Success:	Ptr to new file access property list.
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_stripe_fapl_get(H5FD_t *_file)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    H5FD_stripe_fapl_t	*fa = NULL;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (fa = (H5FD_stripe_fapl_t *)H5MM_calloc(sizeof(H5FD_stripe_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    fa->stripe_size = file->stripe_size;
+    fa->nmembs = file->nmembs;
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(file->memb_fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    fa->memb_fapl_id = H5P_copy_plist(plist, FALSE);
+
+    /* Set return value */
+    ret_value = fa;
+
+done:
+    if(ret_value == NULL)
+        if(fa != NULL)
+            H5MM_xfree(fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_fapl_copy
+ *
+ * Purpose:	Copies the stripe-specific file access properties.
+ *
+ * Return:	Success:	Ptr to a new property list
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_stripe_fapl_copy(const void *_old_fa)
+{
+    const H5FD_stripe_fapl_t *old_fa = (const H5FD_stripe_fapl_t *)_old_fa;
+    H5FD_stripe_fapl_t *new_fa = NULL;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (new_fa = (H5FD_stripe_fapl_t *)H5MM_malloc(sizeof(H5FD_stripe_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the fields of the structure */
+    HDmemcpy(new_fa, old_fa, sizeof(H5FD_stripe_fapl_t));
+
+    /* Deep copy the property list objects in the structure */
+    if(old_fa->memb_fapl_id == H5P_FILE_ACCESS_DEFAULT) {
+        if(H5I_inc_ref(new_fa->memb_fapl_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINC, NULL, "unable to increment ref count on VFL driver")
+    } /* end if */
+    else {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(old_fa->memb_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+        new_fa->memb_fapl_id = H5P_copy_plist(plist, FALSE);
+    } /* end else */
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    if(ret_value == NULL)
+        if(new_fa != NULL)
+            H5MM_xfree(new_fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_fapl_free
+ *
+ * Purpose:	Frees the stripe-specific file access properties.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_fapl_free(void *_fa)
+{
+    H5FD_stripe_fapl_t	*fa = (H5FD_stripe_fapl_t *)_fa;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5I_dec_ref(fa->memb_fapl_id) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close driver ID")
+    H5MM_xfree(fa);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_fapl_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_sb_size
+ *
+ * Purpose:	Returns the size of the private information to be stored in
+ *		the superblock.
+ *
+ * Return:	Success:	The super block driver data size.
+ *
+ *		Failure:	never fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5FD_stripe_sb_size(H5FD_t H5_ATTR_UNUSED *_file)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* 8 bytes for the stripe size and 4 bytes for the number of members */
+    FUNC_LEAVE_NOAPI(12)
+} /* end H5FD_stripe_sb_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_sb_encode
+ *
+ * Purpose:	Encode driver information for the superblock. The NAME
+ *		argument is a nine-byte buffer which will be initialized with
+ *		an eight-character name/version number and null termination.
+ *
+ *		The encoding is the stripe size and the number of members,
+ *		which must not change while the file exists.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*/)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Name and version number */
+    HDstrncpy(name, "H5FDstrp", (size_t)9);
+    name[8] = '\0';
+
+    UINT64ENCODE(buf, (uint64_t)file->stripe_size);
+    UINT32ENCODE(buf, (uint32_t)file->nmembs);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_stripe_sb_encode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_sb_decode
+ *
+ * Purpose:	Decodes the superblock information for this driver, and
+ *		checks that the file is being opened with the same stripe
+ *		size and number of members it was created with.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_sb_decode(H5FD_t *_file, const char H5_ATTR_UNUSED *name, const unsigned char *buf)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    uint64_t            stripe_size;
+    uint32_t            nmembs;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    UINT64DECODE(buf, stripe_size);
+    UINT32DECODE(buf, nmembs);
+
+    if(stripe_size != (uint64_t)file->stripe_size)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "stripe size should be %llu.  But the size from file access property is %llu", (unsigned long long)stripe_size, (unsigned long long)file->stripe_size)
+    if(nmembs != (uint32_t)file->nmembs)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "number of stripe members should be %u.  But the number from file access property is %u", (unsigned)nmembs, file->nmembs)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_sb_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_memb_eoa
+ *
+ * Purpose:	Computes the part of the logical address space [0, EOA)
+ *		that is stored in member U.
+ *
+ * Return:	End of allocated addresses in the member
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__stripe_memb_eoa(const H5FD_stripe_t *file, unsigned u, haddr_t eoa)
+{
+    hsize_t     row_size = file->stripe_size * file->nmembs;    /* Size of one unit in every member */
+    haddr_t     memb_start = (haddr_t)u * file->stripe_size;    /* Start of member's unit in a row */
+    haddr_t     rem = eoa % row_size;                           /* Part of EOA in the last row */
+    haddr_t     ret_value;                                      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = (eoa / row_size) * file->stripe_size;
+    if(rem > memb_start)
+        ret_value += MIN(rem - memb_start, file->stripe_size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_memb_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_open_memb
+ *
+ * Purpose:	Opens member U of the file, if it isn't open yet, and sets
+ *		its EOA and lock to match the rest of the file.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_open_memb(H5FD_stripe_t *file, unsigned u)
+{
+    char	*memb_name = NULL;
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(u < file->nmembs);
+
+    if(file->memb[u])
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (memb_name = (char *)H5MM_malloc(H5FD_STRIPE_MEMB_NAME_BUF_SIZE)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate member name")
+    HDsnprintf(memb_name, H5FD_STRIPE_MEMB_NAME_BUF_SIZE, file->name, u);
+
+    if(NULL == (file->memb[u] = H5FD_open(memb_name, file->flags, file->memb_fapl_id, HADDR_UNDEF)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+
+    if(H5FD_set_eoa(file->memb[u], H5FD_MEM_DEFAULT, H5FD__stripe_memb_eoa(file, u, file->eoa)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to set member file eoa")
+    if(file->locked)
+        if(H5FD_lock(file->memb[u], file->lock_rw) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTLOCK, FAIL, "unable to lock member file")
+
+done:
+    if(memb_name)
+        H5MM_xfree(memb_name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_open_memb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_open
+ *
+ * Purpose:	Creates and/or opens a striped set of files as an HDF5 file.
+ *
+ *		When creating (or truncating) a file all members are
+ *		created.  When opening an existing file only the first
+ *		member is opened; the others only need to exist and are
+ *		opened on first access.
+ *
+ * Return:	Success:	A pointer to a new file data structure. The
+ *				public fields will be initialized by the
+ *				caller, which is always H5FD_open().
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_stripe_open(const char *name, unsigned flags, hid_t fapl_id,
+		 haddr_t maxaddr)
+{
+    H5FD_stripe_t	*file = NULL;
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    const H5FD_stripe_fapl_t *fa;
+    char		*memb_name = NULL, *temp = NULL;
+    hbool_t             create = (flags & (H5F_ACC_CREAT | H5F_ACC_TRUNC)) ? TRUE : FALSE;
+    unsigned		u;              /* Local index variable */
+    H5FD_t     		*ret_value = NULL;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_stripe_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Initialize file from file access properties */
+    if(NULL == (file = (H5FD_stripe_t *)H5MM_calloc(sizeof(H5FD_stripe_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->memb_fapl_id = -1;
+    if(fa->memb_fapl_id == H5P_FILE_ACCESS_DEFAULT) {
+        if(H5I_inc_ref(fa->memb_fapl_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINC, NULL, "unable to increment ref count on VFL driver")
+        file->memb_fapl_id = fa->memb_fapl_id;
+    } /* end if */
+    else {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(fa->memb_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+        file->memb_fapl_id = H5P_copy_plist(plist, FALSE);
+    } /* end else */
+    file->stripe_size = fa->stripe_size;
+    file->nmembs = fa->nmembs;
+    file->name = H5MM_strdup(name);
+    file->flags = flags;
+    if(NULL == (file->memb = (H5FD_t **)H5MM_calloc(file->nmembs * sizeof(H5FD_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate members")
+    if(NULL == (file->memb_size = (hsize_t *)H5MM_calloc(file->nmembs * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate member sizes")
+#ifdef H5FD_STRIPE_USE_THREADS
+    if(NULL == (file->raw_eof = (haddr_t *)H5MM_calloc(file->nmembs * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate member sizes")
+#endif /* H5FD_STRIPE_USE_THREADS */
+
+    /* Allocate space for the string buffers */
+    if(NULL == (memb_name = (char *)H5MM_malloc(H5FD_STRIPE_MEMB_NAME_BUF_SIZE)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "unable to allocate member name")
+    if(NULL == (temp = (char *)H5MM_malloc(H5FD_STRIPE_MEMB_NAME_BUF_SIZE)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, NULL, "unable to allocate temporary member name")
+
+    /* Check that names are unique */
+    if(file->nmembs > 1) {
+        HDsnprintf(memb_name, H5FD_STRIPE_MEMB_NAME_BUF_SIZE, name, 0);
+        HDsnprintf(temp, H5FD_STRIPE_MEMB_NAME_BUF_SIZE, name, 1);
+        if(!HDstrcmp(memb_name, temp))
+            HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, NULL, "file names not unique")
+    } /* end if */
+
+    /* Open the members.  Members of an existing file after the first one
+     * are only checked for, and are opened when first accessed.
+     */
+    for(u = 0; u < file->nmembs; u++) {
+        h5_stat_t sb;
+
+        if(!create && u > 0) {
+            HDsnprintf(memb_name, H5FD_STRIPE_MEMB_NAME_BUF_SIZE, name, u);
+            if(0 == HDstat(memb_name, &sb)) {
+                file->memb_size[u] = (hsize_t)sb.st_size;
+                continue;
+            } /* end if */
+
+            /* Not a plain file (the member driver may change the name),
+             * so find out by opening it.
+             */
+        } /* end if */
+
+        if(H5FD__stripe_open_memb(file, u) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open member file")
+    } /* end for */
+
+    ret_value = (H5FD_t *)file;
+
+done:
+    /* Release resources */
+    if(memb_name)
+        H5MM_xfree(memb_name);
+    if(temp)
+        H5MM_xfree(temp);
+
+    /* Cleanup and fail */
+    if(ret_value == NULL && file != NULL) {
+        if(file->memb)
+            for(u = 0; u < file->nmembs; u++)
+                if(file->memb[u])
+                    if(H5FD_close(file->memb[u]) < 0)
+                        HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, NULL, "unable to close member file")
+        H5MM_xfree(file->memb);
+        H5MM_xfree(file->memb_size);
+#ifdef H5FD_STRIPE_USE_THREADS
+        H5MM_xfree(file->raw_eof);
+#endif /* H5FD_STRIPE_USE_THREADS */
+        if(file->memb_fapl_id >= 0)
+            if(H5I_dec_ref(file->memb_fapl_id) < 0)
+                HDONE_ERROR(H5E_VFL, H5E_CANTDEC, NULL, "can't close driver ID")
+        H5MM_xfree(file->name);
+        H5MM_xfree(file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_close
+ *
+ * Purpose:	Closes a striped set of files.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative with as many members closed as
+ *				possible. The only subsequent operation
+ *				permitted on the file is a close operation.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_close(H5FD_t *_file)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+    unsigned	nerrors = 0;    /* Number of errors while closing member files */
+    unsigned	u;              /* Local index variable */
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+#ifdef H5FD_STRIPE_USE_THREADS
+    /* Stop the worker threads */
+    if(file->pool && H5FD__stripe_pool_stop(file) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to stop worker threads")
+#endif /* H5FD_STRIPE_USE_THREADS */
+
+    /* Close as many members as possible */
+    for(u = 0; u < file->nmembs; u++) {
+        if(file->memb[u]) {
+            if(H5FD_close(file->memb[u]) < 0)
+                nerrors++;
+            else
+                file->memb[u] = NULL;
+        } /* end if */
+    } /* end for */
+    if(nerrors)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close member files")
+
+    /* Clean up other stuff */
+    if(H5I_dec_ref(file->memb_fapl_id) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close driver ID")
+    H5MM_xfree(file->memb);
+    H5MM_xfree(file->memb_size);
+#ifdef H5FD_STRIPE_USE_THREADS
+    H5MM_xfree(file->raw_eof);
+#endif /* H5FD_STRIPE_USE_THREADS */
+    H5MM_xfree(file->name);
+    H5MM_xfree(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_cmp
+ *
+ * Purpose:	Compares two striped files to see if they are the same. It
+ *		does this by comparing the first member of the two files.
+ *
+ * Return:	Success:	like strcmp()
+ *
+ *		Failure:	never fails (arguments were checked by the
+ *				caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_stripe_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_stripe_t	*f1 = (const H5FD_stripe_t *)_f1;
+    const H5FD_stripe_t	*f2 = (const H5FD_stripe_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f1->memb[0]);
+    HDassert(f2->memb[0]);
+
+    ret_value = H5FD_cmp(f1->memb[0], f2->memb[0]);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_query
+ *
+ * Purpose:	Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_query(const H5FD_t H5_ATTR_UNUSED * _file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA; /* OK to aggregate metadata allocations */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes. */
+        *flags |= H5FD_FEAT_DATA_SIEVE;       /* OK to perform data sieving for faster raw data reads & writes */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_stripe_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_get_eoa
+ *
+ * Purpose:	Returns the end-of-address marker for the file. The EOA
+ *		marker is the first address past the last byte allocated in
+ *		the format address space.
+ *
+ * Return:	Success:	The end-of-address-marker
+ *
+ *		Failure:	HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_stripe_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_stripe_t	*file = (const H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_stripe_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_set_eoa
+ *
+ * Purpose:	Set the end-of-address marker for the file, and for each
+ *		open member the end of the part of that address space it
+ *		holds.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t eoa)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    unsigned		u;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    for(u = 0; u < file->nmembs; u++)
+        if(file->memb[u])
+            if(H5FD_set_eoa(file->memb[u], type, H5FD__stripe_memb_eoa(file, u, eoa)) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to set member file eoa")
+
+    file->eoa = eoa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_get_eof
+ *
+ * Purpose:	Returns the end-of-file marker: the first address past the
+ *		last byte stored in any of the members.  Members that have
+ *		not been opened yet are assumed to still have the size they
+ *		had when the file was opened.
+ *
+ * Return:	Success:	End of file address.
+ *
+ *		Failure:      	HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_stripe_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_stripe_t	*file = (const H5FD_stripe_t *)_file;
+    unsigned		u;              /* Local index variable */
+    haddr_t		ret_value = 0;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    for(u = 0; u < file->nmembs; u++) {
+        haddr_t memb_eof;       /* End of file in the member */
+
+        if(file->memb[u]) {
+            if(HADDR_UNDEF == (memb_eof = H5FD_get_eof(file->memb[u], type)))
+                HGOTO_DONE(HADDR_UNDEF)
+#ifdef H5FD_STRIPE_USE_THREADS
+            memb_eof = MAX(memb_eof, file->raw_eof[u]);
+#endif /* H5FD_STRIPE_USE_THREADS */
+        } /* end if */
+        else
+            memb_eof = (haddr_t)file->memb_size[u];
+
+        /* Convert the member's last byte to a logical address */
+        if(memb_eof > 0) {
+            hsize_t unit = (memb_eof - 1) / file->stripe_size;
+            haddr_t end = (unit * file->nmembs + u) * file->stripe_size
+                    + ((memb_eof - 1) % file->stripe_size) + 1;
+
+            ret_value = MAX(ret_value, end);
+        } /* end if */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_stripe_get_handle
+ *
+ * Purpose:        Returns the file handle of the member holding the
+ *                 logical address given by the family offset property.
+ *
+ * Returns:        Non-negative if succeed or negative if fails.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
+{
+    H5FD_stripe_t       *file = (H5FD_stripe_t *)_file;
+    H5P_genplist_t      *plist;
+    hsize_t             offset;
+    unsigned            u;
+    herr_t              ret_value = FAIL;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Get the plist structure and family offset */
+    if(NULL == (plist = H5P_object_verify(fapl, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+    if(H5P_get(plist, H5F_ACS_FAMILY_OFFSET_NAME, &offset) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get offset for stripe driver")
+
+    u = (unsigned)((offset / file->stripe_size) % file->nmembs);
+    if(H5FD__stripe_open_memb(file, u) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+
+    ret_value = H5FD_get_vfd_handle(file->memb[u], fapl, file_handle);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_memb_io
+ *
+ * Purpose:	Performs the part of a request that is stored in one
+ *		member: one member read or write per stripe unit, through
+ *		the member's driver.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_memb_io(H5FD_stripe_io_t *io)
+{
+    const H5FD_stripe_t *file = io->file;
+    haddr_t     end = io->addr + io->size;      /* End of the whole request */
+    hsize_t     unit;                           /* Stripe unit index */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Find the first unit of the request stored in this member */
+    unit = io->addr / file->stripe_size;
+    unit += (io->u + file->nmembs - (unsigned)(unit % file->nmembs)) % file->nmembs;
+
+    for(; unit * file->stripe_size < end; unit += file->nmembs) {
+        haddr_t seg_start = MAX(unit * file->stripe_size, io->addr);
+        haddr_t seg_end = MIN((unit + 1) * file->stripe_size, end);
+        haddr_t memb_addr = (unit / file->nmembs) * file->stripe_size
+                + (seg_start - unit * file->stripe_size);
+
+        if(io->wbuf) {
+            if(H5FD_write(&io->fdio_info, io->type, memb_addr, (size_t)(seg_end - seg_start), io->wbuf + (seg_start - io->addr)) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+        } /* end if */
+        else {
+            if(H5FD_read(&io->fdio_info, io->type, memb_addr, (size_t)(seg_end - seg_start), io->rbuf + (seg_start - io->addr)) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+        } /* end else */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_memb_io() */
+
+#ifdef H5FD_STRIPE_USE_THREADS
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_memb_rawio
+ *
+ * Purpose:	Performs the part of a request that is stored in one
+ *		member with pread() or pwrite() on the member's file
+ *		descriptor.  Runs on a worker thread without the library's
+ *		lock, so it makes no library calls: a failure is recorded
+ *		in IO->err, to be reported by the thread that made the
+ *		request.  Reads past the end of the member return zeros,
+ *		as with the sec2 driver.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_memb_rawio(H5FD_stripe_io_t *io)
+{
+    const H5FD_stripe_t *file = io->file;
+    haddr_t     end = io->addr + io->size;      /* End of the whole request */
+    hsize_t     unit;                           /* Stripe unit index */
+
+    /* Find the first unit of the request stored in this member */
+    unit = io->addr / file->stripe_size;
+    unit += (io->u + file->nmembs - (unsigned)(unit % file->nmembs)) % file->nmembs;
+
+    for(; unit * file->stripe_size < end; unit += file->nmembs) {
+        haddr_t seg_start = MAX(unit * file->stripe_size, io->addr);
+        haddr_t seg_end = MIN((unit + 1) * file->stripe_size, end);
+        haddr_t memb_addr = (unit / file->nmembs) * file->stripe_size
+                + (seg_start - unit * file->stripe_size);
+        size_t  left = (size_t)(seg_end - seg_start);   /* # of bytes left in the unit */
+        size_t  off = (size_t)(seg_start - io->addr);   /* Offset in the buffer */
+
+        while(left > 0) {
+            h5_posix_io_t       bytes_in;               /* # of bytes to transfer */
+            h5_posix_io_ret_t   bytes_done;             /* # of bytes transferred */
+
+            bytes_in = (h5_posix_io_t)MIN(left, (size_t)H5_POSIX_MAX_IO_BYTES);
+            do {
+                if(io->wbuf)
+                    bytes_done = HDpwrite(io->fd, io->wbuf + off, bytes_in, (HDoff_t)memb_addr);
+                else
+                    bytes_done = HDpread(io->fd, io->rbuf + off, bytes_in, (HDoff_t)memb_addr);
+            } while(-1 == bytes_done && EINTR == errno);
+
+            if(-1 == bytes_done) {
+                io->err = errno;
+                return;
+            } /* end if */
+            if(0 == bytes_done) {
+                if(io->wbuf) {
+                    io->err = EIO;
+                    return;
+                } /* end if */
+
+                /* End of the member but not end of the request */
+                HDmemset(io->rbuf + off, 0, left);
+                break;
+            } /* end if */
+
+            left -= (size_t)bytes_done;
+            off += (size_t)bytes_done;
+            memb_addr += (haddr_t)bytes_done;
+        } /* end while */
+
+        if(io->wbuf)
+            io->memb_end = MAX(io->memb_end, memb_addr);
+    } /* end for */
+} /* end H5FD__stripe_memb_rawio() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_pool_worker
+ *
+ * Purpose:	Thread start routine of a worker thread: takes the jobs of
+ *		each request in turn, until the pool is stopped.  Like the
+ *		jobs themselves, makes no library calls.
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_pool_worker(void *_pool)
+{
+    H5FD_stripe_pool_t *pool = (H5FD_stripe_pool_t *)_pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    for(;;) {
+        H5FD_stripe_io_t *io;
+
+        while(!pool->shutdown && pool->next >= pool->njobs)
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        if(pool->shutdown)
+            break;
+
+        io = &pool->jobs[pool->next++];
+        pthread_mutex_unlock(&pool->mutex);
+        H5FD__stripe_memb_rawio(io);
+        pthread_mutex_lock(&pool->mutex);
+
+        if(0 == --pool->nleft)
+            pthread_cond_signal(&pool->done_cond);
+    } /* end for */
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+} /* end H5FD__stripe_pool_worker() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_pool_start
+ *
+ * Purpose:	Starts the worker threads of a file, one fewer than the
+ *		number of members, since the thread making a request works
+ *		on its jobs too.  If no thread can be started, the file has
+ *		no pool and requests are performed serially.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_pool_start(H5FD_stripe_t *file)
+{
+    H5FD_stripe_pool_t *pool = NULL;            /* New pool */
+    unsigned    u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(NULL == file->pool);
+    HDassert(file->nmembs > 1);
+
+    if(NULL == (pool = (H5FD_stripe_pool_t *)H5MM_calloc(sizeof(H5FD_stripe_pool_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate thread pool")
+    if(NULL == (pool->threads = (pthread_t *)H5MM_malloc((file->nmembs - 1) * sizeof(pthread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate threads")
+    if(0 != pthread_mutex_init(&pool->mutex, NULL))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize mutex")
+    if(0 != pthread_cond_init(&pool->work_cond, NULL) || 0 != pthread_cond_init(&pool->done_cond, NULL))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize condition variable")
+
+    for(u = 0; u < file->nmembs - 1; u++) {
+        if(0 != pthread_create(&pool->threads[pool->nthreads], NULL, H5FD__stripe_pool_worker, pool))
+            break;
+        pool->nthreads++;
+    } /* end for */
+
+    /* Keep the pool if any thread was started */
+    if(pool->nthreads > 0) {
+        file->pool = pool;
+        pool = NULL;
+    } /* end if */
+    else {
+        pthread_cond_destroy(&pool->done_cond);
+        pthread_cond_destroy(&pool->work_cond);
+        pthread_mutex_destroy(&pool->mutex);
+    } /* end else */
+
+done:
+    if(pool) {
+        H5MM_xfree(pool->threads);
+        H5MM_xfree(pool);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_pool_start() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_pool_stop
+ *
+ * Purpose:	Stops the worker threads of a file and frees the pool.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_pool_stop(H5FD_stripe_t *file)
+{
+    H5FD_stripe_pool_t *pool = file->pool;
+    unsigned    u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(pool);
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->shutdown = TRUE;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for(u = 0; u < pool->nthreads; u++)
+        if(0 != pthread_join(pool->threads[u], NULL))
+            HDONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to join worker thread")
+
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->mutex);
+    H5MM_xfree(pool->threads);
+    file->pool = (H5FD_stripe_pool_t *)H5MM_xfree(pool);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_pool_stop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_pool_run
+ *
+ * Purpose:	Hands the jobs of a request to the worker threads, works on
+ *		them too, and waits until all of them are done.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_pool_run(H5FD_stripe_pool_t *pool, H5FD_stripe_io_t *jobs,
+    unsigned njobs)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(pool);
+    HDassert(jobs);
+    HDassert(njobs > 0);
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->jobs = jobs;
+    pool->njobs = njobs;
+    pool->next = 0;
+    pool->nleft = njobs;
+    pthread_cond_broadcast(&pool->work_cond);
+
+    while(pool->next < pool->njobs) {
+        H5FD_stripe_io_t *io = &pool->jobs[pool->next++];
+
+        pthread_mutex_unlock(&pool->mutex);
+        H5FD__stripe_memb_rawio(io);
+        pthread_mutex_lock(&pool->mutex);
+        --pool->nleft;
+    } /* end while */
+
+    while(pool->nleft > 0)
+        pthread_cond_wait(&pool->done_cond, &pool->mutex);
+    pool->jobs = NULL;
+    pool->njobs = 0;
+    pool->next = 0;
+    pthread_mutex_unlock(&pool->mutex);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__stripe_pool_run() */
+#endif /* H5FD_STRIPE_USE_THREADS */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__stripe_io
+ *
+ * Purpose:	Splits a read (into RBUF) or write (from WBUF) request into
+ *		one request per member
+ *		touched, opening the members as needed, and performs them.
+ *		Large requests touching several sec2 members are performed
+ *		concurrently by the file's worker threads, when threads are
+ *		available.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_io(H5FD_stripe_t *file, H5FD_mem_t type, hid_t dxpl_id,
+    haddr_t addr, size_t size, void *rbuf, const void *wbuf)
+{
+    H5FD_stripe_io_t *io = NULL;                /* Per-member requests */
+    H5P_genplist_t *plist;                      /* Property list pointer */
+    hsize_t     first_unit, last_unit;          /* Stripe units touched */
+    unsigned    nio;                            /* # of members touched */
+#ifdef H5FD_STRIPE_USE_THREADS
+    hbool_t     use_pool;                       /* Whether the worker threads perform the request */
+#endif /* H5FD_STRIPE_USE_THREADS */
+    unsigned    u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    first_unit = addr / file->stripe_size;
+    last_unit = (addr + size - 1) / file->stripe_size;
+    nio = (last_unit - first_unit + 1 >= file->nmembs) ? file->nmembs : (unsigned)(last_unit - first_unit + 1);
+
+    if(NULL == (io = (H5FD_stripe_io_t *)H5MM_calloc(nio * sizeof(H5FD_stripe_io_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate member requests")
+#ifdef H5FD_STRIPE_USE_THREADS
+    use_pool = (nio > 1 && size >= H5FD_STRIPE_THREAD_MIN_SIZE);
+#endif /* H5FD_STRIPE_USE_THREADS */
+
+    /* Set up the request for each member touched, opening it if necessary */
+    for(u = 0; u < nio; u++) {
+        unsigned memb = (unsigned)((first_unit + u) % file->nmembs);
+
+        if(H5FD__stripe_open_memb(file, memb) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open member file")
+
+        io[u].file = file;
+        io[u].u = memb;
+        io[u].fdio_info.file = file->memb[memb];
+        io[u].fdio_info.meta_dxpl = plist;
+        io[u].fdio_info.raw_dxpl = plist;
+        io[u].type = type;
+        io[u].addr = addr;
+        io[u].size = size;
+        io[u].rbuf = (unsigned char *)rbuf;
+        io[u].wbuf = (const unsigned char *)wbuf;
+
+#ifdef H5FD_STRIPE_USE_THREADS
+        /* The worker threads can only perform requests to sec2 members,
+         * through their file descriptors
+         */
+        if(use_pool) {
+            void *fd_ptr;           /* Pointer to the member's file descriptor */
+
+            if(H5FD_SEC2 != file->memb[memb]->driver_id)
+                use_pool = FALSE;
+            else {
+                if(H5FD_get_vfd_handle(file->memb[memb], file->memb_fapl_id, &fd_ptr) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get member file descriptor")
+                io[u].fd = *(int *)fd_ptr;
+            } /* end else */
+        } /* end if */
+#endif /* H5FD_STRIPE_USE_THREADS */
+    } /* end for */
+
+#ifdef H5FD_STRIPE_USE_THREADS
+    /* Start the worker threads with the first request that needs them */
+    if(use_pool && NULL == file->pool)
+        if(H5FD__stripe_pool_start(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to start worker threads")
+
+    if(use_pool && file->pool) {
+        H5FD__stripe_pool_run(file->pool, io, nio);
+
+        /* Report the failures of the worker threads */
+        for(u = 0; u < nio; u++) {
+            if(io[u].err) {
+                io[u].status = FAIL;
+                HERROR(H5E_IO, wbuf ? H5E_WRITEERROR : H5E_READERROR, "member file %s failed: member = %u, errno = %d, error message = '%s'", wbuf ? "write" : "read", io[u].u, io[u].err, HDstrerror(io[u].err));
+            } /* end if */
+            else if(wbuf)
+                file->raw_eof[io[u].u] = MAX(file->raw_eof[io[u].u], io[u].memb_end);
+        } /* end for */
+    } /* end if */
+    else
+#endif /* H5FD_STRIPE_USE_THREADS */
+    for(u = 0; u < nio; u++)
+        io[u].status = H5FD__stripe_memb_io(&io[u]);
+
+    for(u = 0; u < nio; u++)
+        if(io[u].status < 0)
+            HGOTO_ERROR(H5E_IO, wbuf ? H5E_WRITEERROR : H5E_READERROR, FAIL, "member file I/O failed")
+
+done:
+    if(io)
+        H5MM_xfree(io);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_read
+ *
+ * Purpose:	Reads SIZE bytes of data from FILE beginning at address ADDR
+ *		into buffer BUF according to data transfer properties in
+ *		DXPL_ID.
+ *
+ * Return:	Success:	Zero. Result is stored in caller-supplied
+ *				buffer BUF.
+ *
+ *		Failure:	-1, contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+		 void *_buf/*out*/)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    herr_t              ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD__stripe_io(file, type, dxpl_id, addr, size, _buf, NULL) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "stripe read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_write
+ *
+ * Purpose:	Writes SIZE bytes of data to FILE beginning at address ADDR
+ *		from buffer BUF according to data transfer properties in
+ *		DXPL_ID.
+ *
+ * Return:	Success:	Zero
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+		  const void *_buf)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    herr_t              ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD__stripe_io(file, type, dxpl_id, addr, size, NULL, _buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "stripe write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_flush
+ *
+ * Purpose:	Flushes all open members.
+ *
+ * Return:	Success:	0
+ *		Failure:	-1, as many files flushed as possible.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    unsigned		u, nerrors = 0;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    for(u = 0; u < file->nmembs; u++)
+        if(file->memb[u] && H5FD_flush(file->memb[u], dxpl_id, closing) < 0)
+            nerrors++;
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to flush member files")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_stripe_truncate
+ *
+ * Purpose:	Truncates all members to their part of the EOA.  Members
+ *		not opened yet are only opened if their size must change.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1, as many files truncated as possible.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
+{
+    H5FD_stripe_t	*file = (H5FD_stripe_t *)_file;
+    unsigned		u, nerrors = 0;
+    herr_t      	ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    for(u = 0; u < file->nmembs; u++) {
+        if(!file->memb[u] && (haddr_t)file->memb_size[u] != H5FD__stripe_memb_eoa(file, u, file->eoa))
+            if(H5FD__stripe_open_memb(file, u) < 0) {
+                nerrors++;
+                continue;
+            } /* end if */
+        if(file->memb[u]) {
+            if(H5FD_truncate(file->memb[u], dxpl_id, closing) < 0)
+                nerrors++;
+#ifdef H5FD_STRIPE_USE_THREADS
+            /* The member's end of file is its end of allocation now */
+            else
+                file->raw_eof[u] = 0;
+#endif /* H5FD_STRIPE_USE_THREADS */
+        } /* end if */
+    } /* end for */
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_BADVALUE, FAIL, "unable to truncate member files")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_stripe_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *              The lock type to apply depends on the parameter "rw":
+ *                      TRUE--opens for write: an exclusive lock
+ *                      FALSE--opens for read: a shared lock
+ *
+ *              Members opened later are locked when they are opened.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;   /* VFD file struct */
+    unsigned u;                         /* Local index variable */
+    herr_t ret_value = SUCCEED;	        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Place the lock on all the open member files */
+    for(u = 0; u < file->nmembs; u++)
+        if(file->memb[u])
+            if(H5FD_lock(file->memb[u], rw) < 0)
+                break;
+
+    /* If one of the locks failed, try to unlock the locked member files
+     * in an attempt to return to a fully unlocked state.
+     */
+    if(u < file->nmembs) {
+        unsigned v;                         /* Local index variable */
+
+        for(v = 0; v < u; v++)
+            if(file->memb[v])
+                if(H5FD_unlock(file->memb[v]) < 0)
+                    /* Push error, but keep going */
+                    HDONE_ERROR(H5E_IO, H5E_CANTUNLOCK, FAIL, "unable to unlock member files")
+        HGOTO_ERROR(H5E_IO, H5E_CANTLOCK, FAIL, "unable to lock member files")
+    } /* end if */
+
+    file->locked = TRUE;
+    file->lock_rw = rw;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_stripe_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_stripe_unlock(H5FD_t *_file)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;   	/* VFD file struct */
+    unsigned	u;                                      /* Local index variable */
+    herr_t ret_value = SUCCEED;                         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Remove the lock on the open member files */
+    for(u = 0; u < file->nmembs; u++)
+        if(file->memb[u])
+            if(H5FD_unlock(file->memb[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTUNLOCK, FAIL, "unable to unlock member files")
+
+    file->locked = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_unlock() */
+
@@ -0,0 +1,36 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the striped file driver.
+ */
+#ifndef H5FDstripe_H
+#define H5FDstripe_H
+
+#define H5FD_STRIPE	(H5FD_stripe_init())
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t H5FD_stripe_init(void);
+H5_DLL herr_t H5Pset_fapl_stripe(hid_t fapl_id, hsize_t stripe_size,
+			  unsigned nmembs, hid_t memb_fapl_id);
+H5_DLL herr_t H5Pget_fapl_stripe(hid_t fapl_id, hsize_t *stripe_size/*out*/,
+			  unsigned *nmembs/*out*/, hid_t *memb_fapl_id/*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
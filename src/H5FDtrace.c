@@ -0,0 +1,1078 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	A driver which passes all I/O through to another driver and
+ *		records each operation in a compact binary trace file.
+ *
+ *		Each read, write, flush and truncate is recorded as a
+ *		fixed-size record holding its start time, latency, memory
+ *		type, address and size (see H5FDtrace.h for the layout).
+ *		Records are collected in a fixed-size buffer and written to
+ *		the trace file whenever the buffer fills, and when the file
+ *		is flushed or closed, so the cost per operation is a few
+ *		stores and the memory used doesn't depend on the file size.
+ *
+ *		Each buffer is written as one block, behind a header that
+ *		identifies the session, and appended to the trace file
+ *		(which is created if it doesn't exist), so the traces of
+ *		earlier sessions, and of other processes tracing the same
+ *		file, are kept.  The h5iotrace tool summarizes and replays
+ *		traces.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5FDtrace.h"          /* Trace file driver 			*/
+#include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Pprivate.h"		/* Property lists			*/
+
+/* Suffix added to the file name for the default trace file name */
+#define H5FD_TRACE_SUFFIX       ".trace"
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_TRACE_g = 0;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_trace_fapl_t {
+    char	*trace_file;	/*trace file name, NULL for default	*/
+    size_t	nrecords;	/*number of records buffered		*/
+    hid_t	under_fapl_id;	/*file access property list of the file	*/
+} H5FD_trace_fapl_t;
+
+/* The description of a file belonging to this driver. */
+typedef struct H5FD_trace_t {
+    H5FD_t	pub;		/*public stuff, must be first		*/
+    H5FD_t	*under;		/*the file being traced			*/
+    H5FD_trace_fapl_t *fa;	/*driver-specific file access properties*/
+    char	*trace_name;	/*name of the trace file		*/
+    int		fd;		/*trace file, -1 until first written	*/
+    uint8_t	*rec_buf;	/*block header and buffered, encoded
+				  records				*/
+    size_t	nrecords;	/*number of records in the buffer	*/
+    uint64_t	t0;		/*time the file was opened (ns)		*/
+    uint64_t	session;	/*time the file was opened (ns since the
+				  Epoch)				*/
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_simple_t lock;	/*protects the buffer			*/
+#endif /* H5_HAVE_THREADSAFE */
+} H5FD_trace_t;
+
+/* Callback prototypes */
+static herr_t H5FD_trace_term(void);
+static void *H5FD_trace_fapl_get(H5FD_t *_file);
+static void *H5FD_trace_fapl_copy(const void *_old_fa);
+static herr_t H5FD_trace_fapl_free(void *_fa);
+static H5FD_t *H5FD_trace_open(const char *name, unsigned flags,
+				hid_t fapl_id, haddr_t maxaddr);
+static herr_t H5FD_trace_close(H5FD_t *_file);
+static int H5FD_trace_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_trace_query(const H5FD_t *_f1, unsigned long *flags);
+static herr_t H5FD_trace_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map);
+static haddr_t H5FD_trace_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_trace_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t eoa);
+static haddr_t H5FD_trace_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_trace_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_trace_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+			       size_t size, void *_buf/*out*/);
+static herr_t H5FD_trace_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+				size_t size, const void *_buf);
+static herr_t H5FD_trace_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_trace_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_trace_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_trace_unlock(H5FD_t *_file);
+
+/* Helper routines */
+static uint64_t H5FD__trace_now(void);
+static herr_t H5FD__trace_write_records(H5FD_trace_t *file);
+static herr_t H5FD__trace_record(H5FD_trace_t *file, unsigned op, H5FD_mem_t type,
+    haddr_t addr, hsize_t size, uint64_t start, uint64_t end);
+
+/* The class struct */
+static const H5FD_class_t H5FD_trace_g = {
+    "trace",					/*name			*/
+    HADDR_MAX,					/*maxaddr		*/
+    H5F_CLOSE_WEAK,				/*fc_degree		*/
+    H5FD_trace_term,                            /*terminate             */
+    NULL,					/*sb_size		*/
+    NULL,					/*sb_encode		*/
+    NULL,					/*sb_decode		*/
+    sizeof(H5FD_trace_fapl_t),			/*fapl_size		*/
+    H5FD_trace_fapl_get,			/*fapl_get		*/
+    H5FD_trace_fapl_copy,			/*fapl_copy		*/
+    H5FD_trace_fapl_free,			/*fapl_free		*/
+    0,						/*dxpl_size		*/
+    NULL,					/*dxpl_copy		*/
+    NULL,					/*dxpl_free		*/
+    H5FD_trace_open,				/*open			*/
+    H5FD_trace_close,				/*close			*/
+    H5FD_trace_cmp,				/*cmp			*/
+    H5FD_trace_query,		                /*query			*/
+    H5FD_trace_get_type_map,			/*get_type_map		*/
+    NULL,					/*alloc			*/
+    NULL,					/*free			*/
+    H5FD_trace_get_eoa,				/*get_eoa		*/
+    H5FD_trace_set_eoa,				/*set_eoa		*/
+    H5FD_trace_get_eof,				/*get_eof		*/
+    H5FD_trace_get_handle,                      /*get_handle            */
+    H5FD_trace_read,				/*read			*/
+    H5FD_trace_write,				/*write			*/
+    H5FD_trace_flush,				/*flush			*/
+    H5FD_trace_truncate,			/*truncate		*/
+    H5FD_trace_lock,                            /*lock                  */
+    H5FD_trace_unlock,                          /*unlock                */
+    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+};
+
+
+/*--------------------------------------------------------------------------
+NAME
+   H5FD__init_package -- Initialize interface-specific information
+USAGE
+    herr_t H5FD__init_package()
+RETURNS
+    Non-negative on success/Negative on failure
+DESCRIPTION
+    Initializes any interface-specific data or routines.  (Just calls
+    H5FD_trace_init currently).
+
+--------------------------------------------------------------------------*/
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_trace_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize trace VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_init
+ *
+ * Purpose:	Initialize this driver by registering the driver with the
+ *		library.
+ *
+ * Return:	Success:	The driver ID for the trace driver.
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_trace_init(void)
+{
+    hid_t ret_value = H5FD_TRACE_g;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_TRACE_g))
+        H5FD_TRACE_g = H5FD_register(&H5FD_trace_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_TRACE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD_trace_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:	H5FD_trace_term
+ *
+ * Purpose:	Shut down the VFD
+ *
+ * Returns:     Non-negative on success or negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_TRACE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_trace_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_trace
+ *
+ * Purpose:	Sets the file access property list FAPL_ID to use the trace
+ *		driver.  The file itself is accessed with UNDER_FAPL_ID, and
+ *		its I/O operations are appended to TRACE_FILE (or the file
+ *		name with ".trace" appended, if TRACE_FILE is NULL).
+ *		NRECORDS records are buffered between writes to the trace
+ *		file; zero selects H5FD_TRACE_DEFAULT_NRECORDS.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_trace(hid_t fapl_id, const char *trace_file, size_t nrecords,
+    hid_t under_fapl_id)
+{
+    H5FD_trace_fapl_t	fa;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "i*szi", fapl_id, trace_file, nrecords, under_fapl_id);
+
+    /* Check arguments */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(H5P_DEFAULT == under_fapl_id)
+        under_fapl_id = H5P_FILE_ACCESS_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(under_fapl_id, H5P_FILE_ACCESS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+
+    /* This shallow copy is correct! The string will be properly
+     * copied deep down in the H5P code.
+     */
+    fa.trace_file = (char *)trace_file;
+    fa.nrecords = nrecords ? nrecords : H5FD_TRACE_DEFAULT_NRECORDS;
+    fa.under_fapl_id = under_fapl_id;
+
+    ret_value = H5P_set_driver(plist, H5FD_TRACE, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_fapl_get
+ *
+ * Purpose:	Gets a file access property list which could be used to
+ *		create an identical file.
+ *
+ * Return:	Success:	Ptr to new file access property list.
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_trace_fapl_get(H5FD_t *_file)
+{
+    H5FD_trace_t	*file = (H5FD_trace_t *)_file;
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set return value */
+    ret_value = H5FD_trace_fapl_copy(file->fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_fapl_copy
+ *
+ * Purpose:	Copies the trace-specific file access properties.
+ *
+ * Return:	Success:	Ptr to a new property list
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_trace_fapl_copy(const void *_old_fa)
+{
+    const H5FD_trace_fapl_t *old_fa = (const H5FD_trace_fapl_t *)_old_fa;
+    H5FD_trace_fapl_t *new_fa = NULL;
+    H5P_genplist_t *plist;      /* Property list pointer */
+    void *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (new_fa = (H5FD_trace_fapl_t *)H5MM_calloc(sizeof(H5FD_trace_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the fields of the structure */
+    new_fa->nrecords = old_fa->nrecords;
+    new_fa->under_fapl_id = -1;
+
+    /* Deep copy the trace file name and the property list */
+    if(old_fa->trace_file != NULL)
+        if(NULL == (new_fa->trace_file = H5MM_strdup(old_fa->trace_file)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate trace file name")
+    if(old_fa->under_fapl_id == H5P_FILE_ACCESS_DEFAULT) {
+        if(H5I_inc_ref(old_fa->under_fapl_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINC, NULL, "unable to increment ref count on VFL driver")
+        new_fa->under_fapl_id = old_fa->under_fapl_id;
+    } /* end if */
+    else {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(old_fa->under_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+        if((new_fa->under_fapl_id = H5P_copy_plist(plist, FALSE)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL, "unable to copy file access property list")
+    } /* end else */
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    if(ret_value == NULL)
+        if(new_fa != NULL) {
+            H5MM_xfree(new_fa->trace_file);
+            H5MM_xfree(new_fa);
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_fapl_free
+ *
+ * Purpose:	Frees the trace-specific file access properties.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_fapl_free(void *_fa)
+{
+    H5FD_trace_fapl_t	*fa = (H5FD_trace_fapl_t *)_fa;
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5I_dec_ref(fa->under_fapl_id) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTDEC, FAIL, "can't close driver ID")
+    H5MM_xfree(fa->trace_file);
+    H5MM_xfree(fa);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_fapl_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__trace_now
+ *
+ * Purpose:	Returns the current time, in nanoseconds from an arbitrary
+ *		origin.
+ *
+ * Return:	The time
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5FD__trace_now(void)
+{
+    uint64_t    ret_value;      /* Return value */
+#ifdef H5_HAVE_CLOCK_GETTIME
+    struct timespec ts;
+#else /* H5_HAVE_CLOCK_GETTIME */
+    struct timeval tv;
+#endif /* H5_HAVE_CLOCK_GETTIME */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_CLOCK_GETTIME
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ret_value = (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+#else /* H5_HAVE_CLOCK_GETTIME */
+    HDgettimeofday(&tv, NULL);
+    ret_value = (uint64_t)tv.tv_sec * 1000000000 + (uint64_t)tv.tv_usec * 1000;
+#endif /* H5_HAVE_CLOCK_GETTIME */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__trace_now() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__trace_write_records
+ *
+ * Purpose:	Appends the buffered records to the trace file as a block,
+ *		opening the file (and creating it, if necessary) the first
+ *		time.
+ *
+ *		The caller must hold the buffer lock.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__trace_write_records(H5FD_trace_t *file)
+{
+    const uint8_t *p;                   /* Pointer into the records */
+    size_t      nbytes;                 /* Bytes left to write */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(0 == file->nrecords)
+        HGOTO_DONE(SUCCEED)
+
+    /* Open the trace file for appending */
+    if(file->fd < 0)
+        if((file->fd = HDopen(file->trace_name, O_WRONLY | O_CREAT | O_APPEND, 0666)) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open trace file")
+
+    /* Fill in the block header in front of the records */
+    {
+        uint8_t *q = file->rec_buf;
+
+        HDmemcpy(q, H5FD_TRACE_MAGIC, (size_t)8);
+        q += 8;
+        UINT32ENCODE(q, H5FD_TRACE_VERSION);
+        UINT32ENCODE(q, H5FD_TRACE_RECORD_SIZE);
+        UINT64ENCODE(q, file->session);
+        UINT32ENCODE(q, (uint32_t)HDgetpid());
+        UINT32ENCODE(q, (uint32_t)file->nrecords);
+    }
+
+    /* Write the block with as few writes as possible, so that blocks
+     * appended by other processes at the same time aren't interleaved
+     * with it
+     */
+    p = file->rec_buf;
+    nbytes = H5FD_TRACE_HEADER_SIZE + file->nrecords * H5FD_TRACE_RECORD_SIZE;
+    while(nbytes > 0) {
+        h5_posix_io_ret_t bytes_wrote;
+
+        do {
+            bytes_wrote = HDwrite(file->fd, p, (h5_posix_io_t)nbytes);
+        } while(-1 == bytes_wrote && EINTR == errno);
+        if(-1 == bytes_wrote)
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace records")
+
+        p += bytes_wrote;
+        nbytes -= (size_t)bytes_wrote;
+    } /* end while */
+
+done:
+    /* Drop the records even on failure, so the buffer doesn't stay full */
+    file->nrecords = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__trace_write_records() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__trace_record
+ *
+ * Purpose:	Adds a record for an operation which ran from START to END
+ *		to the buffer, writing the buffer out if it is full.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__trace_record(H5FD_trace_t *file, unsigned op, H5FD_mem_t type,
+    haddr_t addr, hsize_t size, uint64_t start, uint64_t end)
+{
+    uint8_t     *p;                     /* Pointer to the record */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_lock_simple(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+
+    p = file->rec_buf + H5FD_TRACE_HEADER_SIZE + file->nrecords * H5FD_TRACE_RECORD_SIZE;
+    UINT64ENCODE(p, start - file->t0);
+    UINT64ENCODE(p, end - start);
+    UINT64ENCODE(p, addr);
+    UINT64ENCODE(p, size);
+    *p++ = (uint8_t)op;
+    *p++ = (uint8_t)type;
+    HDmemset(p, 0, (size_t)6);
+
+    if(++file->nrecords == file->fa->nrecords)
+        if(H5FD__trace_write_records(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace records")
+
+done:
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_unlock_simple(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__trace_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_open
+ *
+ * Purpose:	Opens the file with the underlying driver, and sets up the
+ *		trace buffer.
+ *
+ * Return:	Success:	A pointer to a new file data structure. The
+ *				public fields will be initialized by the
+ *				caller, which is always H5FD_open().
+ *
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_trace_open(const char *name, unsigned flags, hid_t fapl_id,
+		 haddr_t maxaddr)
+{
+    H5FD_trace_t	*file = NULL;
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    const H5FD_trace_fapl_t *fa;
+    H5FD_t     		*ret_value = NULL;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_trace_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Create the new file struct */
+    if(NULL == (file = (H5FD_trace_t *)H5MM_calloc(sizeof(H5FD_trace_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->fd = -1;
+    if(NULL == (file->fa = (H5FD_trace_fapl_t *)H5FD_trace_fapl_copy(fa)))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTCOPY, NULL, "unable to copy driver info")
+
+    /* Get the trace file name */
+    if(fa->trace_file)
+        file->trace_name = H5MM_strdup(fa->trace_file);
+    else {
+        size_t name_len = HDstrlen(name);
+
+        if(NULL != (file->trace_name = (char *)H5MM_malloc(name_len + sizeof(H5FD_TRACE_SUFFIX)))) {
+            HDmemcpy(file->trace_name, name, name_len);
+            HDmemcpy(file->trace_name + name_len, H5FD_TRACE_SUFFIX, sizeof(H5FD_TRACE_SUFFIX));
+        } /* end if */
+    } /* end else */
+    if(NULL == file->trace_name)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate trace file name")
+
+    if(NULL == (file->rec_buf = (uint8_t *)H5MM_malloc(H5FD_TRACE_HEADER_SIZE + fa->nrecords * H5FD_TRACE_RECORD_SIZE)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate trace buffer")
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_init(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+
+    /* Open the file being traced */
+    if(NULL == (file->under = H5FD_open(name, flags, fa->under_fapl_id, HADDR_UNDEF)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open traced file")
+
+    /* Start the session's clock, and identify the session in the trace by
+     * the wall-clock time it started
+     */
+    file->t0 = H5FD__trace_now();
+    {
+        struct timeval tv;
+
+        HDgettimeofday(&tv, NULL);
+        file->session = (uint64_t)tv.tv_sec * 1000000000 + (uint64_t)tv.tv_usec * 1000;
+    }
+
+    ret_value = (H5FD_t *)file;
+
+done:
+    /* Cleanup and fail */
+    if(ret_value == NULL && file != NULL) {
+        if(file->fa)
+            H5FD_trace_fapl_free(file->fa);
+        H5MM_xfree(file->trace_name);
+        if(file->rec_buf) {
+            H5MM_xfree(file->rec_buf);
+#ifdef H5_HAVE_THREADSAFE
+            H5TS_mutex_destroy(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+        } /* end if */
+        H5MM_xfree(file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_close
+ *
+ * Purpose:	Writes out any buffered records, and closes the file and
+ *		the trace file.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_close(H5FD_t *_file)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_close(file->under) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close traced file")
+
+    if(H5FD__trace_write_records(file) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace records")
+    if(file->fd >= 0 && HDclose(file->fd) < 0)
+        /* Push error, but keep going*/
+        HSYS_DONE_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close trace file")
+
+    /* Clean up other stuff */
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_destroy(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+    if(H5FD_trace_fapl_free(file->fa) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free driver info")
+    H5MM_xfree(file->rec_buf);
+    H5MM_xfree(file->trace_name);
+    H5MM_xfree(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_cmp
+ *
+ * Purpose:	Compares two traced files to see if they are the same, by
+ *		comparing the underlying files.
+ *
+ * Return:	Success:	like strcmp()
+ *
+ *		Failure:	never fails (arguments were checked by the
+ *				caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_trace_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_trace_t	*f1 = (const H5FD_trace_t *)_f1;
+    const H5FD_trace_t	*f2 = (const H5FD_trace_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ret_value = H5FD_cmp(f1->under, f2->under);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_query
+ *
+ * Purpose:	Set the flags that this VFL driver is capable of supporting,
+ *		which are those of the underlying driver.
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_query(const H5FD_t *_file, unsigned long *flags /* out */)
+{
+    const H5FD_trace_t	*file = (const H5FD_trace_t *)_file;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(flags) {
+        *flags = 0;
+
+        /* No file yet when the library asks about the driver itself */
+        if(file)
+            if(H5FD_get_feature_flags(file->under, flags) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get feature flags")
+
+        /* The library can't use MPI on the file through this driver */
+        *flags &= ~(unsigned long)H5FD_FEAT_HAS_MPI;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_type_map
+ *
+ * Purpose:	Retrieve the memory type mapping of the underlying file.
+ *
+ * Return:	Success:	non-negative
+ *		Failure:	negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_get_type_map(const H5FD_t *_file, H5FD_mem_t *type_map)
+{
+    const H5FD_trace_t	*file = (const H5FD_trace_t *)_file;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_get_fs_type_map(file->under, type_map) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get type map")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_type_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_eoa
+ *
+ * Purpose:	Returns the end-of-address marker of the underlying file.
+ *
+ * Return:	Success:	The end-of-address-marker
+ *
+ *		Failure:	HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_trace_get_eoa(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_trace_t	*file = (const H5FD_trace_t *)_file;
+    haddr_t     ret_value = HADDR_UNDEF;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(HADDR_UNDEF == (ret_value = H5FD_get_eoa(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get eoa")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_set_eoa
+ *
+ * Purpose:	Set the end-of-address marker of the underlying file.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t eoa)
+{
+    H5FD_trace_t	*file = (H5FD_trace_t *)_file;
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_set_eoa(file->under, type, eoa) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTSET, FAIL, "unable to set eoa")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_get_eof
+ *
+ * Purpose:	Returns the end-of-file marker of the underlying file.
+ *
+ * Return:	Success:	End of file address.
+ *
+ *		Failure:      	HADDR_UNDEF
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_trace_get_eof(const H5FD_t *_file, H5FD_mem_t type)
+{
+    const H5FD_trace_t	*file = (const H5FD_trace_t *)_file;
+    haddr_t     ret_value = HADDR_UNDEF;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(HADDR_UNDEF == (ret_value = H5FD_get_eof(file->under, type)))
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, HADDR_UNDEF, "unable to get eof")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_trace_get_handle
+ *
+ * Purpose:        Returns the file handle of the underlying file.
+ *
+ * Returns:        Non-negative if succeed or negative if fails.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
+{
+    H5FD_trace_t        *file = (H5FD_trace_t *)_file;
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_get_vfd_handle(file->under, fapl, file_handle) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get file handle")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_read
+ *
+ * Purpose:	Reads SIZE bytes of data from the underlying file beginning
+ *		at address ADDR into buffer BUF, and records the read.
+ *
+ * Return:	Success:	Zero. Result is stored in caller-supplied
+ *				buffer BUF.
+ *
+ *		Failure:	-1, contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+		 void *_buf/*out*/)
+{
+    H5FD_trace_t	*file = (H5FD_trace_t *)_file;
+    H5FD_io_info_t      fdio_info;              /* I/O info for the underlying file */
+    H5P_genplist_t      *plist;                 /* Property list pointer */
+    uint64_t            start;                  /* Start time of the read */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+    fdio_info.file = file->under;
+    fdio_info.meta_dxpl = plist;
+    fdio_info.raw_dxpl = plist;
+
+    start = H5FD__trace_now();
+    if(H5FD_read(&fdio_info, type, addr, size, _buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "traced file read failed")
+    if(H5FD__trace_record(file, H5FD_TRACE_OP_READ, type, addr, (hsize_t)size, start, H5FD__trace_now()) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record read")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_write
+ *
+ * Purpose:	Writes SIZE bytes of data to the underlying file beginning
+ *		at address ADDR from buffer BUF, and records the write.
+ *
+ * Return:	Success:	Zero
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+		  const void *_buf)
+{
+    H5FD_trace_t	*file = (H5FD_trace_t *)_file;
+    H5FD_io_info_t      fdio_info;              /* I/O info for the underlying file */
+    H5P_genplist_t      *plist;                 /* Property list pointer */
+    uint64_t            start;                  /* Start time of the write */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+    fdio_info.file = file->under;
+    fdio_info.meta_dxpl = plist;
+    fdio_info.raw_dxpl = plist;
+
+    start = H5FD__trace_now();
+    if(H5FD_write(&fdio_info, type, addr, size, _buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "traced file write failed")
+    if(H5FD__trace_record(file, H5FD_TRACE_OP_WRITE, type, addr, (hsize_t)size, start, H5FD__trace_now()) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record write")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_flush
+ *
+ * Purpose:	Flushes the underlying file, records the flush, and writes
+ *		out the buffered records.
+ *
+ * Return:	Success:	0
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
+{
+    H5FD_trace_t	*file = (H5FD_trace_t *)_file;
+    uint64_t            start;                  /* Start time of the flush */
+    herr_t              status;                 /* Status from writing the records */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    start = H5FD__trace_now();
+    if(H5FD_flush(file->under, dxpl_id, closing) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush traced file")
+    if(H5FD__trace_record(file, H5FD_TRACE_OP_FLUSH, H5FD_MEM_DEFAULT, (haddr_t)0, (hsize_t)0, start, H5FD__trace_now()) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record flush")
+
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_lock_simple(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+    status = H5FD__trace_write_records(file);
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_unlock_simple(&file->lock);
+#endif /* H5_HAVE_THREADSAFE */
+    if(status < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write trace records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_trace_truncate
+ *
+ * Purpose:	Truncates the underlying file, and records the truncation
+ *		with the new end of file as its address.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing)
+{
+    H5FD_trace_t	*file = (H5FD_trace_t *)_file;
+    uint64_t            start;                  /* Start time of the truncate */
+    herr_t      	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    start = H5FD__trace_now();
+    if(H5FD_truncate(file->under, dxpl_id, closing) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, FAIL, "unable to truncate traced file")
+    if(H5FD__trace_record(file, H5FD_TRACE_OP_TRUNCATE, H5FD_MEM_DEFAULT, H5FD_get_eoa(file->under, H5FD_MEM_DEFAULT), (hsize_t)0, start, H5FD__trace_now()) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to record truncate")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_trace_lock
+ *
+ * Purpose:     To place an advisory lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;   /* VFD file struct */
+    herr_t ret_value = SUCCEED;	        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_lock(file->under, rw) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTLOCK, FAIL, "unable to lock traced file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_trace_unlock
+ *
+ * Purpose:     To remove the existing lock on the underlying file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_trace_unlock(H5FD_t *_file)
+{
+    H5FD_trace_t *file = (H5FD_trace_t *)_file;   	/* VFD file struct */
+    herr_t ret_value = SUCCEED;                         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_unlock(file->under) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTUNLOCK, FAIL, "unable to unlock traced file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_trace_unlock() */
+
@@ -0,0 +1,69 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the trace driver.
+ */
+#ifndef H5FDtrace_H
+#define H5FDtrace_H
+
+#define H5FD_TRACE	(H5FD_trace_init())
+
+/* Default number of records buffered before they are written to the trace */
+#define H5FD_TRACE_DEFAULT_NRECORDS     4096
+
+/*
+ * Layout of a trace file: blocks of fixed-size records, each preceded by
+ * a header, with all integers stored little-endian.  Every time a file is
+ * opened, its blocks are appended to the trace file, so a trace file
+ * holds the operations of all the sessions that used it; the session
+ * start time and process ID in the block headers tell them apart.
+ *
+ * Header:  8-byte magic
+ *          4-byte version
+ *          4-byte record size
+ *          8-byte session start time (ns since the Epoch)
+ *          4-byte process ID
+ *          4-byte number of records in the block
+ * Record:  8-byte start time (ns since the file was opened)
+ *          8-byte latency (ns)
+ *          8-byte address
+ *          8-byte size
+ *          1-byte operation (H5FD_TRACE_OP_*)
+ *          1-byte memory type (H5FD_mem_t)
+ *          6 bytes reserved
+ */
+#define H5FD_TRACE_MAGIC                "H5FDTRCE"
+#define H5FD_TRACE_VERSION              2
+#define H5FD_TRACE_HEADER_SIZE          32
+#define H5FD_TRACE_RECORD_SIZE          40
+
+/* Operations in a trace record */
+#define H5FD_TRACE_OP_READ              0
+#define H5FD_TRACE_OP_WRITE             1
+#define H5FD_TRACE_OP_FLUSH             2
+#define H5FD_TRACE_OP_TRUNCATE          3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t H5FD_trace_init(void);
+H5_DLL herr_t H5Pset_fapl_trace(hid_t fapl_id, const char *trace_file,
+    size_t nrecords, hid_t under_fapl_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
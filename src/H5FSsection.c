@@ -1685,7 +1685,10 @@ HDfprintf(stderr, "%s: bin = %u\n", FUNC, bin);
 
     do {
         /* Check if there's any sections in this bin */
-        if(fspace->sinfo->bins[bin].bin_list) {
+        /* (The bin's skip list is retained after its last section is removed,
+         *  so check the section count to avoid probing empty bins)
+         */
+        if(fspace->sinfo->bins[bin].bin_list && fspace->sinfo->bins[bin].tot_sect_count > 0) {
 
             if (!alignment) { /* no alignment */
                 /* Find the first free space section that is large enough to fulfill request */
@@ -1710,8 +1713,11 @@ HDfprintf(stderr, "%s: bin = %u\n", FUNC, bin);
                 } /* end if */
             }  /* end if */
             else { /* alignment is set */
-                /* get the first node of a certain size in this bin */
-                curr_size_node = H5SL_first(fspace->sinfo->bins[bin].bin_list);
+                /* Get the first node in this bin large enough to fulfill the
+                 *  request.  (Smaller sections can never satisfy the request,
+                 *  whatever their alignment, so don't scan them)
+                 */
+                curr_size_node = H5SL_above(fspace->sinfo->bins[bin].bin_list, &request);
                 while (curr_size_node != NULL) {
                     H5FS_node_t *curr_fspace_node=NULL;
                     H5SL_node_t *curr_sect_node=NULL;
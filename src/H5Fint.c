@@ -165,6 +165,10 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache size")
     if(H5P_set(new_plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't sieve buffer size")
+    if(H5P_set(new_plist, H5F_ACS_META_READ_AHEAD_SIZE_NAME, &(f->shared->meta_ra.max_size)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata read-ahead size")
+    if(H5P_set(new_plist, H5F_ACS_CHUNK_ALLOC_RESERVE_NAME, &(f->shared->chunk_alloc_reserve)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk allocation reservation flag")
     if(H5P_set(new_plist, H5F_ACS_SDATA_BLOCK_SIZE_NAME, &(f->shared->sdata_aggr.alloc_size)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set 'small data' cache size")
     if(f->shared->latest_flags > 0)
@@ -187,6 +191,10 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set minimum metadata fraction of page buffer")
         if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &(f->shared->page_buf->min_raw_perc)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set minimum raw data fraction of page buffer")
+        if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_NAME, &(f->shared->page_buf->shm_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set shared page buffer size")
+        if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &(f->shared->page_buf->policy)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't set page buffer replacement policy")
     } /* end if */
 #ifdef H5_HAVE_PARALLEL
     if(H5P_set(new_plist, H5_COLL_MD_READ_FLAG_NAME, &(f->coll_md_read)) < 0)
@@ -604,6 +612,7 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
         f->shared->sohm_addr = HADDR_UNDEF;
         f->shared->sohm_vers = HDF5_SHAREDHEADER_VERSION;
         f->shared->accum.loc = HADDR_UNDEF;
+        f->shared->meta_ra.loc = HADDR_UNDEF;
         f->shared->lf = lf;
 
         /* Initialization for handling file space */
@@ -675,6 +684,10 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get garbage collect reference")
         if(H5P_get(plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get sieve buffer size")
+        if(H5P_get(plist, H5F_ACS_META_READ_AHEAD_SIZE_NAME, &(f->shared->meta_ra.max_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata read-ahead size")
+        if(H5P_get(plist, H5F_ACS_CHUNK_ALLOC_RESERVE_NAME, &(f->shared->chunk_alloc_reserve)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get chunk allocation reservation flag")
         if(H5P_get(plist, H5F_ACS_LATEST_FORMAT_NAME, &latest_format) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'latest format' flag")
         /* For latest format or SWMR_WRITE, activate all latest version support */
@@ -1036,6 +1049,7 @@ H5F__dest(H5F_t *f, hid_t meta_dxpl_id, hid_t raw_dxpl_id, hbool_t flush)
         if(H5F__accum_reset(&fio_info, TRUE) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        H5F__read_ahead_reset(f);
         if(H5FO_dest(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
@@ -1182,6 +1196,8 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
     size_t              page_buf_size;
     unsigned            page_buf_min_meta_perc;
     unsigned            page_buf_min_raw_perc;
+    size_t              page_buf_shared_size;
+    H5F_page_buffer_policy_t page_buf_policy;
     hbool_t             set_flag = FALSE;   /*set the status_flags in the superblock */
     hbool_t             clear = FALSE;      /*clear the status_flags 	    */
     hbool_t             evict_on_close;     /* evict on close value from plist  */
@@ -1349,6 +1365,10 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum metadata fraction of page buffer")
         if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &page_buf_min_raw_perc) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get minimum raw data fraction of page buffer")
+        if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_NAME, &page_buf_shared_size) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get shared page buffer size")
+        if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &page_buf_policy) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get page buffer replacement policy")
     } /* end if */
 
     /*
@@ -1363,7 +1383,7 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
 
         /* Create the page buffer before initializing the superblock */
         if(page_buf_size)
-            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc, page_buf_shared_size, page_buf_policy) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Initialize information about the superblock and allocate space for it */
@@ -1385,12 +1405,21 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
 
         /* Create the page buffer before initializing the superblock */
         if(page_buf_size)
-            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc) < 0)
+            if(H5PB_create(file, page_buf_size, page_buf_min_meta_perc, page_buf_min_raw_perc, page_buf_shared_size, page_buf_policy) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
 
         /* Open the root group */
         if(H5G_mkroot(file, meta_dxpl_id, FALSE) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to read root group")
+
+#ifdef H5_HAVE_PARALLEL
+        /* Other processes may write to the file from now on, so stop
+         * reading from the start of the file broadcast at open
+         */
+        if(H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) && (H5F_INTENT(file) & H5F_ACC_RDWR))
+            if(H5FD_mpio_free_open_image(lf) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFREE, NULL, "unable to free open image")
+#endif /* H5_HAVE_PARALLEL */
     } /* end if */
 
     /*
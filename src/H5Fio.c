@@ -36,6 +36,7 @@
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fpkg.h"             /* File access				*/
 #include "H5FDprivate.h"	/* File drivers				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5PBprivate.h"	/* Page Buffer				*/
 
@@ -74,6 +75,8 @@
 /* Local Variables */
 /*******************/
 
+/* Declare a PQ free list to manage the metadata read-ahead buffer */
+H5FL_BLK_DEFINE_STATIC(meta_ra);
 
 
 /*-------------------------------------------------------------------------
@@ -113,6 +116,15 @@ H5F_block_read(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     /* Treat global heap as raw data */
     map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
 
+    /* Check if the metadata was already brought in by a read-ahead request */
+    if(map_type != H5FD_MEM_DRAW && f->shared->meta_ra.size > 0
+            && H5F_addr_le(f->shared->meta_ra.loc, addr)
+            && H5F_addr_le((addr + size), (f->shared->meta_ra.loc + f->shared->meta_ra.size))) {
+        HDmemcpy(buf, f->shared->meta_ra.buf + (addr - f->shared->meta_ra.loc), size);
+        f->shared->meta_ra.nhits++;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Set up the I/O info object */
     fio_info.f = f;
     if(H5FD_MEM_DRAW == type) {
@@ -194,10 +206,173 @@ H5F_block_write(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     if(H5PB_write(&fio_info, map_type, addr, size, buf) < 0)
         HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
 
+    /* Keep any overlapping part of the metadata read-ahead buffer current */
+    if(f->shared->meta_ra.size > 0
+            && H5F_addr_overlap(addr, size, f->shared->meta_ra.loc, f->shared->meta_ra.size)) {
+        haddr_t ra_end = f->shared->meta_ra.loc + f->shared->meta_ra.size;
+        haddr_t start = MAX(addr, f->shared->meta_ra.loc);
+        haddr_t end = MIN((addr + size), ra_end);
+
+        HDmemcpy(f->shared->meta_ra.buf + (start - f->shared->meta_ra.loc),
+                (const unsigned char *)buf + (start - addr), (size_t)(end - start));
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_read_ahead
+ *
+ * Purpose:	Speculatively reads a set of metadata blocks that are likely
+ *		to be loaded into the metadata cache soon (for example, the
+ *		children of a B-tree node that was just loaded), using a
+ *		single request to the file driver.
+ *
+ *		Blocks which are already in the metadata cache are skipped.
+ *		The remaining blocks are covered, starting from the lowest
+ *		address, by one contiguous read of no more than the file's
+ *		read-ahead size.  Later calls to H5F_block_read() which fall
+ *		entirely within that region are satisfied from memory.
+ *
+ *		This is a no-op when read-ahead is disabled, when the page
+ *		buffer is in use (it already caches whole pages), for SWMR
+ *		readers (whose metadata may change underneath them) and for
+ *		parallel files.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_read_ahead(const H5F_t *f, H5FD_mem_t type, size_t nblocks,
+    const H5F_block_t *blocks, hid_t dxpl_id)
+{
+    H5F_meta_ra_t *ra;                  /* Alias for file's read-ahead info */
+    haddr_t     lo = HADDR_UNDEF;       /* Start of region to read */
+    haddr_t     hi = HADDR_UNDEF;       /* End of region to read */
+    haddr_t     eoa;                    /* End of allocated space in file */
+    size_t      nread = 0;              /* # of blocks covered by the read */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(blocks || nblocks == 0);
+    HDassert(type != H5FD_MEM_DRAW);
+
+    ra = &f->shared->meta_ra;
+
+    /* Check for read-ahead being disabled or unsafe */
+    if(0 == ra->max_size || nblocks < 2)
+        HGOTO_DONE(SUCCEED)
+    if(f->shared->page_buf || (H5F_INTENT(f) & H5F_ACC_SWMR_READ))
+        HGOTO_DONE(SUCCEED)
+#ifdef H5_HAVE_PARALLEL
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Find the lowest address of a block that isn't cached yet */
+    for(u = 0; u < nblocks; u++) {
+        unsigned status = 0;
+
+        if(!H5F_addr_defined(blocks[u].offset) || blocks[u].length == 0)
+            continue;
+        if(H5AC_get_entry_status(f, blocks[u].offset, &status) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to get entry status")
+        if(status & H5AC_ES__IN_CACHE)
+            continue;
+        if(!H5F_addr_defined(lo) || H5F_addr_lt(blocks[u].offset, lo))
+            lo = blocks[u].offset;
+    } /* end for */
+    if(!H5F_addr_defined(lo))
+        HGOTO_DONE(SUCCEED)
+
+    /* Extend the region over all the blocks that fit in the read-ahead size */
+    for(u = 0; u < nblocks; u++) {
+        haddr_t end;
+
+        if(!H5F_addr_defined(blocks[u].offset) || blocks[u].length == 0
+                || H5F_addr_lt(blocks[u].offset, lo))
+            continue;
+        end = blocks[u].offset + blocks[u].length;
+        if((end - lo) > ra->max_size)
+            continue;
+        if(!H5F_addr_defined(hi) || H5F_addr_gt(end, hi))
+            hi = end;
+        nread++;
+    } /* end for */
+
+    /* Reading a single block ahead of time doesn't save anything */
+    if(nread < 2)
+        HGOTO_DONE(SUCCEED)
+
+    /* Don't read past the end of the allocated space */
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, type)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to get EOA")
+    if(H5F_addr_gt(hi, eoa))
+        hi = eoa;
+    if(H5F_addr_le(hi, lo))
+        HGOTO_DONE(SUCCEED)
+
+    /* Check if the region is already buffered */
+    if(ra->size > 0 && H5F_addr_le(ra->loc, lo) && H5F_addr_le(hi, (ra->loc + ra->size)))
+        HGOTO_DONE(SUCCEED)
+
+    /* Make certain the buffer is large enough */
+    if(ra->alloc_size < ra->max_size) {
+        if(NULL == (ra->buf = H5FL_BLK_REALLOC(meta_ra, ra->buf, ra->max_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata read-ahead buffer")
+        ra->alloc_size = ra->max_size;
+    } /* end if */
+
+    /* Invalidate the current contents, so the read below goes to the file */
+    ra->size = 0;
+
+    /* Read the region */
+    if(H5F_block_read(f, type, lo, (size_t)(hi - lo), dxpl_id, ra->buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead metadata")
+
+    /* Note the buffered region */
+    ra->loc = lo;
+    ra->size = (size_t)(hi - lo);
+    ra->nreads++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_read_ahead() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__read_ahead_reset
+ *
+ * Purpose:	Discard the metadata read-ahead buffer for a file.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F__read_ahead_reset(const H5F_t *f)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(f->shared->meta_ra.buf)
+        f->shared->meta_ra.buf = H5FL_BLK_FREE(meta_ra, f->shared->meta_ra.buf);
+    f->shared->meta_ra.loc = HADDR_UNDEF;
+    f->shared->meta_ra.size = 0;
+    f->shared->meta_ra.alloc_size = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F__read_ahead_reset() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
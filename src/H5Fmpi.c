@@ -206,6 +206,43 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_mpi_get_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_mpi_get_stripe_size
+ *
+ * Purpose:     Retrieves the stripe size to align parallel metadata
+ *              writes to: the file system stripe size reported by the
+ *              MPI-IO driver or, when that is unknown, the file's
+ *              alignment (see H5Pset_alignment).  Zero means metadata
+ *              writes need not be aligned.
+ *
+ * Return:      Success:        Non-negative
+ *
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_mpi_get_stripe_size(const H5F_t *f, hsize_t *stripe_size)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f && f->shared);
+    HDassert(stripe_size);
+
+    *stripe_size = 0;
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        if(H5FD_get_mpio_stripe_size(f->shared->lf, stripe_size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get stripe size")
+    if(0 == *stripe_size && f->shared->alignment > 1)
+        *stripe_size = f->shared->alignment;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mpi_get_stripe_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Fset_mpi_atomicity
@@ -286,6 +323,51 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Fget_mdc_sync_timing
+ *
+ * Purpose:	Returns the number of metadata cache sync points run on
+ *		this process since the file was opened, with the number of
+ *		entries written and the time spent in each phase.  A sync
+ *		point is where the processes agree on the dirty metadata
+ *		to write and write it: on H5Fflush(), on close, or when
+ *		enough metadata became dirty.  The breakdown for one flush
+ *		is the difference of the values before and after it.
+ *
+ * Return:	Success:	Non-negative
+ *
+ * 		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_mdc_sync_timing(hid_t file_id, H5F_mdc_sync_timing_t *timing)
+{
+    H5F_t      *file;
+    herr_t     ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", file_id, timing);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == timing)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no timing struct")
+
+    /* Check VFD */
+    if(!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "incorrect VFL driver, does not support metadata sync points")
+
+    /* Get the timing from the metadata cache */
+    if(H5AC_get_sync_timing(file->shared->cache, timing) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get sync point timing")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Fget_mdc_sync_timing() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_mpi_retrieve_comm
@@ -199,6 +199,17 @@ typedef struct H5F_meta_accum_t {
     hbool_t             dirty;          /* Flag to indicate that the accumulated metadata is dirty */
 } H5F_meta_accum_t;
 
+/* Structure for metadata read-ahead buffer fields */
+typedef struct H5F_meta_ra_t {
+    unsigned char      *buf;            /* Buffer holding speculatively read metadata */
+    haddr_t             loc;            /* File location (offset) of the buffered metadata */
+    size_t              size;           /* Size of the buffered metadata (in bytes, 0 if empty) */
+    size_t              alloc_size;     /* Size of the buffer allocated (in bytes) */
+    size_t              max_size;       /* Maximum size of a read-ahead request (0 disables read-ahead) */
+    unsigned            nreads;         /* # of read-ahead requests made to the file */
+    unsigned            nhits;          /* # of block reads satisfied from the buffer */
+} H5F_meta_ra_t;
+
 /* A record of the mount table */
 typedef struct H5F_mount_t {
     struct H5G_t	*group;	/* Mount point group held open		*/
@@ -299,6 +310,7 @@ struct H5F_file_t {
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
+    hbool_t     chunk_alloc_reserve; /* Whether to reserve file space for all chunks of an early allocation at once */
     unsigned	gc_ref;		/* Garbage-collect references?		*/
     unsigned	latest_flags;	/* The latest version support */
     hbool_t	store_msg_crt_idx;  /* Store creation index for object header messages?	*/
@@ -345,6 +357,9 @@ struct H5F_file_t {
     /* Metadata accumulator information */
     H5F_meta_accum_t accum;     /* Metadata accumulator info           	*/
 
+    /* Metadata read-ahead information */
+    H5F_meta_ra_t meta_ra;      /* Metadata read-ahead buffer info      */
+
     /* Metadata retry info */
     unsigned 		read_attempts;	/* The # of reads to try when reading metadata with checksum */
     unsigned		retries_nbins;		/* # of bins for each retries[] */
@@ -433,6 +448,9 @@ H5_DLL herr_t H5F__accum_free(const H5F_io_info2_t *fio_info, H5FD_mem_t type,
 H5_DLL herr_t H5F__accum_flush(const H5F_io_info2_t *fio_info);
 H5_DLL herr_t H5F__accum_reset(const H5F_io_info2_t *fio_info, hbool_t flush);
 
+/* Metadata read-ahead routines */
+H5_DLL void H5F__read_ahead_reset(const H5F_t *f);
+
 /* Shared file list related routines */
 H5_DLL herr_t H5F_sfile_add(H5F_file_t *shared);
 H5_DLL H5F_file_t * H5F_sfile_search(H5FD_t *lf);
@@ -466,6 +484,8 @@ H5_DLL herr_t H5F_get_sohm_mesg_count_test(hid_t fid, unsigned type_id,
 H5_DLL herr_t H5F_check_cached_stab_test(hid_t file_id);
 H5_DLL herr_t H5F_get_maxaddr_test(hid_t file_id, haddr_t *maxaddr);
 H5_DLL herr_t H5F_get_sbe_addr_test(hid_t file_id, haddr_t *sbe_addr);
+H5_DLL herr_t H5F_get_meta_read_ahead_stats_test(hid_t file_id, unsigned *nreads,
+    unsigned *nhits);
 #endif /* H5F_TESTING */
 
 #endif /* _H5Fpkg_H */
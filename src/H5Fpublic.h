@@ -95,6 +95,17 @@
  * desired flags.
  */
 #define H5F_MPIO_DEBUG_KEY "H5F_mpio_debug_key"
+
+/* Totals over the metadata cache sync points run on this process since
+ * the file was opened, see H5Fget_mdc_sync_timing() */
+typedef struct H5F_mdc_sync_timing_t {
+    unsigned    nsync_points;   /* Number of sync points                     */
+    unsigned    nentries;       /* Metadata entries written by this process  */
+    double      total_time;     /* Seconds in sync points                    */
+    double      list_time;      /* ... agreeing on the entries to write      */
+    double      flush_time;     /* ... serializing and flushing entries      */
+    double      write_time;     /* ... in collective metadata writes         */
+} H5F_mdc_sync_timing_t;
 #endif /* H5_HAVE_PARALLEL */
 
 /* The difference between a single file and a set of mounted files */
@@ -189,6 +200,15 @@ typedef enum H5F_fspace_strategy_t {
     H5F_FSPACE_STRATEGY_NTYPES      /* must be last */
 } H5F_fspace_strategy_t;
 
+/* Page buffer replacement policy */
+typedef enum H5F_page_buffer_policy_t {
+    H5F_PAGE_BUFFER_POLICY_LRU = 0, /* Single LRU list over all pages */
+                                    /* This is the library default when not set */
+    H5F_PAGE_BUFFER_POLICY_2Q = 1,  /* 2Q: new pages are kept in a FIFO and only move to the LRU
+                                     * list when re-referenced after being evicted from it */
+    H5F_PAGE_BUFFER_POLICY_NTYPES   /* must be last */
+} H5F_page_buffer_policy_t;
+
 /* Deprecated: File space handling strategy for release 1.10.0 */
 /* They are mapped to H5F_fspace_strategy_t as defined above from release 1.10.1 onwards */
 typedef enum H5F_file_space_type_t {
@@ -265,11 +285,15 @@ H5_DLL herr_t H5Fformat_convert(hid_t fid);
 H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
 H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
     unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+H5_DLL herr_t H5Fget_page_buffering_ext_stats(hid_t file_id, double hit_ratios[2],
+    unsigned writes[2], double *write_time);
 H5_DLL herr_t H5Fget_mdc_image_info(hid_t file_id, haddr_t *image_addr, hsize_t *image_size);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5Fset_mpi_atomicity(hid_t file_id, hbool_t flag);
 H5_DLL herr_t H5Fget_mpi_atomicity(hid_t file_id, hbool_t *flag);
+H5_DLL herr_t H5Fget_mdc_sync_timing(hid_t file_id,
+                                     /*OUT*/ H5F_mdc_sync_timing_t *timing);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Symbols defined for compatibility with previous versions of the HDF5 API.
@@ -767,6 +767,59 @@ H5F_sieve_buf_size(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->sieve_buf_size)
 } /* end H5F_sieve_buf_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_meta_read_ahead_size
+ *
+ * Purpose:	Retrieve the maximum size of a metadata read-ahead request
+ *              for the file.
+ *
+ * Return:	Success:	The read-ahead size (0 if read-ahead is
+ *                              disabled).
+ *
+ * 		Failure:	(should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_meta_read_ahead_size(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->meta_ra.max_size)
+} /* end H5F_meta_read_ahead_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_chunk_alloc_reserve
+ *
+ * Purpose:	Retrieve whether file space for all the chunks of an early
+ *              allocation is reserved at once.  (Never with paged
+ *              aggregation, where small chunks must not cross a page
+ *              boundary.)
+ *
+ * Return:	Success:	The chunk allocation reservation flag.
+ *
+ * 		Failure:	(should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_chunk_alloc_reserve(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->chunk_alloc_reserve && !H5F_PAGED_AGGR(f))
+} /* end H5F_chunk_alloc_reserve() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_gc_ref
@@ -218,3 +218,36 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_get_sbe_addr_test() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_meta_read_ahead_stats_test
+ *
+ * Purpose:     Retrieve the number of metadata read-ahead requests made
+ *		for a file, and the number of metadata reads that were
+ *		satisfied from the read-ahead buffer
+ *
+ * Return:	Success:        Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_get_meta_read_ahead_stats_test(hid_t file_id, unsigned *nreads, unsigned *nhits)
+{
+    H5F_t	*file;                  /* File info */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file")
+
+    /* Retrieve the read-ahead counters for the file */
+    *nreads = file->shared->meta_ra.nreads;
+    *nhits = file->shared->meta_ra.nhits;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_get_meta_read_ahead_stats_test() */
+
@@ -67,6 +67,12 @@
  */
 #define H5HG_MAXIDX	65535
 
+/*
+ * H5HG_read_batch() sorts its requests when more than one in this many
+ * is out of order.
+ */
+#define H5HG_READ_BATCH_UNSORTED 64
+
 
 /******************/
 /* Local Typedefs */
@@ -583,6 +589,93 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* H5HG_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_insert_batch
+ *
+ * Purpose:	Inserts NREQS new objects into the global heap, returning
+ *		their heap IDs in the requests.
+ *
+ *		Rather than looking for free space on the CWFS list for each
+ *		object, the objects are laid out in order in new collections
+ *		sized to hold them (up to H5HG_MAXSIZE bytes, unless a
+ *		single object is larger), and each collection is protected
+ *		once.  Runs of objects too small to fill a minimum-sized
+ *		collection are inserted one at a time with H5HG_insert(),
+ *		so that they use the free space of existing collections.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_insert_batch(H5F_t *f, hid_t dxpl_id, size_t nreqs, H5HG_insert_req_t *reqs)
+{
+    H5HG_heap_t	*heap = NULL;           /* Collection being filled */
+    unsigned 	heap_flags = H5AC__NO_FLAGS_SET;
+    size_t      u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(reqs || nreqs == 0);
+
+    if(0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+	HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    for(u = 0; u < nreqs; u = v) {
+        haddr_t addr;           /* Address of the new collection */
+        size_t  need = 0;       /* Space needed for the objects in the collection */
+
+        /* Choose the objects for the next collection */
+        for(v = u; v < nreqs; v++) {
+            size_t obj_need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(reqs[v].size);
+
+            if(v > u && (need + obj_need > H5HG_MAXSIZE - H5HG_SIZEOF_HDR(f) || v - u >= H5HG_MAXIDX))
+                break;
+            need += obj_need;
+        } /* end for */
+
+        /* Put a few small objects where there's room for them already */
+        if(need + H5HG_SIZEOF_HDR(f) < H5HG_MINSIZE) {
+            for(; u < v; u++)
+                if(H5HG_insert(f, dxpl_id, reqs[u].size, (void *)reqs[u].obj, &reqs[u].hobj) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTINSERT, FAIL, "unable to insert global heap object")
+            continue;
+        } /* end if */
+
+        /* Create a collection for the objects and fill it */
+        addr = H5HG_create(f, dxpl_id, need + H5HG_SIZEOF_HDR(f));
+        if(!H5F_addr_defined(addr))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTINIT, FAIL, "unable to allocate a global heap collection")
+        if(NULL == (heap = H5HG_protect(f, dxpl_id, addr, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+        for(; u < v; u++) {
+            size_t idx;
+
+            if(0 == (idx = H5HG_alloc(f, heap, reqs[u].size, &heap_flags)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTALLOC, FAIL, "unable to allocate global heap object")
+            if(reqs[u].size > 0)
+                HDmemcpy(heap->obj[idx].begin + H5HG_SIZEOF_OBJHDR(f), reqs[u].obj, reqs[u].size);
+            reqs[u].hobj.addr = addr;
+            reqs[u].hobj.idx = idx;
+        } /* end for */
+        heap_flags |= H5AC__DIRTIED_FLAG;
+        if(H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, addr, heap, heap_flags) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap")
+        heap = NULL;
+        heap_flags = H5AC__NO_FLAGS_SET;
+    } /* end for */
+
+done:
+    if(heap && H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5HG_insert_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HG_read
@@ -657,6 +750,103 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, NULL)
 } /* end H5HG_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_req_cmp
+ *
+ * Purpose:	Compares two batched read requests by the address of their
+ *		collection and then by their object index, for qsort().
+ *
+ * Return:	Negative/zero/positive, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5HG_read_req_cmp(const void *_req1, const void *_req2)
+{
+    const H5HG_read_req_t *req1 = (const H5HG_read_req_t *)_req1;
+    const H5HG_read_req_t *req2 = (const H5HG_read_req_t *)_req2;
+
+    if(H5F_addr_ne(req1->hobj.addr, req2->hobj.addr))
+        return H5F_addr_lt(req1->hobj.addr, req2->hobj.addr) ? -1 : 1;
+    if(req1->hobj.idx != req2->hobj.idx)
+        return req1->hobj.idx < req2->hobj.idx ? -1 : 1;
+    return 0;
+} /* end H5HG_read_req_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_batch
+ *
+ * Purpose:	Reads NREQS global heap objects, each into the buffer of its
+ *		request.  Unless they are mostly in order already, the
+ *		requests are sorted by collection (in place), so that each
+ *		collection is protected only once no matter how many of its
+ *		objects are read.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_read_batch(H5F_t *f, hid_t dxpl_id, size_t nreqs, H5HG_read_req_t *reqs)
+{
+    H5HG_heap_t	*heap = NULL;           /* Pointer to global heap object */
+    size_t      nunsorted = 0;          /* # of requests out of order */
+    size_t      u;                      /* Local index variable */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(reqs || nreqs == 0);
+
+    /* Group the requests by collection.  A few requests out of order
+     * (such as the objects that were put in the free space of older
+     * collections when they were written) only cost a few more protects
+     * of collections that are still cached, which is cheaper than
+     * sorting all of them. */
+    for(u = 1; u < nreqs; u++)
+        if(H5HG_read_req_cmp(&reqs[u - 1], &reqs[u]) > 0)
+            nunsorted++;
+    if(nunsorted > nreqs / H5HG_READ_BATCH_UNSORTED)
+        HDqsort(reqs, nreqs, sizeof(H5HG_read_req_t), H5HG_read_req_cmp);
+
+    for(u = 0; u < nreqs; u++) {
+        size_t size;            /* Size of the heap object */
+
+        /* Move on to the next collection */
+        if(NULL == heap || H5F_addr_ne(heap->addr, reqs[u].hobj.addr)) {
+            if(heap) {
+                if(H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+                heap = NULL;
+            } /* end if */
+            if(NULL == (heap = H5HG_protect(f, dxpl_id, reqs[u].hobj.addr, H5AC__READ_ONLY_FLAG)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+
+            /* Advance the heap in the CWFS list, as H5HG_read() does */
+            if(heap->obj[0].begin)
+                if(H5F_cwfs_advance_heap(f, heap, FALSE) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, FAIL, "can't adjust file's CWFS")
+        } /* end if */
+
+        if(reqs[u].hobj.idx >= heap->nused || NULL == heap->obj[reqs[u].hobj.idx].begin)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, FAIL, "invalid global heap object index")
+        size = heap->obj[reqs[u].hobj.idx].size;
+        if(size > reqs[u].buf_size)
+            HGOTO_ERROR(H5E_HEAP, H5E_BADRANGE, FAIL, "global heap object larger than buffer")
+        HDmemcpy(reqs[u].buf, heap->obj[reqs[u].hobj.idx].begin + H5HG_SIZEOF_OBJHDR(f), size);
+    } /* end for */
+
+done:
+    if(heap && H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5HG_read_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HG_link
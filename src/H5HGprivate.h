@@ -30,6 +30,20 @@ typedef struct H5HG_t {
     size_t		idx;		/*object ID within collection	*/
 } H5HG_t;
 
+/* Request to read one object with H5HG_read_batch() */
+typedef struct H5HG_read_req_t {
+    H5HG_t		hobj;		/*object to read		*/
+    void		*buf;		/*buffer to copy the object into*/
+    size_t		buf_size;	/*size of the buffer in bytes	*/
+} H5HG_read_req_t;
+
+/* Request to insert one object with H5HG_insert_batch() */
+typedef struct H5HG_insert_req_t {
+    const void		*obj;		/*object to insert		*/
+    size_t		size;		/*size of the object in bytes	*/
+    H5HG_t		hobj;		/*heap ID of the object (out)	*/
+} H5HG_insert_req_t;
+
 /* Typedef for heap in memory (defined in H5HGpkg.h) */
 typedef struct H5HG_heap_t H5HG_heap_t;
 
@@ -56,7 +70,10 @@ typedef struct H5HG_heap_t H5HG_heap_t;
 /* Main global heap routines */
 H5_DLL herr_t H5HG_insert(H5F_t *f, hid_t dxpl_id, size_t size, void *obj,
 			   H5HG_t *hobj/*out*/);
+H5_DLL herr_t H5HG_insert_batch(H5F_t *f, hid_t dxpl_id, size_t nreqs,
+    H5HG_insert_req_t *reqs);
 H5_DLL void *H5HG_read(H5F_t *f, hid_t dxpl_id, H5HG_t *hobj, void *object, size_t *buf_size/*out*/);
+H5_DLL herr_t H5HG_read_batch(H5F_t *f, hid_t dxpl_id, size_t nreqs, H5HG_read_req_t *reqs);
 H5_DLL int H5HG_link(H5F_t *f, hid_t dxpl_id, const H5HG_t *hobj, int adjust);
 H5_DLL herr_t H5HG_get_obj_size(H5F_t *f, hid_t dxpl_id, H5HG_t *hobj, size_t *obj_size);
 H5_DLL herr_t H5HG_remove(H5F_t *f, hid_t dxpl_id, H5HG_t *hobj);
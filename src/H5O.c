@@ -40,9 +40,7 @@
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5Lprivate.h"		/* Links				*/
 #include "H5MFprivate.h"	/* File memory management		*/
-#ifdef H5O_ENABLE_BOGUS
 #include "H5MMprivate.h"	/* Memory management			*/
-#endif /* H5O_ENABLE_BOGUS */
 #include "H5Opkg.h"             /* Object headers			*/
 #include "H5SMprivate.h"        /* Shared object header messages        */
 
@@ -1807,6 +1805,8 @@ H5O_protect(const H5O_loc_t *loc, hid_t dxpl_id, unsigned prot_flags,
     H5O_t *oh = NULL;           /* Object header protected */
     H5O_cache_ud_t udata;       /* User data for protecting object header */
     H5O_cont_msgs_t cont_msg_info;      /* Continuation message info */
+    H5F_block_t *ra_blocks = NULL;      /* Continuation chunks to read ahead */
+    size_t ra_msg = 0;                  /* Next continuation message to read ahead */
     unsigned file_intent;       /* R/W intent on file */
     H5O_t *ret_value = NULL;    /* Return value */
 
@@ -1877,6 +1877,21 @@ H5O_protect(const H5O_loc_t *loc, hid_t dxpl_id, unsigned prot_flags,
             size_t chkcnt = oh->nchunks;      /* Count of chunks (for sanity checking) */
 #endif /* NDEBUG */
 
+            /* Read ahead the chunks for any newly found continuation messages */
+            if(curr_msg == ra_msg && H5F_META_READ_AHEAD_SIZE(loc->file) > 0) {
+                size_t u;               /* Local index variable */
+
+                if(NULL == (ra_blocks = (H5F_block_t *)H5MM_realloc(ra_blocks, sizeof(H5F_block_t) * (cont_msg_info.nmsgs - curr_msg))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for read-ahead blocks")
+                for(u = curr_msg; u < cont_msg_info.nmsgs; u++) {
+                    ra_blocks[u - curr_msg].offset = cont_msg_info.msgs[u].addr;
+                    ra_blocks[u - curr_msg].length = cont_msg_info.msgs[u].size;
+                } /* end for */
+                if(H5F_read_ahead(loc->file, H5FD_MEM_OHDR, (cont_msg_info.nmsgs - curr_msg), ra_blocks, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_READERROR, NULL, "unable to read ahead object header chunks")
+                ra_msg = cont_msg_info.nmsgs;
+            } /* end if */
+
             /* Bring the chunk into the cache */
             /* (which adds to the object header) */
             chk_udata.common.addr = cont_msg_info.msgs[curr_msg].addr;
@@ -1966,6 +1981,8 @@ done:
     if(ret_value == NULL && oh)
         if(H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
             HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, NULL, "unable to release object header")
+    if(ra_blocks)
+        ra_blocks = (H5F_block_t *)H5MM_xfree(ra_blocks);
 
     FUNC_LEAVE_NOAPI_TAG(ret_value, NULL)
 } /* end H5O_protect() */
@@ -36,6 +36,7 @@
 #include "H5Fpkg.h"		/* Files				*/
 #include "H5FDprivate.h"	/* File drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5PBpkg.h"            /* File access				*/
 #include "H5SLprivate.h"	/* Skip List				*/
 
@@ -84,24 +85,55 @@
                       (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
 }
 
+#define H5PB__INSERT_FIFO(page_buf, page_ptr) {                         \
+        HDassert(page_buf);                                             \
+        HDassert(page_ptr);                                             \
+        /* insert the entry at the head of the 2Q FIFO. */              \
+        H5PB__PREPEND((page_ptr), (page_buf)->fifo_head_ptr,            \
+                      (page_buf)->fifo_tail_ptr, (page_buf)->fifo_list_len) \
+        (page_ptr)->in_fifo = TRUE;                                     \
+}
+
 #define H5PB__REMOVE_LRU(page_buf, page_ptr) {                          \
         HDassert(page_buf);                                             \
         HDassert(page_ptr);                                             \
-        /* remove the entry from the list. */                           \
-        H5PB__REMOVE((page_ptr), (page_buf)->LRU_head_ptr,              \
-                     (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
+        /* remove the entry from the list it is on. */                  \
+        if((page_ptr)->in_fifo) {                                       \
+            H5PB__REMOVE((page_ptr), (page_buf)->fifo_head_ptr,         \
+                         (page_buf)->fifo_tail_ptr, (page_buf)->fifo_list_len) \
+            (page_ptr)->in_fifo = FALSE;                                \
+        }                                                               \
+        else                                                            \
+            H5PB__REMOVE((page_ptr), (page_buf)->LRU_head_ptr,          \
+                         (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
 }
 
 #define H5PB__MOVE_TO_TOP_LRU(page_buf, page_ptr) {                     \
         HDassert(page_buf);                                             \
         HDassert(page_ptr);                                             \
-        /* Remove entry and insert at the head of the list. */          \
-        H5PB__REMOVE((page_ptr), (page_buf)->LRU_head_ptr,              \
-                     (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
-        H5PB__PREPEND((page_ptr), (page_buf)->LRU_head_ptr,             \
-                       (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
+        /* Remove entry and insert at the head of the list.  (Pages in  \
+         * the 2Q FIFO keep their place.) */                            \
+        if(!(page_ptr)->in_fifo) {                                      \
+            H5PB__REMOVE((page_ptr), (page_buf)->LRU_head_ptr,          \
+                         (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
+            H5PB__PREPEND((page_ptr), (page_buf)->LRU_head_ptr,         \
+                           (page_buf)->LRU_tail_ptr, (page_buf)->LRU_list_len) \
+        }                                                               \
 }
 
+/* Whether a page holds raw data (as opposed to metadata) */
+#define H5PB__IS_RAW(page_ptr)                                          \
+    (H5F_MEM_PAGE_DRAW == (page_ptr)->type || H5F_MEM_PAGE_GHEAP == (page_ptr)->type)
+
+/* Maximum number of dirty pages written back together when a dirty page
+ * is evicted, and maximum size of a single combined write
+ */
+#define H5PB_WRITE_BACK_NPAGES          16
+#define H5PB_WRITE_BACK_MAX_SIZE        (1024 * 1024)
+
+/* Maximum number of pages looked at when gathering dirty pages to write back */
+#define H5PB_WRITE_BACK_SCAN_LEN        (4 * H5PB_WRITE_BACK_NPAGES)
+
 
 /******************/
 /* Local Typedefs */
@@ -125,6 +157,13 @@ typedef struct {
 static herr_t H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry);
 static htri_t H5PB__make_space(const H5F_io_info2_t *fio_info, H5PB_t *page_buf, H5FD_mem_t inserted_type);
 static herr_t H5PB__write_entry(const H5F_io_info2_t *fio_info, H5PB_entry_t *page_entry);
+static H5PB_entry_t *H5PB__find_victim(const H5PB_t *page_buf, H5PB_entry_t *page_entry,
+    H5FD_mem_t inserted_type);
+static herr_t H5PB__write_back(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
+    H5PB_entry_t *page_entry);
+static herr_t H5PB__write_pages(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
+    H5PB_entry_t **entries, size_t nentries);
+static int H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2);
 
 
 /*********************/
@@ -183,6 +222,11 @@ H5PB_reset_stats(H5PB_t *page_buf)
     page_buf->evictions[1] = 0;
     page_buf->bypasses[0] = 0;
     page_buf->bypasses[1] = 0;
+    page_buf->shm_hits[0] = 0;
+    page_buf->shm_hits[1] = 0;
+    page_buf->writes[0] = 0;
+    page_buf->writes[1] = 0;
+    page_buf->write_time = 0.0;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }  /* H5PB_reset_stats() */
@@ -200,6 +244,9 @@ H5PB_reset_stats(H5PB_t *page_buf)
  *              --misses: the number of metadata and raw data misses in the page buffer layer
  *              --evictions: the number of metadata and raw data evictions from the page buffer layer
  *              --bypasses: the number of metadata and raw data accesses that bypass the page buffer layer
+ *              --hit_ratios: the fraction of metadata and raw data page lookups that hit (optional)
+ *              --writes: the number of metadata and raw data dirty pages written to the file (optional)
+ *              --write_time: the time spent writing dirty pages to the file, in seconds (optional)
  *
  * Return:	    Non-negative on success/Negative on failure
  *
@@ -209,8 +256,11 @@ H5PB_reset_stats(H5PB_t *page_buf)
  */
 herr_t 
 H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
-    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2])
+    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2],
+    double hit_ratios[2], unsigned writes[2], double *write_time)
 {
+    unsigned u;                 /* Local index variable */
+
     FUNC_ENTER_NOAPI_NOERR
 
     /* Sanity checks */
@@ -226,6 +276,16 @@ H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2], unsigned hits[2],
     evictions[1] = page_buf->evictions[1];
     bypasses[0] = page_buf->bypasses[0];
     bypasses[1] = page_buf->bypasses[1];
+    if(hit_ratios)
+        for(u = 0; u < 2; u++)
+            hit_ratios[u] = (page_buf->hits[u] + page_buf->misses[u]) > 0 ?
+                    (double)page_buf->hits[u] / (double)(page_buf->hits[u] + page_buf->misses[u]) : 0.0;
+    if(writes) {
+        writes[0] = page_buf->writes[0];
+        writes[1] = page_buf->writes[1];
+    } /* end if */
+    if(write_time)
+        *write_time = page_buf->write_time;
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 }  /* H5PB_get_stats */
@@ -260,6 +320,8 @@ H5PB_print_stats(const H5PB_t *page_buf)
     printf("\t Misses: %u\n", page_buf->misses[0]);
     printf("\t Evictions: %u\n", page_buf->evictions[0]);
     printf("\t Bypasses: %u\n", page_buf->bypasses[0]);
+    printf("\t Shared Memory Hits: %u\n", page_buf->shm_hits[0]);
+    printf("\t Pages Written: %u\n", page_buf->writes[0]);
     printf("\t Hit Rate = %f%%\n", ((double)page_buf->hits[0]/(page_buf->accesses[0] - page_buf->bypasses[0]))*100);
     printf("*****************\n\n");
 
@@ -269,9 +331,13 @@ H5PB_print_stats(const H5PB_t *page_buf)
     printf("\t Misses: %u\n", page_buf->misses[1]);
     printf("\t Evictions: %u\n", page_buf->evictions[1]);
     printf("\t Bypasses: %u\n", page_buf->bypasses[1]);
+    printf("\t Shared Memory Hits: %u\n", page_buf->shm_hits[1]);
+    printf("\t Pages Written: %u\n", page_buf->writes[1]);
     printf("\t Hit Rate = %f%%\n", ((double)page_buf->hits[1]/(page_buf->accesses[1]-page_buf->bypasses[0]))*100);
     printf("*****************\n\n");
 
+    printf("Time Writing Pages: %f s\n", page_buf->write_time);
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5PB_print_stats */
 
@@ -281,6 +347,16 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *
  * Purpose:	Create and setup the PB on the file.
  *
+ *              If SHARED_SIZE is non-zero and the file is opened
+ *              read-only, the page buffer is backed by a shared-memory
+ *              page tier of that size (see H5PBshm.c).
+ *
+ *              PAGE_BUF_POLICY selects the replacement policy: a single
+ *              LRU list, or 2Q, where pages enter a FIFO and only move to
+ *              the LRU when they are used again soon after falling out of
+ *              it, so that a scan of pages used once can't push out the
+ *              working set.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Mohamad Chaarawi
@@ -288,7 +364,8 @@ H5PB_print_stats(const H5PB_t *page_buf)
  *-------------------------------------------------------------------------
  */
 herr_t
-H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc)
+H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+    size_t shared_size, H5F_page_buffer_policy_t page_buf_policy)
 {
     H5PB_t *page_buf = NULL;
     herr_t ret_value = SUCCEED;    /* Return value */
@@ -320,6 +397,7 @@ H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned pag
     H5_CHECKED_ASSIGN(page_buf->page_size, size_t, f->shared->fs_page_size, hsize_t);
     page_buf->min_meta_perc = page_buf_min_meta_perc;
     page_buf->min_raw_perc = page_buf_min_raw_perc;
+    page_buf->policy = page_buf_policy;
 
     /* Calculate the minimum page count for metadata and raw data
      * based on the fractions provided 
@@ -335,6 +413,29 @@ H5PB_create(H5F_t *f, size_t size, unsigned page_buf_min_meta_perc, unsigned pag
     if(NULL == (page_buf->page_fac = H5FL_fac_init(page_buf->page_size)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "can't create page factory")
 
+    /* Set up the FIFO limit and the ring of evicted FIFO page addresses for 2Q */
+    if(H5F_PAGE_BUFFER_POLICY_2Q == page_buf_policy) {
+        size_t npages = size / page_buf->page_size;
+        size_t u;
+
+        page_buf->fifo_max_len = MAX(1, npages / 4);
+        page_buf->ghost_max_len = MAX(1, npages / 2);
+        if(NULL == (page_buf->ghost_addrs = (haddr_t *)H5MM_malloc(page_buf->ghost_max_len * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(u = 0; u < page_buf->ghost_max_len; u++)
+            page_buf->ghost_addrs[u] = HADDR_UNDEF;
+        if(NULL == (page_buf->ghost_slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCREATE, FAIL, "can't create skip list")
+    } /* end if */
+
+    /* Attach to the shared-memory page tier, if requested */
+    if(shared_size > 0) {
+        if(H5PB__shm_open(f, shared_size, page_buf->page_size, &page_buf->shm) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINIT, FAIL, "can't set up shared-memory page tier")
+        if(page_buf->shm)
+            page_buf->shm_size = shared_size;
+    } /* end if */
+
     f->shared->page_buf = page_buf;
 
 done:
@@ -346,6 +447,12 @@ done:
                 H5SL_close(page_buf->mf_slist_ptr);
             if(page_buf->page_fac != NULL)
                 H5FL_fac_term(page_buf->page_fac);
+            if(page_buf->ghost_addrs != NULL)
+                H5MM_xfree(page_buf->ghost_addrs);
+            if(page_buf->ghost_slist_ptr != NULL)
+                H5SL_close(page_buf->ghost_slist_ptr);
+            if(page_buf->shm != NULL)
+                H5PB__shm_close(page_buf->shm);
             page_buf = H5FL_FREE(H5PB_t, page_buf);
         } /* end if */
     } /* end if */
@@ -353,46 +460,15 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5PB_create */
 
-
-/*-------------------------------------------------------------------------
- * Function:	H5PB__flush_cb
- *
- * Purpose:	Callback to flush PB skiplist entries.
- *
- * Return:	Non-negative on success/Negative on failure
- *
- * Programmer:	Mohamad Chaarawi
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5PB__flush_cb(void *item, void H5_ATTR_UNUSED *key, void *_op_data)
-{
-    H5PB_entry_t *page_entry = (H5PB_entry_t *)item;    /* Pointer to page entry node */
-    const H5F_io_info2_t *fio_info = (const H5F_io_info2_t *)_op_data;
-    herr_t  ret_value = SUCCEED;    /* Return value */
-
-    FUNC_ENTER_STATIC
-
-    /* Sanity checks */
-    HDassert(page_entry);
-    HDassert(fio_info);
-
-    /* Flush the page if it's dirty */
-    if(page_entry->is_dirty)
-        if(H5PB__write_entry(fio_info, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* H5PB__flush_cb() */
-
 
 /*-------------------------------------------------------------------------
  * Function:	H5PB_flush
  *
  * Purpose:	Flush/Free all the PB entries to the file.
  *
+ *              Dirty pages are written in address order, with runs of
+ *              adjacent pages combined into single writes.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Mohamad Chaarawi
@@ -415,10 +491,28 @@ H5PB_flush(const H5F_io_info2_t *fio_info)
     /* Flush all the entries in the PB skiplist, if we have write access on the file */
     if(fio_info->f->shared->page_buf && (H5F_ACC_RDWR & H5F_INTENT(fio_info->f))) {
         H5PB_t *page_buf = fio_info->f->shared->page_buf;
+        H5PB_entry_t *entries[H5PB_WRITE_BACK_NPAGES];  /* Batch of dirty pages */
+        size_t nentries = 0;            /* Number of pages in batch */
+        H5SL_node_t *node;              /* Current skip list node */
 
-        /* Iterate over all entries in page buffer skip list */
-        if(H5SL_iterate(page_buf->slist_ptr, H5PB__flush_cb, (void *)fio_info))
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_BADITER, FAIL, "can't flush page buffer skip list")
+        /* Iterate over all entries in page buffer skip list, which is in
+         * address order, and write out the dirty ones in batches
+         */
+        for(node = H5SL_first(page_buf->slist_ptr); node; node = H5SL_next(node)) {
+            H5PB_entry_t *page_entry = (H5PB_entry_t *)H5SL_item(node);
+
+            if(page_entry->is_dirty) {
+                entries[nentries++] = page_entry;
+                if(H5PB_WRITE_BACK_NPAGES == nentries) {
+                    if(H5PB__write_pages(fio_info, page_buf, entries, nentries) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+                    nentries = 0;
+                } /* end if */
+            } /* end if */
+        } /* end for */
+        if(nentries > 0)
+            if(H5PB__write_pages(fio_info, page_buf, entries, nentries) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
     } /* end if */
 
 done:
@@ -512,6 +606,16 @@ H5PB_dest(const H5F_io_info2_t *fio_info)
         if(H5FL_fac_term(page_buf->page_fac) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTRELEASE, FAIL, "can't destroy page buffer page factory")
 
+        /* Release the 2Q ghost ring and the write-back buffer */
+        if(page_buf->ghost_slist_ptr && H5SL_close(page_buf->ghost_slist_ptr) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTCLOSEOBJ, FAIL, "can't close 2Q ghost skip list")
+        page_buf->ghost_addrs = (haddr_t *)H5MM_xfree(page_buf->ghost_addrs);
+        page_buf->write_buf = H5MM_xfree(page_buf->write_buf);
+
+        /* Detach from the shared-memory page tier */
+        if(page_buf->shm && H5PB__shm_close(page_buf->shm) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTRELEASE, FAIL, "can't detach from shared-memory page tier")
+
 #ifdef QAK
 H5PB_print_stats(page_buf);
 #endif /* QAK */
@@ -667,7 +771,7 @@ H5PB_remove_entry(const H5F_t *f, haddr_t addr)
 
         /* Remove from LRU list */
         H5PB__REMOVE_LRU(page_buf, page_entry)
-        HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+        HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len + page_buf->fifo_list_len);
 
         page_buf->meta_count--;
 
@@ -899,6 +1003,7 @@ H5PB_read(const H5F_io_info2_t *fio_info, H5FD_mem_t type, haddr_t addr,
             else {
                 void *new_page_buf = NULL;
                 size_t page_size = page_buf->page_size;
+                hbool_t shm_hit = FALSE;
                 haddr_t eoa;
 
                 /* make space for new entry */
@@ -942,9 +1047,19 @@ H5PB_read(const H5F_io_info2_t *fio_info, H5FD_mem_t type, haddr_t addr,
                 if(search_addr + page_size > eoa)
                     page_size = (size_t)(eoa - search_addr);
 
-                /* Read page from VFD */
-                if(H5FD_read(&fdio_info, type, search_addr, page_size, new_page_buf) < 0)
-                    HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+                /* Look for a full page in the shared-memory page tier first */
+                if(page_buf->shm && page_size == page_buf->page_size
+                        && H5PB__shm_read(page_buf->shm, search_addr, new_page_buf))
+                    shm_hit = TRUE;
+                else {
+                    /* Read page from VFD */
+                    if(H5FD_read(&fdio_info, type, search_addr, page_size, new_page_buf) < 0)
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
+
+                    /* Publish it for the other processes sharing the file */
+                    if(page_buf->shm && page_size == page_buf->page_size)
+                        H5PB__shm_write(page_buf->shm, search_addr, new_page_buf);
+                } /* end else */
 
                 /* Copy the requested data from the page into the input buffer */
                 offset = (0 == i ? addr - search_addr : 0);
@@ -964,11 +1079,25 @@ H5PB_read(const H5F_io_info2_t *fio_info, H5FD_mem_t type, haddr_t addr,
                 if(H5PB__insert_entry(page_buf, page_entry) < 0)
                     HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTSET, FAIL, "error inserting new page in page buffer")
 
-                /* Update statistics */
-                if(type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
-                    page_buf->misses[1]++;
-                else
-                    page_buf->misses[0]++;
+                /* Update statistics.  (A page found in the shared-memory
+                 * tier counts as a hit, since no file I/O was needed.)
+                 */
+                if(shm_hit) {
+                    if(type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP) {
+                        page_buf->hits[1]++;
+                        page_buf->shm_hits[1]++;
+                    } /* end if */
+                    else {
+                        page_buf->hits[0]++;
+                        page_buf->shm_hits[0]++;
+                    } /* end else */
+                } /* end if */
+                else {
+                    if(type == H5FD_MEM_DRAW || type == H5FD_MEM_GHEAP)
+                        page_buf->misses[1]++;
+                    else
+                        page_buf->misses[0]++;
+                } /* end else */
             } /* end else */
         } /* end for */
     } /* end else */
@@ -1338,6 +1467,10 @@ done:
  *
  *                                               JRM -- 12/22/16
  *
+ *          With the 2Q policy, the page goes into the LRU if its
+ *          address was recently evicted from the FIFO, and into the
+ *          FIFO otherwise.
+ *
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1363,8 +1496,21 @@ H5PB__insert_entry(H5PB_t *page_buf, H5PB_entry_t *page_entry)
     else
         page_buf->meta_count++;
 
-    /* Insert entry in LRU */
-    H5PB__INSERT_LRU(page_buf, page_entry)
+    /* Insert entry in LRU, or in the FIFO for 2Q unless the page was used
+     * again soon after being evicted from the FIFO
+     */
+    if(H5F_PAGE_BUFFER_POLICY_2Q == page_buf->policy) {
+        haddr_t *ghost;         /* Slot of the page address in the ring */
+
+        if(NULL != (ghost = (haddr_t *)H5SL_remove(page_buf->ghost_slist_ptr, &(page_entry->addr)))) {
+            *ghost = HADDR_UNDEF;
+            H5PB__INSERT_LRU(page_buf, page_entry)
+        } /* end if */
+        else
+            H5PB__INSERT_FIFO(page_buf, page_entry)
+    } /* end if */
+    else
+        H5PB__INSERT_LRU(page_buf, page_entry)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1386,6 +1532,16 @@ done:
  *
  *                                             JRM -- 12/22/16
  *
+ *          With the 2Q policy, the victim comes from the FIFO when it
+ *          is over its target length (or the LRU is empty), and from
+ *          the LRU otherwise, subject to the same minimum metadata and
+ *          raw data counts.  The addresses of pages evicted from the
+ *          FIFO are remembered so that they go into the LRU if they
+ *          are used again.
+ *
+ *          If the victim is dirty, it is written together with other
+ *          dirty pages close to eviction, see H5PB__write_back().
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Mohamad Chaarawi
@@ -1417,13 +1573,14 @@ H5PB__make_space(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
         } /* end if */
 
         /* check the metadata threshold before evicting metadata items */
-        while(1) {
-            if(page_entry->prev && H5F_MEM_PAGE_META == page_entry->type && 
-                    page_buf->min_meta_count >= page_buf->meta_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
+        if(H5F_PAGE_BUFFER_POLICY_LRU == page_buf->policy)
+            while(1) {
+                if(page_entry->prev && H5F_MEM_PAGE_META == page_entry->type && 
+                        page_buf->min_meta_count >= page_buf->meta_count)
+                    page_entry = page_entry->prev;
+                else
+                    break;
+            } /* end while */
     } /* end if */
     else {
         /* If threshould is 100% raw data and page buffer is full of
@@ -1434,22 +1591,56 @@ H5PB__make_space(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
         } /* end if */
 
         /* check the raw data threshold before evicting raw data items */
-        while(1) {
-            if(page_entry->prev && (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) && 
-                    page_buf->min_raw_count >= page_buf->raw_count)
-                page_entry = page_entry->prev;
-            else
-                break;
-        } /* end while */
+        if(H5F_PAGE_BUFFER_POLICY_LRU == page_buf->policy)
+            while(1) {
+                if(page_entry->prev && (H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type) && 
+                        page_buf->min_raw_count >= page_buf->raw_count)
+                    page_entry = page_entry->prev;
+                else
+                    break;
+            } /* end while */
     } /* end else */
 
+    /* Pick the victim from the FIFO or the LRU for 2Q */
+    if(H5F_PAGE_BUFFER_POLICY_2Q == page_buf->policy) {
+        H5PB_entry_t *first_tail = page_buf->LRU_tail_ptr;     /* Tail of list to look at first */
+        H5PB_entry_t *second_tail = page_buf->fifo_tail_ptr;   /* Tail of list to look at next */
+
+        if(page_buf->fifo_list_len > page_buf->fifo_max_len || NULL == first_tail) {
+            first_tail = page_buf->fifo_tail_ptr;
+            second_tail = page_buf->LRU_tail_ptr;
+        } /* end if */
+        if(NULL == (page_entry = H5PB__find_victim(page_buf, first_tail, inserted_type)))
+            if(NULL == (page_entry = H5PB__find_victim(page_buf, second_tail, inserted_type)))
+                page_entry = first_tail;
+        HDassert(page_entry);
+
+        /* Remember the address of pages evicted from the FIFO */
+        if(page_entry->in_fifo) {
+            haddr_t *ghost = &(page_buf->ghost_addrs[page_buf->ghost_next]);
+
+            if(H5F_addr_defined(*ghost))
+                if(NULL == H5SL_remove(page_buf->ghost_slist_ptr, ghost))
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "2Q ghost address is not in skip list")
+            *ghost = page_entry->addr;
+            if(H5SL_insert(page_buf->ghost_slist_ptr, ghost, ghost) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTINSERT, FAIL, "can't insert 2Q ghost address in skip list")
+            page_buf->ghost_next = (page_buf->ghost_next + 1) % page_buf->ghost_max_len;
+        } /* end if */
+    } /* end if */
+
+    /* Flush page if dirty, along with other dirty pages close to eviction */
+    if(page_entry->is_dirty)
+        if(H5PB__write_back(fio_info, page_buf, page_entry) < 0)
+            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+
     /* Remove from page index */
     if(NULL == H5SL_remove(page_buf->slist_ptr, &(page_entry->addr)))
         HGOTO_ERROR(H5E_PAGEBUF, H5E_BADVALUE, FAIL, "Tail Page Entry is not in skip list")
 
     /* Remove entry from LRU list */
     H5PB__REMOVE_LRU(page_buf, page_entry)
-    HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len);
+    HDassert(H5SL_count(page_buf->slist_ptr) == page_buf->LRU_list_len + page_buf->fifo_list_len);
 
     /* Decrement appropriate page type counter */
     if(H5F_MEM_PAGE_DRAW == page_entry->type || H5F_MEM_PAGE_GHEAP == page_entry->type)
@@ -1457,11 +1648,6 @@ H5PB__make_space(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
     else
         page_buf->meta_count--;
 
-    /* Flush page if dirty */
-    if(page_entry->is_dirty)
-        if(H5PB__write_entry(fio_info, page_entry) < 0)
-            HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
-
     /* Update statistics */
     if(page_entry->type == H5F_MEM_PAGE_DRAW || H5F_MEM_PAGE_GHEAP == page_entry->type)
         page_buf->evictions[1]++;
@@ -1514,7 +1700,9 @@ H5PB__write_entry(const H5F_io_info2_t *fio_info, H5PB_entry_t *page_entry)
      */
     if(page_entry->addr <= eoa) {
         H5FD_io_info_t fdio_info;           /* File driver I/O info */
-        size_t page_size = fio_info->f->shared->page_buf->page_size;
+        H5PB_t *page_buf = fio_info->f->shared->page_buf;
+        size_t page_size = page_buf->page_size;
+        double start_time;                  /* Time the write started */
 
         /* Adjust the page length if it exceeds the EOA */
         if((page_entry->addr + page_size) > eoa)
@@ -1525,8 +1713,16 @@ H5PB__write_entry(const H5F_io_info2_t *fio_info, H5PB_entry_t *page_entry)
         fdio_info.meta_dxpl = fio_info->meta_dxpl;
         fdio_info.raw_dxpl = fio_info->raw_dxpl;
 
+        start_time = H5_get_time();
         if(H5FD_write(&fdio_info, page_entry->type, page_entry->addr, page_size, page_entry->page_buf_ptr) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+
+        /* Update statistics */
+        page_buf->write_time += H5_get_time() - start_time;
+        if(H5PB__IS_RAW(page_entry))
+            page_buf->writes[1]++;
+        else
+            page_buf->writes[0]++;
     } /* end if */
 
     page_entry->is_dirty = FALSE;
@@ -1535,3 +1731,209 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5PB__write_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__find_victim()
+ *
+ * Purpose:	Find the oldest page at or before PAGE_ENTRY in its list
+ *              that may be evicted to make space for a page of
+ *              INSERTED_TYPE without taking the count of metadata or raw
+ *              data pages below its minimum.
+ *
+ * Return:	The page found, or NULL if there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5PB_entry_t *
+H5PB__find_victim(const H5PB_t *page_buf, H5PB_entry_t *page_entry,
+    H5FD_mem_t inserted_type)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    for(; page_entry; page_entry = page_entry->prev) {
+        if(H5PB__IS_RAW(page_entry)) {
+            if(H5FD_MEM_DRAW == inserted_type || page_buf->min_raw_count < page_buf->raw_count)
+                break;
+        } /* end if */
+        else {
+            if(H5FD_MEM_DRAW != inserted_type || page_buf->min_meta_count < page_buf->meta_count)
+                break;
+        } /* end else */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(page_entry)
+} /* end H5PB__find_victim() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__write_back()
+ *
+ * Purpose:	Write the dirty page PAGE_ENTRY, which is about to be
+ *              evicted, to the file.  The other dirty pages next in line
+ *              for eviction in the same list are written with it, in
+ *              address order, so that adjacent pages can be combined
+ *              into larger writes.
+ *
+ *              Files opened for SWMR writing only write the evicted
+ *              page, to keep the order of writes chosen by the metadata
+ *              cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__write_back(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
+    H5PB_entry_t *page_entry)
+{
+    H5PB_entry_t *entries[H5PB_WRITE_BACK_NPAGES];  /* Dirty pages to write */
+    size_t nentries = 0;            /* Number of dirty pages to write */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fio_info);
+    HDassert(page_buf);
+    HDassert(page_entry);
+    HDassert(page_entry->is_dirty);
+
+    entries[nentries++] = page_entry;
+
+    /* Gather the dirty pages next in line for eviction */
+    if(!(H5F_INTENT(fio_info->f) & H5F_ACC_SWMR_WRITE)) {
+        H5PB_entry_t *entry;        /* Current page */
+        size_t nscanned = 0;        /* Number of pages looked at */
+
+        for(entry = page_entry->prev; entry && nentries < H5PB_WRITE_BACK_NPAGES && nscanned < H5PB_WRITE_BACK_SCAN_LEN; entry = entry->prev, nscanned++)
+            if(entry->is_dirty)
+                entries[nentries++] = entry;
+        if(nentries > 1)
+            HDqsort(entries, nentries, sizeof(H5PB_entry_t *), H5PB__entry_addr_cmp);
+    } /* end if */
+
+    if(H5PB__write_pages(fio_info, page_buf, entries, nentries) < 0)
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__write_back() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__write_pages()
+ *
+ * Purpose:	Write the dirty pages in ENTRIES, which are sorted by
+ *              address, to the file.  Runs of adjacent pages of the same
+ *              type are copied into the write-back buffer and written
+ *              with a single call to the file driver.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__write_pages(const H5F_io_info2_t *fio_info, H5PB_t *page_buf,
+    H5PB_entry_t **entries, size_t nentries)
+{
+    size_t max_run;                 /* Maximum number of pages in a combined write */
+    size_t u;                       /* Local index variable */
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fio_info);
+    HDassert(page_buf);
+    HDassert(entries);
+
+    max_run = MAX(1, H5PB_WRITE_BACK_MAX_SIZE / page_buf->page_size);
+
+    for(u = 0; u < nentries; ) {
+        H5PB_entry_t *first = entries[u];   /* First page of the run */
+        size_t nrun = 1;                    /* Number of pages in the run */
+
+        /* Find the run of adjacent pages starting at this page */
+        while(u + nrun < nentries && nrun < max_run && entries[u + nrun]->type == first->type
+                && H5F_addr_eq(entries[u + nrun]->addr, first->addr + (haddr_t)(nrun * page_buf->page_size)))
+            nrun++;
+
+        if(1 == nrun) {
+            if(H5PB__write_entry(fio_info, first) < 0)
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end if */
+        else {
+            haddr_t eoa;                /* Current EOA for the file */
+            size_t v;                   /* Local index variable */
+
+            /* Retrieve the 'eoa' for the file */
+            if(HADDR_UNDEF == (eoa = H5F_get_eoa(fio_info->f, first->type)))
+                HGOTO_ERROR(H5E_PAGEBUF, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+            /* Pages starting beyond the EOA are discarded without writing */
+            if(H5F_addr_lt(first->addr, eoa)) {
+                H5FD_io_info_t fdio_info;   /* File driver I/O info */
+                size_t size = nrun * page_buf->page_size;   /* Size of the combined write */
+                double start_time;          /* Time the write started */
+
+                /* Adjust the length if it exceeds the EOA */
+                if((first->addr + size) > eoa)
+                    size = (size_t)(eoa - first->addr);
+
+                /* Allocate the write-back buffer on first use */
+                if(NULL == page_buf->write_buf)
+                    if(NULL == (page_buf->write_buf = H5MM_malloc(max_run * page_buf->page_size)))
+                        HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed for write-back buffer")
+                for(v = 0; v < nrun; v++)
+                    HDmemcpy((uint8_t *)page_buf->write_buf + (v * page_buf->page_size), entries[u + v]->page_buf_ptr, page_buf->page_size);
+
+                /* Translate to file driver I/O info object */
+                fdio_info.file = fio_info->f->shared->lf;
+                fdio_info.meta_dxpl = fio_info->meta_dxpl;
+                fdio_info.raw_dxpl = fio_info->raw_dxpl;
+
+                start_time = H5_get_time();
+                if(H5FD_write(&fdio_info, first->type, first->addr, size, page_buf->write_buf) < 0)
+                    HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
+
+                /* Update statistics */
+                page_buf->write_time += H5_get_time() - start_time;
+                if(H5PB__IS_RAW(first))
+                    page_buf->writes[1] += (unsigned)nrun;
+                else
+                    page_buf->writes[0] += (unsigned)nrun;
+            } /* end if */
+
+            for(v = 0; v < nrun; v++)
+                entries[u + v]->is_dirty = FALSE;
+        } /* end else */
+
+        u += nrun;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__write_pages() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__entry_addr_cmp()
+ *
+ * Purpose:	Compare the addresses of two page entries, for qsort.
+ *
+ * Return:	Negative, zero or positive as the first page's address is
+ *              less than, equal to or greater than the second page's
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5PB__entry_addr_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5PB_entry_t *entry1 = *(const H5PB_entry_t * const *)_entry1;
+    const H5PB_entry_t *entry2 = *(const H5PB_entry_t * const *)_entry2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(entry1->addr, entry2->addr))
+} /* end H5PB__entry_addr_cmp() */
+
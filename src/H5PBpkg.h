@@ -27,6 +27,14 @@
 /* Package Private Macros */
 /**************************/
 
+/* Whether the shared-memory page tier can be built on this platform.  It
+ * needs POSIX shared memory and the GCC atomic builtins for the lock-free
+ * page slots.
+ */
+#if defined(H5_HAVE_SHM_OPEN) && defined(H5_HAVE_MMAP) && defined(H5_HAVE_SYS_MMAN_H) && defined(__GNUC__)
+#define H5PB_HAVE_SHM
+#endif
+
 
 /****************************/
 /* Package Private Typedefs */
@@ -37,6 +45,7 @@ typedef struct H5PB_entry_t {
     haddr_t	    addr;               /* Address of the page in the file */
     H5F_mem_page_t  type;               /* Type of the page entry (H5F_MEM_PAGE_RAW/META) */
     hbool_t         is_dirty;           /* Flag indicating whether the page has dirty data or not */
+    hbool_t         in_fifo;            /* Flag indicating whether the page is in the 2Q FIFO rather than the LRU */
 
     /* Fields supporting replacement policies */
     struct H5PB_entry_t     *next;      /* next pointer in the LRU list */
@@ -53,6 +62,15 @@ typedef struct H5PB_entry_t {
 /* Package Private Prototypes */
 /******************************/
 
+/* Shared-memory page tier routines */
+H5_DLL herr_t H5PB__shm_open(const H5F_t *f, size_t shm_size, size_t page_size,
+    struct H5PB_shm_t **shm_ptr);
+H5_DLL herr_t H5PB__shm_close(struct H5PB_shm_t *shm);
+H5_DLL hbool_t H5PB__shm_read(struct H5PB_shm_t *shm, haddr_t page_addr,
+    void *page_buf/*out*/);
+H5_DLL void H5PB__shm_write(struct H5PB_shm_t *shm, haddr_t page_addr,
+    const void *page_buf);
+
 
 #endif /* _H5PBpkg_H */
 
@@ -47,10 +47,14 @@
 /* Forward declaration for a page buffer entry */
 struct H5PB_entry_t;
 
+/* Forward declaration for the shared-memory page tier */
+struct H5PB_shm_t;
+
 /* Typedef for the main structure for the page buffer */
 typedef struct H5PB_t {
     size_t              max_size;           /* The total page buffer size */
     size_t              page_size;          /* Size of a single page */
+    H5F_page_buffer_policy_t policy;        /* Replacement policy */
     unsigned            min_meta_perc;      /* Minimum ratio of metadata entries required before evicting meta entries */
     unsigned            min_raw_perc;       /* Minimum ratio of raw data entries required before evicting raw entries */
     unsigned            meta_count;         /* Number of entries for metadata */
@@ -65,14 +69,36 @@ typedef struct H5PB_t {
     struct H5PB_entry_t *LRU_head_ptr;      /* Head pointer of the LRU */
     struct H5PB_entry_t *LRU_tail_ptr;      /* Tail pointer of the LRU */
 
+    /* Fields for the 2Q replacement policy.  New pages go into a FIFO, and
+     * the LRU only holds pages that were used again after falling out of
+     * the FIFO, which is detected with a ring of the addresses of recently
+     * evicted FIFO pages.
+     */
+    size_t              fifo_list_len;      /* Number of entries in the FIFO */
+    size_t              fifo_max_len;       /* Length of the FIFO above which its pages are evicted first */
+    struct H5PB_entry_t *fifo_head_ptr;     /* Head pointer of the FIFO */
+    struct H5PB_entry_t *fifo_tail_ptr;     /* Tail pointer of the FIFO */
+    haddr_t             *ghost_addrs;       /* Ring of the addresses of pages evicted from the FIFO */
+    size_t              ghost_max_len;      /* Number of slots in the ring */
+    size_t              ghost_next;         /* Next slot to reuse in the ring */
+    H5SL_t              *ghost_slist_ptr;   /* Skip list indexing the ring by address */
+
+    void                *write_buf;         /* Buffer for combining writes of adjacent dirty pages */
+
     H5FL_fac_head_t     *page_fac;           /* Factory for allocating pages */
 
+    size_t              shm_size;           /* Size of the shared-memory page tier (0 if not in use) */
+    struct H5PB_shm_t   *shm;               /* Shared-memory page tier, shared with other processes on the node */
+
     /* Statistics */
     unsigned            accesses[2];
     unsigned            hits[2];
     unsigned            misses[2];
     unsigned            evictions[2];
     unsigned            bypasses[2];
+    unsigned            shm_hits[2];        /* Hits satisfied from the shared-memory page tier */
+    unsigned            writes[2];          /* Dirty pages written to the file */
+    double              write_time;         /* Time spent writing dirty pages, in seconds */
 } H5PB_t;
 
 /*****************************/
@@ -85,7 +111,8 @@ typedef struct H5PB_t {
 /***************************************/
 
 /* General routines */
-H5_DLL herr_t H5PB_create(H5F_t *file, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc);
+H5_DLL herr_t H5PB_create(H5F_t *file, size_t page_buffer_size, unsigned page_buf_min_meta_perc, unsigned page_buf_min_raw_perc,
+    size_t page_buf_shared_size, H5F_page_buffer_policy_t page_buf_policy);
 H5_DLL herr_t H5PB_flush(const H5F_io_info2_t *fio_info);
 H5_DLL herr_t H5PB_dest(const H5F_io_info2_t *fio_info);
 H5_DLL herr_t H5PB_add_new_page(H5F_t *f, H5FD_mem_t type, haddr_t page_addr);
@@ -99,7 +126,8 @@ H5_DLL herr_t H5PB_write(const H5F_io_info2_t *f, H5FD_mem_t type, haddr_t addr,
 /* Statistics routines */
 H5_DLL herr_t H5PB_reset_stats(H5PB_t *page_buf);
 H5_DLL herr_t H5PB_get_stats(const H5PB_t *page_buf, unsigned accesses[2],
-    unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+    unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2],
+    double hit_ratios[2], unsigned writes[2], double *write_time);
 H5_DLL herr_t H5PB_print_stats(const H5PB_t *page_buf);
 
 #endif /* !_H5PBprivate_H */
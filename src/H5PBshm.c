@@ -0,0 +1,610 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:             H5PBshm.c
+ *
+ * Purpose:             Shared-memory page tier for the page buffer.
+ *
+ *                      Processes on one node that open the same file
+ *                      read-only attach to one POSIX shared-memory
+ *                      segment, named after the identity of the file
+ *                      (device, inode, size, and modification and change
+ *                      times to the nanosecond where the platform keeps
+ *                      them) and the file space page size.  Pages read
+ *                      from the file by one process are published in the
+ *                      segment, so that the others find them there
+ *                      instead of reading them from the file again.
+ *
+ *                      The segment is a direct-mapped table of page
+ *                      slots.  Each slot carries a sequence number that
+ *                      is odd while the slot is being written and is
+ *                      bumped again once the write is complete, so that
+ *                      lookups never take a lock: a reader copies the
+ *                      page out and then checks that the sequence number
+ *                      did not change under it.  Publishing a page never
+ *                      waits either; a slot that is being written by
+ *                      another process is simply skipped.
+ *
+ *                      The segment header holds the process IDs of the
+ *                      processes attached to it.  The last one to detach
+ *                      removes the segment.  A process that exits without
+ *                      closing the file leaves its ID behind, so when a
+ *                      file is opened, the IDs of processes that no longer
+ *                      exist are cleared, and segments for the file that
+ *                      no live process is attached to are removed.
+ *
+ *                      SWMR readers don't use the shared tier.  While a
+ *                      SWMR writer has the file open, only SWMR readers
+ *                      can open it, so they would be the only ones to
+ *                      publish pages, and those pages go stale as soon as
+ *                      the writer rewrites them.  The writer isn't
+ *                      attached to the segment to mark the pages it
+ *                      writes, and a reader could only check a page's
+ *                      version by reading the page from the file, which
+ *                      is what the tier is meant to avoid.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5PBmodule.h"         /* This source code file is part of the H5PB module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fprivate.h"		/* Files				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5PBpkg.h"            /* Page buffer				*/
+
+#if defined(H5PB_HAVE_SHM) && defined(__linux__)
+#include <dirent.h>
+#endif
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Signature and version of the shared segment layout */
+#define H5PB_SHM_MAGIC          0x53425048      /* "HPBS" */
+#define H5PB_SHM_VERSION        2
+
+/* Maximum number of processes attached to a segment */
+#define H5PB_SHM_MAX_OWNERS     64
+
+/* Alignment of the slot table and page images in the segment */
+#define H5PB_SHM_ALIGN          64
+#define H5PB_SHM_ROUND(X)       ((((X) + H5PB_SHM_ALIGN) - 1) & ~((size_t)H5PB_SHM_ALIGN - 1))
+
+/* Maximum length of a segment name */
+#define H5PB_SHM_NAME_LEN       128
+
+/* Nanoseconds of a file's modification and change times, where the
+ * platform's stat structure has them
+ */
+#if defined(__APPLE__)
+#define H5PB_SHM_MTIME_NSEC(SB) ((SB).st_mtimespec.tv_nsec)
+#define H5PB_SHM_CTIME_NSEC(SB) ((SB).st_ctimespec.tv_nsec)
+#elif defined(__linux__) || (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200809L)
+#define H5PB_SHM_MTIME_NSEC(SB) ((SB).st_mtim.tv_nsec)
+#define H5PB_SHM_CTIME_NSEC(SB) ((SB).st_ctim.tv_nsec)
+#else
+#define H5PB_SHM_MTIME_NSEC(SB) 0
+#define H5PB_SHM_CTIME_NSEC(SB) 0
+#endif
+
+/* Directory where POSIX shared-memory segments appear as files */
+#define H5PB_SHM_DIR            "/dev/shm"
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+#ifdef H5PB_HAVE_SHM
+/* Header at the beginning of a shared segment */
+typedef struct H5PB_shm_hdr_t {
+    volatile uint32_t magic;            /* H5PB_SHM_MAGIC, once the segment is initialized */
+    uint32_t version;                   /* Version of the segment layout */
+    uint64_t page_size;                 /* Size of the pages held */
+    uint64_t nslots;                    /* Number of page slots */
+    volatile int32_t owners[H5PB_SHM_MAX_OWNERS]; /* IDs of the processes attached, 0 if unused */
+} H5PB_shm_hdr_t;
+
+/* A page slot in a shared segment */
+typedef struct H5PB_shm_slot_t {
+    volatile uint64_t seq;              /* Version of the slot: 0 if empty, odd while being written */
+    volatile uint64_t addr;             /* Address of the page held */
+} H5PB_shm_slot_t;
+#endif /* H5PB_HAVE_SHM */
+
+/* Per-process view of a shared segment */
+typedef struct H5PB_shm_t {
+    char        name[H5PB_SHM_NAME_LEN];        /* Name of the segment */
+    void        *base;                  /* Start of the mapping */
+    size_t      seg_size;               /* Size of the mapping */
+    size_t      page_size;              /* Size of the pages held */
+    uint64_t    nslots;                 /* Number of page slots */
+    int32_t     owner;                  /* ID of this process, as attached */
+    unsigned    owner_idx;              /* Index of this process in the owner table */
+#ifdef H5PB_HAVE_SHM
+    H5PB_shm_hdr_t  *hdr;               /* Segment header */
+    H5PB_shm_slot_t *slots;             /* Slot table */
+    uint8_t     *data;                  /* Page images */
+#endif /* H5PB_HAVE_SHM */
+} H5PB_shm_t;
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+#ifdef H5PB_HAVE_SHM
+static unsigned H5PB__shm_reap(H5PB_shm_hdr_t *hdr);
+static void H5PB__shm_remove_if_stale(const char *name);
+static void H5PB__shm_remove_stale(const char *prefix, const char *keep);
+#endif /* H5PB_HAVE_SHM */
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5PB_shm_t struct */
+H5FL_DEFINE_STATIC(H5PB_shm_t);
+
+
+#ifdef H5PB_HAVE_SHM
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_reap
+ *
+ * Purpose:	Clear the IDs of processes that no longer exist from the
+ *              owner table of a segment.
+ *
+ * Return:	The number of processes still attached
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+H5PB__shm_reap(H5PB_shm_hdr_t *hdr)
+{
+    unsigned    nlive = 0;              /* # of live owners */
+    unsigned    u;                      /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < H5PB_SHM_MAX_OWNERS; u++) {
+        int32_t pid = hdr->owners[u];
+
+        if(0 == pid)
+            continue;
+        if(0 == HDkill((pid_t)pid, 0) || EPERM == errno)
+            nlive++;
+        else
+            __sync_bool_compare_and_swap(&hdr->owners[u], pid, 0);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(nlive)
+} /* end H5PB__shm_reap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_remove_if_stale
+ *
+ * Purpose:	Remove a segment that no live process is attached to.
+ *              Segments that aren't initialized yet, or have another
+ *              layout, are left alone.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PB__shm_remove_if_stale(const char *name)
+{
+    H5PB_shm_hdr_t *hdr;                /* Segment header */
+    h5_stat_t   seg_sb;                 /* Info about the segment */
+    int         fd;                     /* Segment descriptor */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if((fd = HDshm_open(name, O_RDWR, 0)) >= 0) {
+        if(HDfstat(fd, &seg_sb) == 0 && (size_t)seg_sb.st_size >= sizeof(H5PB_shm_hdr_t)
+                && MAP_FAILED != (hdr = (H5PB_shm_hdr_t *)HDmmap(NULL, sizeof(H5PB_shm_hdr_t),
+                        PROT_READ | PROT_WRITE, MAP_SHARED, fd, (HDoff_t)0))) {
+            __sync_synchronize();
+            if(H5PB_SHM_MAGIC == hdr->magic && H5PB_SHM_VERSION == hdr->version
+                    && 0 == H5PB__shm_reap(hdr))
+                HDshm_unlink(name);
+            HDmunmap(hdr, sizeof(H5PB_shm_hdr_t));
+        } /* end if */
+        HDclose(fd);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__shm_remove_if_stale() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_remove_stale
+ *
+ * Purpose:	Remove the stale segments whose names start with PREFIX,
+ *              other than KEEP.  These are the segments of other versions
+ *              of a file, left behind by processes that exited without
+ *              closing the file.
+ *
+ *              Segments can only be listed where they appear as files in
+ *              H5PB_SHM_DIR, so this does nothing on other platforms.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5PB__shm_remove_stale(const char *prefix, const char *keep)
+{
+#ifdef __linux__
+    DIR         *dirp;                  /* Directory of segments */
+    struct dirent *dp;                  /* Directory entry */
+    size_t      prefix_len;             /* Length of the prefix, without the '/' */
+    char        name[H5PB_SHM_NAME_LEN];        /* Name of a segment */
+#endif /* __linux__ */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef __linux__
+    HDassert('/' == prefix[0] && '/' == keep[0]);
+    prefix_len = HDstrlen(prefix + 1);
+    if(NULL != (dirp = HDopendir(H5PB_SHM_DIR))) {
+        while(NULL != (dp = HDreaddir(dirp))) {
+            if(HDstrncmp(dp->d_name, prefix + 1, prefix_len) || !HDstrcmp(dp->d_name, keep + 1))
+                continue;
+            if(HDstrlen(dp->d_name) + 2 > sizeof(name))
+                continue;
+            HDsnprintf(name, sizeof(name), "/%s", dp->d_name);
+            H5PB__shm_remove_if_stale(name);
+        } /* end while */
+        HDclosedir(dirp);
+    } /* end if */
+#endif /* __linux__ */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__shm_remove_stale() */
+#endif /* H5PB_HAVE_SHM */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_open
+ *
+ * Purpose:	Attach to the shared-memory page tier for a file, creating
+ *              the segment if this is the first process to use it.
+ *
+ *              The shared tier is an optimization, so failing to set it
+ *              up is not an error: if the file is opened for writing or
+ *              by a SWMR reader, is not a regular file on this node, the
+ *              segment can't be created or mapped, or too many processes
+ *              are attached to it, *SHM_PTR is set to NULL and the page
+ *              buffer works as usual.
+ *
+ *              A segment for the file that no live process is attached to
+ *              is removed and created again, since a process that was
+ *              writing a page slot when it died leaves the slot busy.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB__shm_open(const H5F_t *f, size_t shm_size, size_t page_size,
+    H5PB_shm_t **shm_ptr)
+{
+#ifdef H5PB_HAVE_SHM
+    H5PB_shm_t *shm = NULL;             /* Shared tier being set up */
+    h5_stat_t   sb;                     /* Info about the file */
+    unsigned    intent;                 /* File access flags */
+    size_t      data_off;               /* Offset of the page images in the segment */
+    char        prefix[H5PB_SHM_NAME_LEN];      /* Start of the names of the file's segments */
+    hbool_t     created = FALSE;        /* Whether this process created the segment */
+    hbool_t     retried = FALSE;        /* Whether a stale segment was replaced */
+    unsigned    u;                      /* Local index variable */
+    int         fd = -1;                /* Segment descriptor */
+#endif /* H5PB_HAVE_SHM */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(page_size > 0);
+    HDassert(shm_ptr);
+
+    *shm_ptr = NULL;
+
+#ifdef H5PB_HAVE_SHM
+    /* Only processes that open the file read-only, and not for SWMR, share
+     * its pages
+     */
+    intent = H5F_INTENT(f);
+    if(intent & (H5F_ACC_RDWR | H5F_ACC_SWMR_READ))
+        HGOTO_DONE(SUCCEED)
+
+    /* Identify the file */
+    if(NULL == H5F_OPEN_NAME(f) || HDstat(H5F_OPEN_NAME(f), &sb) < 0 || !S_ISREG(sb.st_mode))
+        HGOTO_DONE(SUCCEED)
+
+    /* Compute the geometry of the segment */
+    if(shm_size <= H5PB_SHM_ROUND(sizeof(H5PB_shm_hdr_t)) + H5PB_SHM_ALIGN + sizeof(H5PB_shm_slot_t) + page_size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Set up the shared tier info */
+    if(NULL == (shm = H5FL_CALLOC(H5PB_shm_t)))
+        HGOTO_ERROR(H5E_PAGEBUF, H5E_NOSPACE, FAIL, "memory allocation failed")
+    shm->page_size = page_size;
+    shm->owner = (int32_t)HDgetpid();
+    HDsnprintf(prefix, sizeof(prefix), "/hdf5-pb-%llx-%llx-",
+            (unsigned long long)sb.st_dev, (unsigned long long)sb.st_ino);
+    HDsnprintf(shm->name, sizeof(shm->name), "%s%llx-%llx.%lx-%llx.%lx-%llx", prefix,
+            (unsigned long long)sb.st_size,
+            (unsigned long long)sb.st_mtime, (unsigned long)H5PB_SHM_MTIME_NSEC(sb),
+            (unsigned long long)sb.st_ctime, (unsigned long)H5PB_SHM_CTIME_NSEC(sb),
+            (unsigned long long)page_size);
+
+    /* Remove the segments of other versions of the file that were left
+     * behind
+     */
+    H5PB__shm_remove_stale(prefix, shm->name);
+
+retry:
+    shm->nslots = (uint64_t)((shm_size - H5PB_SHM_ROUND(sizeof(H5PB_shm_hdr_t)) - H5PB_SHM_ALIGN) /
+            (page_size + sizeof(H5PB_shm_slot_t)));
+    data_off = H5PB_SHM_ROUND(H5PB_SHM_ROUND(sizeof(H5PB_shm_hdr_t)) + (size_t)shm->nslots * sizeof(H5PB_shm_slot_t));
+    shm->seg_size = data_off + (size_t)shm->nslots * page_size;
+
+    /* Attach to the segment, or create it */
+    if((fd = HDshm_open(shm->name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) >= 0) {
+        created = TRUE;
+        if(HDftruncate(fd, (HDoff_t)shm->seg_size) < 0) {
+            HDshm_unlink(shm->name);
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+    else if(EEXIST != errno || (fd = HDshm_open(shm->name, O_RDWR, 0)) < 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Make sure an existing segment has been sized by its creator */
+    if(!created) {
+        h5_stat_t seg_sb;
+
+        if(HDfstat(fd, &seg_sb) < 0 || (size_t)seg_sb.st_size < sizeof(H5PB_shm_hdr_t))
+            HGOTO_DONE(SUCCEED)
+        shm->seg_size = (size_t)seg_sb.st_size;
+    } /* end if */
+
+    /* Map the segment */
+    if(MAP_FAILED == (shm->base = HDmmap(NULL, shm->seg_size,
+            PROT_READ | PROT_WRITE, MAP_SHARED, fd, (HDoff_t)0))) {
+        shm->base = NULL;
+        if(created)
+            HDshm_unlink(shm->name);
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    shm->hdr = (H5PB_shm_hdr_t *)shm->base;
+
+    /* Initialize a new segment, with this process attached, publishing the
+     * signature last
+     */
+    if(created) {
+        shm->hdr->version = H5PB_SHM_VERSION;
+        shm->hdr->page_size = (uint64_t)page_size;
+        shm->hdr->nslots = shm->nslots;
+        for(u = 0; u < H5PB_SHM_MAX_OWNERS; u++)
+            shm->hdr->owners[u] = 0;
+        shm->hdr->owners[0] = shm->owner;
+        shm->owner_idx = 0;
+        __sync_synchronize();
+        shm->hdr->magic = H5PB_SHM_MAGIC;
+    } /* end if */
+    /* Check the layout of an existing segment, which may have been created
+     * with a different size
+     */
+    else {
+        __sync_synchronize();
+        if(H5PB_SHM_MAGIC != shm->hdr->magic || H5PB_SHM_VERSION != shm->hdr->version
+                || (uint64_t)page_size != shm->hdr->page_size || 0 == shm->hdr->nslots)
+            HGOTO_DONE(SUCCEED)
+
+        /* Replace a segment that was left behind, once */
+        if(0 == H5PB__shm_reap(shm->hdr)) {
+            HDmunmap(shm->base, shm->seg_size);
+            shm->base = NULL;
+            HDclose(fd);
+            fd = -1;
+            if(retried)
+                HGOTO_DONE(SUCCEED)
+            HDshm_unlink(shm->name);
+            retried = TRUE;
+            goto retry;
+        } /* end if */
+
+        shm->nslots = shm->hdr->nslots;
+        data_off = H5PB_SHM_ROUND(H5PB_SHM_ROUND(sizeof(H5PB_shm_hdr_t)) + (size_t)shm->nslots * sizeof(H5PB_shm_slot_t));
+        if(data_off + (size_t)shm->nslots * page_size > shm->seg_size)
+            HGOTO_DONE(SUCCEED)
+
+        /* Attach this process */
+        for(u = 0; u < H5PB_SHM_MAX_OWNERS; u++)
+            if(__sync_bool_compare_and_swap(&shm->hdr->owners[u], 0, shm->owner))
+                break;
+        if(u == H5PB_SHM_MAX_OWNERS)
+            HGOTO_DONE(SUCCEED)
+        shm->owner_idx = u;
+    } /* end else */
+    shm->slots = (H5PB_shm_slot_t *)((uint8_t *)shm->base + H5PB_SHM_ROUND(sizeof(H5PB_shm_hdr_t)));
+    shm->data = (uint8_t *)shm->base + data_off;
+
+    /* Success */
+    *shm_ptr = shm;
+
+done:
+    if(fd >= 0)
+        HDclose(fd);
+    if(NULL == *shm_ptr && shm) {
+        if(shm->base)
+            HDmunmap(shm->base, shm->seg_size);
+        shm = H5FL_FREE(H5PB_shm_t, shm);
+    } /* end if */
+#endif /* H5PB_HAVE_SHM */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__shm_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_close
+ *
+ * Purpose:	Detach from the shared-memory page tier.  The last process
+ *              to detach removes the segment.  A child process that
+ *              inherited the mapping from its parent only unmaps it, since
+ *              the entry in the owner table is the parent's.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB__shm_close(H5PB_shm_t *shm)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity check */
+    HDassert(shm);
+
+#ifdef H5PB_HAVE_SHM
+    if(shm->owner == (int32_t)HDgetpid()
+            && __sync_bool_compare_and_swap(&shm->hdr->owners[shm->owner_idx], shm->owner, 0)
+            && 0 == H5PB__shm_reap(shm->hdr))
+        HDshm_unlink(shm->name);
+    HDmunmap(shm->base, shm->seg_size);
+#endif /* H5PB_HAVE_SHM */
+
+    shm = H5FL_FREE(H5PB_shm_t, shm);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB__shm_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_read
+ *
+ * Purpose:	Look up a page in the shared-memory page tier and copy it
+ *              into PAGE_BUF, which must hold a full page.
+ *
+ * Return:	TRUE if the page was found, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5PB__shm_read(H5PB_shm_t *shm, haddr_t page_addr, void *page_buf/*out*/)
+{
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(shm);
+    HDassert(page_buf);
+    HDassert(0 == page_addr % shm->page_size);
+
+#ifdef H5PB_HAVE_SHM
+{
+    uint64_t idx = ((uint64_t)page_addr / shm->page_size) % shm->nslots;
+    H5PB_shm_slot_t *slot = &shm->slots[idx];
+    uint64_t seq;
+
+    /* Snapshot the slot's version, then copy the page out and make sure
+     * nobody wrote the slot in the meantime
+     */
+    seq = slot->seq;
+    __sync_synchronize();
+    if(0 != seq && !(seq & 1) && (uint64_t)page_addr == slot->addr) {
+        HDmemcpy(page_buf, shm->data + (size_t)idx * shm->page_size, shm->page_size);
+        __sync_synchronize();
+        ret_value = (hbool_t)(seq == slot->seq);
+    } /* end if */
+}
+#endif /* H5PB_HAVE_SHM */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__shm_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__shm_write
+ *
+ * Purpose:	Publish a full page read from the file in the shared-memory
+ *              page tier, replacing whatever page its slot held.  Nothing
+ *              is done if another process is writing the slot.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5PB__shm_write(H5PB_shm_t *shm, haddr_t page_addr, const void *page_buf)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(shm);
+    HDassert(page_buf);
+    HDassert(0 == page_addr % shm->page_size);
+
+#ifdef H5PB_HAVE_SHM
+    {
+        uint64_t idx = ((uint64_t)page_addr / shm->page_size) % shm->nslots;
+        H5PB_shm_slot_t *slot = &shm->slots[idx];
+        uint64_t seq = slot->seq;
+
+        /* Claim the slot by making its version odd, unless it is busy or
+         * already holds the page
+         */
+        if(!(seq & 1) && !(0 != seq && (uint64_t)page_addr == slot->addr)
+                && __sync_bool_compare_and_swap(&slot->seq, seq, seq + 1)) {
+            slot->addr = (uint64_t)page_addr;
+            HDmemcpy(shm->data + (size_t)idx * shm->page_size, page_buf, shm->page_size);
+            __sync_synchronize();
+            slot->seq = seq + 2;
+        } /* end if */
+    }
+#endif /* H5PB_HAVE_SHM */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5PB__shm_write() */
@@ -83,6 +83,9 @@
 /* Definitions for vlen free info property */
 #define H5D_XFER_VLEN_FREE_INFO_SIZE    sizeof(void *)
 #define H5D_XFER_VLEN_FREE_INFO_DEF     H5D_VLEN_FREE_INFO
+/* Definitions for VL arena property */
+#define H5D_XFER_VLEN_ARENA_SIZE        sizeof(H5D_vlen_arena_t *)
+#define H5D_XFER_VLEN_ARENA_DEF         H5D_VLEN_ARENA
 /* Definitions for hyperslab vector size property */
 /* (Be cautious about increasing the default size, there are arrays allocated
  *      on the stack which depend on it - QAK)
@@ -270,6 +273,7 @@ static const H5MM_allocate_t H5D_def_vlen_alloc_g = H5D_XFER_VLEN_ALLOC_DEF;   /
 static const void *H5D_def_vlen_alloc_info_g = H5D_XFER_VLEN_ALLOC_INFO_DEF;   /* Default value for vlen allocation information */
 static const H5MM_free_t H5D_def_vlen_free_g = H5D_XFER_VLEN_FREE_DEF;         /* Default value for vlen free function */
 static const void *H5D_def_vlen_free_info_g = H5D_XFER_VLEN_FREE_INFO_DEF;     /* Default value for vlen free information */
+static const H5D_vlen_arena_t *H5D_def_vlen_arena_g = H5D_XFER_VLEN_ARENA_DEF;  /* Default value for vlen arena */
 static const size_t H5D_def_hyp_vec_size_g = H5D_XFER_HYPER_VECTOR_SIZE_DEF;   /* Default value for vector size */
 static const haddr_t H5D_def_tag_g = H5AC_TAG_DEF;                              /* Default value for cache entry tag */
 static const H5FD_mpio_xfer_t H5D_def_io_xfer_mode_g = H5D_XFER_IO_XFER_MODE_DEF;      /* Default value for I/O transfer mode */
@@ -376,6 +380,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the vlen arena property */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_VLEN_ARENA_NAME, H5D_XFER_VLEN_ARENA_SIZE, &H5D_def_vlen_arena_g, 
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the vector size property */
     if(H5P_register_real(pclass, H5D_XFER_HYPER_VECTOR_SIZE_NAME, H5D_XFER_HYPER_VECTOR_SIZE_SIZE, &H5D_def_hyp_vec_size_g, 
             NULL, NULL, NULL, H5D_XFER_HYPER_VECTOR_SIZE_ENC, H5D_XFER_HYPER_VECTOR_SIZE_DEC,
@@ -1754,6 +1764,74 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_vlen_mem_manager() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_vlen_arena
+ *
+ * Purpose:	Sets the arena (created with H5Dvlen_arena_create()) that VL
+ *		data read with this property list is allocated from.  This
+ *		takes the place of the allocate/free pair set with
+ *		H5Pset_vlen_mem_manager(): the data is released all at once
+ *		with H5Dvlen_arena_free() and H5Dvlen_reclaim() leaves it
+ *		alone.  Call this routine with ARENA set to NULL to go back
+ *		to the allocate/free pair.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_vlen_arena(hid_t plist_id, H5D_vlen_arena_t *arena)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", plist_id, arena);
+
+    /* Check arguments */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_VLEN_ARENA_NAME, &arena) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_vlen_arena() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_vlen_arena
+ *
+ * Purpose:	The inverse of H5Pset_vlen_arena()
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_vlen_arena(hid_t plist_id, H5D_vlen_arena_t **arena/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, arena);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    if(arena)
+        if(H5P_get(plist, H5D_XFER_VLEN_ARENA_NAME, arena) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_vlen_arena() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_hyper_vector_size
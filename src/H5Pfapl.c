@@ -176,6 +176,11 @@
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF       524288
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_ENC       H5P__encode_size_t
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEC       H5P__decode_size_t
+/* Definition of core VFD lazy load flag */
+#define H5F_ACS_CORE_LAZY_LOAD_FLAG_SIZE        sizeof(hbool_t)
+#define H5F_ACS_CORE_LAZY_LOAD_FLAG_DEF         FALSE
+#define H5F_ACS_CORE_LAZY_LOAD_FLAG_ENC         H5P__encode_hbool_t
+#define H5F_ACS_CORE_LAZY_LOAD_FLAG_DEC         H5P__decode_hbool_t
 /* Definition for # of metadata read attempts */
 #define H5F_ACS_METADATA_READ_ATTEMPTS_SIZE	sizeof(unsigned)
 #define H5F_ACS_METADATA_READ_ATTEMPTS_DEF     	0
@@ -244,6 +249,26 @@
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF            0
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC            H5P__encode_unsigned
 #define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC            H5P__decode_unsigned
+/* Definition for the size of the shared-memory page buffer tier */
+#define H5F_ACS_PAGE_BUFFER_SHARED_SIZE_SIZE    sizeof(size_t)
+#define H5F_ACS_PAGE_BUFFER_SHARED_SIZE_DEF     0
+#define H5F_ACS_PAGE_BUFFER_SHARED_SIZE_ENC     H5P__encode_size_t
+#define H5F_ACS_PAGE_BUFFER_SHARED_SIZE_DEC     H5P__decode_size_t
+/* Definition for the page buffer replacement policy */
+#define H5F_ACS_PAGE_BUFFER_POLICY_SIZE         sizeof(H5F_page_buffer_policy_t)
+#define H5F_ACS_PAGE_BUFFER_POLICY_DEF          H5F_PAGE_BUFFER_POLICY_LRU
+#define H5F_ACS_PAGE_BUFFER_POLICY_ENC          H5P__facc_page_buffer_policy_enc
+#define H5F_ACS_PAGE_BUFFER_POLICY_DEC          H5P__facc_page_buffer_policy_dec
+/* Definition for maximum size of a metadata read-ahead request (bytes) */
+#define H5F_ACS_META_READ_AHEAD_SIZE_SIZE       sizeof(size_t)
+#define H5F_ACS_META_READ_AHEAD_SIZE_DEF        0
+#define H5F_ACS_META_READ_AHEAD_SIZE_ENC        H5P__encode_size_t
+#define H5F_ACS_META_READ_AHEAD_SIZE_DEC        H5P__decode_size_t
+/* Definition for reserving file space for all chunks of an early allocation at once */
+#define H5F_ACS_CHUNK_ALLOC_RESERVE_SIZE        sizeof(hbool_t)
+#define H5F_ACS_CHUNK_ALLOC_RESERVE_DEF         FALSE
+#define H5F_ACS_CHUNK_ALLOC_RESERVE_ENC         H5P__encode_hbool_t
+#define H5F_ACS_CHUNK_ALLOC_RESERVE_DEC         H5P__decode_hbool_t
 
 
 /******************/
@@ -290,6 +315,8 @@ static herr_t H5P__facc_fclose_degree_enc(const void *value, void **_pp, size_t
 static herr_t H5P__facc_fclose_degree_dec(const void **pp, void *value);
 static herr_t H5P__facc_multi_type_enc(const void *value, void **_pp, size_t *size);
 static herr_t H5P__facc_multi_type_dec(const void **_pp, void *value);
+static herr_t H5P__facc_page_buffer_policy_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__facc_page_buffer_policy_dec(const void **_pp, void *value);
 
 /* Metadata cache log location property callbacks */
 static herr_t H5P_facc_mdc_log_location_enc(const void *value, void **_pp, size_t *size);
@@ -360,6 +387,7 @@ static const unsigned H5F_def_efc_size_g = H5F_ACS_EFC_SIZE_DEF;
 static const H5FD_file_image_info_t H5F_def_file_image_info_g = H5F_ACS_FILE_IMAGE_INFO_DEF;                 /* Default file image info and callbacks */
 static const hbool_t H5F_def_core_write_tracking_flag_g = H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEF;              /* Default setting for core VFD write tracking */
 static const size_t H5F_def_core_write_tracking_page_size_g = H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF;     /* Default core VFD write tracking page size */
+static const hbool_t H5F_def_core_lazy_load_flag_g = H5F_ACS_CORE_LAZY_LOAD_FLAG_DEF;                        /* Default setting for core VFD lazy loading */
 static const unsigned H5F_def_metadata_read_attempts_g = H5F_ACS_METADATA_READ_ATTEMPTS_DEF;  /* Default setting for the # of metadata read attempts */
 static const H5F_object_flush_t H5F_def_object_flush_cb_g = H5F_ACS_OBJECT_FLUSH_CB_DEF;      /* Default setting for object flush callback */
 static const hbool_t H5F_def_clear_status_flags_g = H5F_ACS_CLEAR_STATUS_FLAGS_DEF;           /* Default to clear the superblock status_flags */
@@ -375,6 +403,10 @@ static const H5AC_cache_image_config_t H5F_def_mdc_initCacheImageCfg_g = H5F_ACS
 static const size_t H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF;      /* Default page buffer size */
 static const unsigned H5F_def_page_buf_min_meta_perc_g = H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF;      /* Default page buffer minimum metadata size */
 static const unsigned H5F_def_page_buf_min_raw_perc_g = H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF;      /* Default page buffer minumum raw data size */
+static const size_t H5F_def_page_buf_shared_size_g = H5F_ACS_PAGE_BUFFER_SHARED_SIZE_DEF;      /* Default shared-memory page buffer tier size */
+static const H5F_page_buffer_policy_t H5F_def_page_buf_policy_g = H5F_ACS_PAGE_BUFFER_POLICY_DEF;      /* Default page buffer replacement policy */
+static const size_t H5F_def_meta_read_ahead_size_g = H5F_ACS_META_READ_AHEAD_SIZE_DEF;      /* Default metadata read-ahead size */
+static const hbool_t H5F_def_chunk_alloc_reserve_g = H5F_ACS_CHUNK_ALLOC_RESERVE_DEF;      /* Default chunk allocation reservation flag */
 
 
 /*-------------------------------------------------------------------------
@@ -531,6 +563,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the core VFD lazy load flag */
+    if(H5P_register_real(pclass, H5F_ACS_CORE_LAZY_LOAD_FLAG_NAME, H5F_ACS_CORE_LAZY_LOAD_FLAG_SIZE, &H5F_def_core_lazy_load_flag_g, 
+            NULL, NULL, NULL, H5F_ACS_CORE_LAZY_LOAD_FLAG_ENC, H5F_ACS_CORE_LAZY_LOAD_FLAG_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the # of read attempts */
     if(H5P_register_real(pclass, H5F_ACS_METADATA_READ_ATTEMPTS_NAME, H5F_ACS_METADATA_READ_ATTEMPTS_SIZE, &H5F_def_metadata_read_attempts_g, 
             NULL, NULL, NULL, H5F_ACS_METADATA_READ_ATTEMPTS_ENC, H5F_ACS_METADATA_READ_ATTEMPTS_DEC, 
@@ -605,6 +643,28 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC, 
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    /* Register the size of the shared-memory page buffer tier */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_NAME, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_SIZE, &H5F_def_page_buf_shared_size_g, 
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_ENC, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    /* Register the page buffer replacement policy */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_POLICY_NAME, H5F_ACS_PAGE_BUFFER_POLICY_SIZE, &H5F_def_page_buf_policy_g, 
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_POLICY_ENC, H5F_ACS_PAGE_BUFFER_POLICY_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the maximum size of a metadata read-ahead request */
+    if(H5P_register_real(pclass, H5F_ACS_META_READ_AHEAD_SIZE_NAME, H5F_ACS_META_READ_AHEAD_SIZE_SIZE, &H5F_def_meta_read_ahead_size_g, 
+            NULL, NULL, NULL, H5F_ACS_META_READ_AHEAD_SIZE_ENC, H5F_ACS_META_READ_AHEAD_SIZE_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the chunk allocation reservation flag */
+    if(H5P_register_real(pclass, H5F_ACS_CHUNK_ALLOC_RESERVE_NAME, H5F_ACS_CHUNK_ALLOC_RESERVE_SIZE, &H5F_def_chunk_alloc_reserve_g, 
+            NULL, NULL, NULL, H5F_ACS_CHUNK_ALLOC_RESERVE_ENC, H5F_ACS_CHUNK_ALLOC_RESERVE_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -3720,6 +3780,73 @@ H5P__facc_fclose_degree_dec(const void **_pp, void *_value)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_fclose_degree_dec() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_page_buffer_policy_enc
+ *
+ * Purpose:        Callback routine which is called whenever the page
+ *                 buffer replacement policy property in the file access
+ *                 property list is encoded.
+ *
+ * Return:	   Success:	Non-negative
+ *		   Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_page_buffer_policy_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5F_page_buffer_policy_t *policy = (const H5F_page_buffer_policy_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(policy);
+    HDassert(size);
+
+    if(NULL != *pp)
+        /* Encode page buffer policy */
+        *(*pp)++ = (uint8_t)*policy;
+
+    /* Size of page buffer policy */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_page_buffer_policy_enc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_page_buffer_policy_dec
+ *
+ * Purpose:        Callback routine which is called whenever the page
+ *                 buffer replacement policy property in the file access
+ *                 property list is decoded.
+ *
+ * Return:	   Success:	Non-negative
+ *		   Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_page_buffer_policy_dec(const void **_pp, void *_value)
+{
+    H5F_page_buffer_policy_t *policy = (H5F_page_buffer_policy_t *)_value;     /* Page buffer policy */
+    const uint8_t **pp = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(policy);
+
+    /* Decode page buffer policy */
+    *policy = (H5F_page_buffer_policy_t)*(*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_page_buffer_policy_dec() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P__facc_multi_type_enc
@@ -3876,6 +4003,74 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_core_write_tracking() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_core_lazy_load
+ *
+ * Purpose:	Enables/disables lazy loading of existing files opened with
+ *              the core VFD.  When enabled, the backing store is read a
+ *              page at a time (using the write tracking page size) as the
+ *              pages are first accessed instead of all at once when the
+ *              file is opened, and only the dirty pages are written back.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_lazy_load(hid_t plist_id, hbool_t is_enabled)
+{
+    H5P_genplist_t *plist;        /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, is_enabled);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_CORE_LAZY_LOAD_FLAG_NAME, &is_enabled) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD lazy load flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_lazy_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_core_lazy_load
+ *
+ * Purpose:	Gets whether the core VFD loads existing files lazily.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_lazy_load(hid_t plist_id, hbool_t *is_enabled)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*b", plist_id, is_enabled);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(is_enabled) {
+        if(H5P_get(plist, H5F_ACS_CORE_LAZY_LOAD_FLAG_NAME, is_enabled) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get core VFD lazy load flag")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_lazy_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_metadata_read_attempts
@@ -4807,3 +5002,302 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_page_buffer_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_page_buffer_shared_size
+ *
+ * Purpose:	Sets the size of the shared-memory tier of the page buffer.
+ *      When a file is opened read-only with page buffering enabled
+ *      (see H5Pset_page_buffer_size), the processes on one node that
+ *      have the same file open share a POSIX shared-memory segment of
+ *      this size, holding pages read from the file.  A page that one
+ *      process has read is then found there by the others, instead of
+ *      being read from the file again.
+ *
+ *      The shared tier is not used for files opened for writing or by
+ *      SWMR readers, whose pages change while they are read, or on
+ *      platforms without POSIX shared memory.  The default value is 0,
+ *      which disables it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_shared_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set size */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared page buffer size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_shared_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_page_buffer_shared_size
+ *
+ * Purpose:	Retrieves the size of the shared-memory tier of the page
+ *      buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_shared_size(hid_t plist_id, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get size */
+    if(size)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_SHARED_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get shared page buffer size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_shared_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_page_buffer_policy
+ *
+ * Purpose:	Sets the replacement policy of the page buffer.
+ *
+ *      H5F_PAGE_BUFFER_POLICY_LRU (the default) evicts the least
+ *      recently used page.  H5F_PAGE_BUFFER_POLICY_2Q keeps pages that
+ *      have been read or written once in a FIFO, and only moves a page to
+ *      the LRU list when it is needed again after it fell out of the
+ *      FIFO.  Pages that are used once, like those of a large raw data
+ *      scan, then cycle through the FIFO without pushing the metadata
+ *      pages the file keeps coming back to out of the page buffer.
+ *
+ *      In both cases, the minimum metadata and raw data fractions set
+ *      with H5Pset_page_buffer_size() are honored.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_policy(hid_t plist_id, H5F_page_buffer_policy_t policy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iFp", plist_id, policy);
+
+    /* Check argument */
+    if(policy < H5F_PAGE_BUFFER_POLICY_LRU || policy >= H5F_PAGE_BUFFER_POLICY_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid page buffer policy")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_page_buffer_policy
+ *
+ * Purpose:	Retrieves the replacement policy of the page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_policy(hid_t plist_id, H5F_page_buffer_policy_t *policy/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, policy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(policy)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_policy() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_meta_read_ahead_size
+ *
+ * Purpose:	Sets the maximum size of a speculative metadata read-ahead
+ *      request.  When a B-tree internal node, an extensible array index
+ *      block or an object header with continuation messages is loaded
+ *      into the metadata cache, the library reads the blocks it refers
+ *      to with one request of up to this many bytes, instead of one
+ *      request per block.  This reduces the number of round trips on
+ *      high-latency storage.
+ *
+ *      The default value is 0, which disables metadata read-ahead.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_meta_read_ahead_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_META_READ_AHEAD_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata read-ahead size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_meta_read_ahead_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_meta_read_ahead_size
+ *
+ * Purpose:	Retrieves the maximum size of a speculative metadata
+ *      read-ahead request.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_meta_read_ahead_size(hid_t plist_id, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(size)
+        if(H5P_get(plist, H5F_ACS_META_READ_AHEAD_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata read-ahead size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_meta_read_ahead_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_alloc_reserve
+ *
+ * Purpose:	Sets whether file space for all the chunks of a dataset
+ *      allocated early (H5D_ALLOC_TIME_EARLY, or when the dataset is
+ *      extended) is reserved with a single file-space allocation, from
+ *      which each chunk is then carved in order.  This replaces one
+ *      file-space allocation per chunk with one per dataset, which is
+ *      most useful for collective dataset creation in parallel, where
+ *      every allocation is replayed on all processes.
+ *
+ *      Datasets with I/O filters and files using paged aggregation
+ *      always allocate chunks individually.  The default is FALSE.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_alloc_reserve(hid_t plist_id, hbool_t reserve)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, reserve);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_CHUNK_ALLOC_RESERVE_NAME, &reserve) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk allocation reservation flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_alloc_reserve() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_alloc_reserve
+ *
+ * Purpose:	Retrieves whether file space for all the chunks of an early
+ *      allocation is reserved at once.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_alloc_reserve(hid_t plist_id, hbool_t *reserve/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, reserve);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(reserve)
+        if(H5P_get(plist, H5F_ACS_CHUNK_ALLOC_RESERVE_NAME, reserve) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk allocation reservation flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_alloc_reserve() */
+
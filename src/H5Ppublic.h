@@ -351,6 +351,8 @@ H5_DLL herr_t H5Pget_file_image_callbacks(hid_t fapl_id,
        H5FD_file_image_callbacks_t *callbacks_ptr);
 H5_DLL herr_t H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled, size_t page_size);
 H5_DLL herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, size_t *page_size);
+H5_DLL herr_t H5Pset_core_lazy_load(hid_t fapl_id, hbool_t is_enabled);
+H5_DLL herr_t H5Pget_core_lazy_load(hid_t fapl_id, hbool_t *is_enabled);
 H5_DLL herr_t H5Pset_metadata_read_attempts(hid_t plist_id, unsigned attempts);
 H5_DLL herr_t H5Pget_metadata_read_attempts(hid_t plist_id, unsigned *attempts);
 H5_DLL herr_t H5Pset_object_flush_cb(hid_t plist_id, H5F_flush_cb_t func, void *udata);
@@ -369,6 +371,14 @@ H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
 H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_per, unsigned min_raw_per);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per, unsigned *min_raw_per);
+H5_DLL herr_t H5Pset_page_buffer_shared_size(hid_t plist_id, size_t size);
+H5_DLL herr_t H5Pget_page_buffer_shared_size(hid_t plist_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_page_buffer_policy(hid_t plist_id, H5F_page_buffer_policy_t policy);
+H5_DLL herr_t H5Pget_page_buffer_policy(hid_t plist_id, H5F_page_buffer_policy_t *policy/*out*/);
+H5_DLL herr_t H5Pset_meta_read_ahead_size(hid_t fapl_id, size_t size);
+H5_DLL herr_t H5Pget_meta_read_ahead_size(hid_t fapl_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_chunk_alloc_reserve(hid_t fapl_id, hbool_t reserve);
+H5_DLL herr_t H5Pget_chunk_alloc_reserve(hid_t fapl_id, hbool_t *reserve/*out*/);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -454,6 +464,8 @@ H5_DLL herr_t H5Pget_vlen_mem_manager(hid_t plist_id,
                                        void **alloc_info,
                                        H5MM_free_t *free_func,
                                        void **free_info);
+H5_DLL herr_t H5Pset_vlen_arena(hid_t plist_id, H5D_vlen_arena_t *arena);
+H5_DLL herr_t H5Pget_vlen_arena(hid_t plist_id, H5D_vlen_arena_t **arena/*out*/);
 H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size/*out*/);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void* operate_data);
@@ -53,6 +53,21 @@
 
 #define H5T_ENCODE_VERSION      0
 
+/* Number of slots in the conversion path cache (a power of two) */
+#define H5T_PATH_CACHE_SIZE     256
+
+/* The conversion path cache slot for a pair of source and destination
+ * type hashes
+ */
+#define H5T_PATH_CACHE_SLOT(SRC_HASH, DST_HASH)                                 \
+    (((SRC_HASH) ^ ((DST_HASH) * 0x9e3779b1U)) & (H5T_PATH_CACHE_SIZE - 1))
+
+/* Forget all cached conversion paths, whenever a path is removed from the
+ * path table
+ */
+#define H5T_PATH_CACHE_RESET()                                                  \
+    HDmemset(H5T_g.path_cache, 0, sizeof(H5T_g.path_cache))
+
 /*
  * Type initialization macros
  *
@@ -119,6 +134,48 @@
     dt->shared->u.atomic.u.f.pad = H5T_PAD_ZERO;			      \
 }
 
+/* Define the code templates for IEEE half-precision floats for the "GUTS" in the H5T_INIT_TYPE macro */
+#define H5T_INIT_TYPE_FLOAT16_COMMON(ENDIANNESS) {			      \
+    H5T_INIT_TYPE_NUM_COMMON(ENDIANNESS)				      \
+    dt->shared->u.atomic.u.f.sign = 15;					      \
+    dt->shared->u.atomic.u.f.epos = 10;					      \
+    dt->shared->u.atomic.u.f.esize = 5;					      \
+    dt->shared->u.atomic.u.f.ebias = 0xf;				      \
+    dt->shared->u.atomic.u.f.mpos = 0;					      \
+    dt->shared->u.atomic.u.f.msize = 10;				      \
+    dt->shared->u.atomic.u.f.norm = H5T_NORM_IMPLIED;			      \
+    dt->shared->u.atomic.u.f.pad = H5T_PAD_ZERO;			      \
+}
+
+#define H5T_INIT_TYPE_FLOAT16LE_CORE {					      \
+    H5T_INIT_TYPE_FLOAT16_COMMON(H5T_ORDER_LE)				      \
+}
+
+#define H5T_INIT_TYPE_FLOAT16BE_CORE {					      \
+    H5T_INIT_TYPE_FLOAT16_COMMON(H5T_ORDER_BE)				      \
+}
+
+/* Define the code templates for bfloat16 floats for the "GUTS" in the H5T_INIT_TYPE macro */
+#define H5T_INIT_TYPE_BFLOAT16_COMMON(ENDIANNESS) {			      \
+    H5T_INIT_TYPE_NUM_COMMON(ENDIANNESS)				      \
+    dt->shared->u.atomic.u.f.sign = 15;					      \
+    dt->shared->u.atomic.u.f.epos = 7;					      \
+    dt->shared->u.atomic.u.f.esize = 8;					      \
+    dt->shared->u.atomic.u.f.ebias = 0x7f;				      \
+    dt->shared->u.atomic.u.f.mpos = 0;					      \
+    dt->shared->u.atomic.u.f.msize = 7;					      \
+    dt->shared->u.atomic.u.f.norm = H5T_NORM_IMPLIED;			      \
+    dt->shared->u.atomic.u.f.pad = H5T_PAD_ZERO;			      \
+}
+
+#define H5T_INIT_TYPE_BFLOAT16LE_CORE {					      \
+    H5T_INIT_TYPE_BFLOAT16_COMMON(H5T_ORDER_LE)				      \
+}
+
+#define H5T_INIT_TYPE_BFLOAT16BE_CORE {					      \
+    H5T_INIT_TYPE_BFLOAT16_COMMON(H5T_ORDER_BE)				      \
+}
+
 #define H5T_INIT_TYPE_DOUBLELE_CORE {					      \
     H5T_INIT_TYPE_DOUBLE_COMMON(H5T_ORDER_LE)				      \
 }
@@ -284,6 +341,7 @@ static herr_t H5T_register(H5T_pers_t pers, const char *name, H5T_t *src,
         H5T_t *dst, H5T_conv_t func, hid_t dxpl_id, hbool_t api_call);
 static htri_t H5T_compiler_conv(H5T_t *src, H5T_t *dst);
 static herr_t H5T_set_size(H5T_t *dt, size_t size);
+static uint32_t H5T_struct_hash(const H5T_t *dt);
 
 
 /*****************************/
@@ -308,11 +366,16 @@ hbool_t H5_PKG_INIT_VAR = FALSE;
  * If more of these are added, the new ones must be added to the list of
  * types to reset in H5T_term_package().
  */
+hid_t H5T_IEEE_F16BE_g			= FAIL;
+hid_t H5T_IEEE_F16LE_g			= FAIL;
 hid_t H5T_IEEE_F32BE_g			= FAIL;
 hid_t H5T_IEEE_F32LE_g			= FAIL;
 hid_t H5T_IEEE_F64BE_g			= FAIL;
 hid_t H5T_IEEE_F64LE_g			= FAIL;
 
+hid_t H5T_FLOAT_BFLOAT16BE_g		= FAIL;
+hid_t H5T_FLOAT_BFLOAT16LE_g		= FAIL;
+
 hid_t H5T_VAX_F32_g			= FAIL;
 hid_t H5T_VAX_F64_g			= FAIL;
 
@@ -367,6 +430,8 @@ hid_t H5T_NATIVE_DOUBLE_g		= FAIL;
 #if H5_SIZEOF_LONG_DOUBLE !=0
 hid_t H5T_NATIVE_LDOUBLE_g		= FAIL;
 #endif
+hid_t H5T_NATIVE_FLOAT16_g		= FAIL;
+hid_t H5T_NATIVE_BFLOAT16_g		= FAIL;
 hid_t H5T_NATIVE_B8_g			= FAIL;
 hid_t H5T_NATIVE_B16_g			= FAIL;
 hid_t H5T_NATIVE_B32_g			= FAIL;
@@ -453,6 +518,15 @@ size_t H5T_NATIVE_DOUBLE_ALIGN_g	= 0;
 size_t H5T_NATIVE_LDOUBLE_ALIGN_g	= 0;
 #endif
 
+/*
+ * Alignment constraints for the 16-bit float types, which are held in
+ * memory as uint16_t.  These are set in H5T__init_package() and checked
+ * by the FLOAT16 and BFLOAT16 hard conversions in H5Tconv.c, where the
+ * H5T_CONV macro pastes the type name into H5T_NATIVE_<type>_ALIGN_g.
+ */
+size_t H5T_NATIVE_FLOAT16_ALIGN_g	= 0;
+size_t H5T_NATIVE_BFLOAT16_ALIGN_g	= 0;
+
 /*
  * Alignment constraints for C9x types. These are initialized at run time in
  * H5Tinit.c if the types are provided by the system. Otherwise we set their
@@ -513,6 +587,7 @@ static struct {
     int	nsoft;		/*number of soft conversions defined	*/
     size_t	asoft;		/*number of soft conversions allocated	*/
     H5T_soft_t	*soft;		/*unsorted array of soft conversions	*/
+    H5T_path_t	*path_cache[H5T_PATH_CACHE_SIZE]; /*recently found paths, by hash of src & dst types */
 } H5T_g;
 
 /* Declare the free list for H5T_path_t's */
@@ -699,6 +774,8 @@ H5T__init_package(void)
 #if H5_SIZEOF_LONG_DOUBLE !=0
     H5T_t       *native_ldouble=NULL;   /* Datatype structure for native long double */
 #endif
+    H5T_t       *native_float16=NULL;   /* Datatype structure for native 16-bit IEEE float */
+    H5T_t       *native_bfloat16=NULL;  /* Datatype structure for native bfloat16 float */
     H5T_t       *std_u8le=NULL;         /* Datatype structure for unsigned 8-bit little-endian integer */
     H5T_t       *std_u8be=NULL;         /* Datatype structure for unsigned 8-bit big-endian integer */
     H5T_t       *std_u16le=NULL;        /* Datatype structure for unsigned 16-bit little-endian integer */
@@ -818,6 +895,43 @@ H5T__init_package(void)
     /* IEEE 8-byte big-endian float */
     H5T_INIT_TYPE(DOUBLEBE,H5T_IEEE_F64BE_g,COPY,native_double,SET,8)
 
+    /* IEEE 2-byte little-endian float */
+    H5T_INIT_TYPE(FLOAT16LE,H5T_IEEE_F16LE_g,COPY,native_float,SET,2)
+
+    /* IEEE 2-byte big-endian float */
+    H5T_INIT_TYPE(FLOAT16BE,H5T_IEEE_F16BE_g,COPY,native_float,SET,2)
+
+    /*------------------------------------------------------------
+     * Other 16-bit floating-point types
+     *------------------------------------------------------------
+     */
+
+    /* 2-byte little-endian bfloat16 */
+    H5T_INIT_TYPE(BFLOAT16LE,H5T_FLOAT_BFLOAT16LE_g,COPY,native_float,SET,2)
+
+    /* 2-byte big-endian bfloat16 */
+    H5T_INIT_TYPE(BFLOAT16BE,H5T_FLOAT_BFLOAT16BE_g,COPY,native_float,SET,2)
+
+    /*
+     * Native 16-bit floats.  There's no C type for them, so these are
+     * the 2-byte types above in the machine's byte order, held in memory
+     * like a uint16_t.
+     */
+    if(H5T_ORDER_BE == H5T_native_order_g) {
+        H5T_INIT_TYPE(FLOAT16BE,H5T_NATIVE_FLOAT16_g,COPY,native_float,SET,2)
+        native_float16 = dt;
+        H5T_INIT_TYPE(BFLOAT16BE,H5T_NATIVE_BFLOAT16_g,COPY,native_float,SET,2)
+        native_bfloat16 = dt;
+    } /* end if */
+    else {
+        H5T_INIT_TYPE(FLOAT16LE,H5T_NATIVE_FLOAT16_g,COPY,native_float,SET,2)
+        native_float16 = dt;
+        H5T_INIT_TYPE(BFLOAT16LE,H5T_NATIVE_BFLOAT16_g,COPY,native_float,SET,2)
+        native_bfloat16 = dt;
+    } /* end else */
+    H5T_NATIVE_FLOAT16_ALIGN_g = H5T_NATIVE_UINT16_ALIGN_g;
+    H5T_NATIVE_BFLOAT16_ALIGN_g = H5T_NATIVE_UINT16_ALIGN_g;
+
     /*------------------------------------------------------------
      * VAX Types
      *------------------------------------------------------------
@@ -1027,6 +1141,14 @@ H5T__init_package(void)
     status |= H5T_register(H5T_PERS_HARD, "ldbl_flt", native_ldouble, native_float, H5T__conv_ldouble_float, H5AC_noio_dxpl_id, FALSE);
     status |= H5T_register(H5T_PERS_HARD, "ldbl_dbl", native_ldouble, native_double, H5T__conv_ldouble_double, H5AC_noio_dxpl_id, FALSE);
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
+    status |= H5T_register(H5T_PERS_HARD, "flt16_flt", native_float16, native_float, H5T__conv_float16_float, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "flt16_dbl", native_float16, native_double, H5T__conv_float16_double, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "flt_flt16", native_float, native_float16, H5T__conv_float_float16, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "dbl_flt16", native_double, native_float16, H5T__conv_double_float16, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "bflt16_flt", native_bfloat16, native_float, H5T__conv_bfloat16_float, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "bflt16_dbl", native_bfloat16, native_double, H5T__conv_bfloat16_double, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "flt_bflt16", native_float, native_bfloat16, H5T__conv_float_bfloat16, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "dbl_bflt16", native_double, native_bfloat16, H5T__conv_double_bfloat16, H5AC_noio_dxpl_id, FALSE);
 
     /* from long long */
     status |= H5T_register(H5T_PERS_HARD, "llong_ullong", native_llong, native_ullong, H5T__conv_llong_ullong, H5AC_noio_dxpl_id, FALSE);
@@ -1385,6 +1507,7 @@ H5T_top_term_package(void)
             } /* end for */
 
             /* Clear conversion tables */
+            H5T_PATH_CACHE_RESET();
             H5T_g.path = (H5T_path_t **)H5MM_xfree(H5T_g.path);
             H5T_g.npaths = 0;
             H5T_g.apaths = 0;
@@ -1408,11 +1531,16 @@ H5T_top_term_package(void)
 
         /* Reset all the datatype IDs */
         if(H5T_IEEE_F32BE_g > 0) {
+            H5T_IEEE_F16BE_g			= FAIL;
+            H5T_IEEE_F16LE_g			= FAIL;
             H5T_IEEE_F32BE_g			= FAIL;
             H5T_IEEE_F32LE_g			= FAIL;
             H5T_IEEE_F64BE_g			= FAIL;
             H5T_IEEE_F64LE_g			= FAIL;
 
+            H5T_FLOAT_BFLOAT16BE_g		= FAIL;
+            H5T_FLOAT_BFLOAT16LE_g		= FAIL;
+
             H5T_STD_I8BE_g			= FAIL;
             H5T_STD_I8LE_g			= FAIL;
             H5T_STD_I16BE_g			= FAIL;
@@ -1464,6 +1592,8 @@ H5T_top_term_package(void)
 #if H5_SIZEOF_LONG_DOUBLE !=0
             H5T_NATIVE_LDOUBLE_g		= FAIL;
 #endif
+            H5T_NATIVE_FLOAT16_g		= FAIL;
+            H5T_NATIVE_BFLOAT16_g		= FAIL;
             H5T_NATIVE_B8_g			= FAIL;
             H5T_NATIVE_B16_g			= FAIL;
             H5T_NATIVE_B32_g			= FAIL;
@@ -2368,6 +2498,7 @@ H5T_register(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             /* Replace previous path */
             H5T_g.path[i] = new_path;
             new_path = NULL; /*so we don't free it on error*/
+            H5T_PATH_CACHE_RESET();
 
             /* Free old path */
             H5T__print_stats(old_path, &nprint);
@@ -2540,6 +2671,7 @@ H5T_unregister(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             /* Remove from table */
             HDmemmove(H5T_g.path + i, H5T_g.path + i + 1, (size_t)(H5T_g.npaths - (i + 1)) * sizeof(H5T_path_t*));
             --H5T_g.npaths;
+            H5T_PATH_CACHE_RESET();
 
             /* Shut down path */
             H5T__print_stats(path, &nprint);
@@ -3141,6 +3273,9 @@ H5T_copy(H5T_t *old_dt, H5T_copy_t method)
     /* Copy shared information (entry information is copied last) */
     *(new_dt->shared) = *(old_dt->shared);
 
+    /* The copy may be modified, so its hash is recomputed as needed */
+    new_dt->shared->hash_valid = FALSE;
+
     /* Check what sort of copy we are making */
     switch (method) {
         case H5T_COPY_TRANSIENT:
@@ -3896,6 +4031,141 @@ H5T_get_size(const H5T_t *dt)
     FUNC_LEAVE_NOAPI(dt->shared->size)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_struct_hash
+ *
+ * Purpose:	Computes a structural hash of a datatype, for quick lookups
+ *		of conversion paths.  Types that H5T_cmp() finds equal, with
+ *		or without SUPERSET, always have the same hash, so types
+ *		with different hashes can't be equal.  To keep it that way,
+ *		the hash covers a subset of the properties H5T_cmp()
+ *		compares: the members of an enumeration, the location of a
+ *		variable-length type and the tag of an opaque type are left
+ *		out.  Compound members are combined independently of their
+ *		order.
+ *
+ *		The hash of a type that isn't transient is cached with the
+ *		type, since such a type can only be changed by
+ *		H5T_set_loc() and H5T_patch_vlen_file(), which discard it.
+ *
+ * Return:	The hash (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5T_struct_hash(const H5T_t *dt)
+{
+    H5T_shared_t *sh;           /* Shared type info */
+    uint32_t    sum;            /* Sum of the member hashes */
+    unsigned    u;              /* Local index variable */
+    uint32_t    ret_value;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(dt);
+    sh = dt->shared;
+
+    if(sh->hash_valid && sh->state != H5T_STATE_TRANSIENT)
+        HGOTO_DONE(sh->hash)
+
+/* Cheap multiplicative mixing, since the hashes of transient types are
+ * recomputed for every lookup
+ */
+#define H5T_HASH_MIX(H, V) {                                                    \
+    uint64_t _v = (uint64_t)(V);                                                \
+    (H) = ((H) ^ (uint32_t)_v ^ (uint32_t)(_v >> 32)) * 0x9e3779b1U;            \
+    (H) ^= (H) >> 15;                                                           \
+}
+
+    ret_value = 0;
+    H5T_HASH_MIX(ret_value, sh->type)
+    H5T_HASH_MIX(ret_value, sh->size)
+    if(sh->parent)
+        H5T_HASH_MIX(ret_value, H5T_struct_hash(sh->parent))
+
+    switch(sh->type) {
+        case H5T_COMPOUND:
+            H5T_HASH_MIX(ret_value, sh->u.compnd.nmembs)
+            for(u = 0, sum = 0; u < sh->u.compnd.nmembs; u++) {
+                const char *s;                  /* Member name */
+                uint32_t memb_hash = 0;         /* Hash of one member */
+
+                H5T_HASH_MIX(memb_hash, sh->u.compnd.memb[u].offset)
+                H5T_HASH_MIX(memb_hash, sh->u.compnd.memb[u].size)
+                H5T_HASH_MIX(memb_hash, H5T_struct_hash(sh->u.compnd.memb[u].type))
+                for(s = sh->u.compnd.memb[u].name; *s; s++)
+                    H5T_HASH_MIX(memb_hash, (unsigned char)*s)
+                sum += memb_hash;
+            } /* end for */
+            H5T_HASH_MIX(ret_value, sum)
+            break;
+
+        case H5T_VLEN:
+            H5T_HASH_MIX(ret_value, sh->u.vlen.type)
+            H5T_HASH_MIX(ret_value, (size_t)sh->u.vlen.f)
+            break;
+
+        case H5T_ARRAY:
+            H5T_HASH_MIX(ret_value, sh->u.array.ndims)
+            for(u = 0; u < sh->u.array.ndims; u++)
+                H5T_HASH_MIX(ret_value, sh->u.array.dim[u])
+            break;
+
+        case H5T_ENUM:
+        case H5T_OPAQUE:
+            break;
+
+        case H5T_NO_CLASS:
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_STRING:
+        case H5T_BITFIELD:
+        case H5T_REFERENCE:
+        case H5T_NCLASSES:
+        default:
+            H5T_HASH_MIX(ret_value, sh->u.atomic.order)
+            H5T_HASH_MIX(ret_value, sh->u.atomic.prec)
+            H5T_HASH_MIX(ret_value, sh->u.atomic.offset)
+            H5T_HASH_MIX(ret_value, sh->u.atomic.lsb_pad)
+            H5T_HASH_MIX(ret_value, sh->u.atomic.msb_pad)
+            if(H5T_INTEGER == sh->type)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.i.sign)
+            else if(H5T_FLOAT == sh->type) {
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.sign)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.epos)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.esize)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.ebias)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.mpos)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.msize)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.norm)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.f.pad)
+            } /* end if */
+            else if(H5T_STRING == sh->type) {
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.s.cset)
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.s.pad)
+            } /* end if */
+            else if(H5T_REFERENCE == sh->type) {
+                H5T_HASH_MIX(ret_value, sh->u.atomic.u.r.rtype)
+                if(H5R_OBJECT == sh->u.atomic.u.r.rtype)
+                    H5T_HASH_MIX(ret_value, sh->u.atomic.u.r.loc)
+            } /* end if */
+            break;
+    } /* end switch */
+
+#undef H5T_HASH_MIX
+
+    /* Cache the hash of types that can't change */
+    if(sh->state != H5T_STATE_TRANSIENT) {
+        sh->hash = ret_value;
+        sh->hash_valid = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_struct_hash() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_cmp
@@ -4404,6 +4674,8 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
     H5T_path_t	*table = NULL;		/*path existing in the table	*/
     H5T_path_t	*path = NULL;		/*new path			*/
     hid_t	src_id = -1, dst_id = -1;	/*src and dst type identifiers	*/
+    uint32_t	src_hash, dst_hash;	/*structural hashes of src and dst	*/
+    unsigned	slot;			/*slot in the path cache	*/
     int	i;			/*counter			*/
     int	nprint = 0;		/*lines of output printed	*/
     H5T_path_t	*ret_value = NULL;      /* Return value */
@@ -4447,13 +4719,27 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
      * Quincey Koziol, 2 July, 1999
      * Only allow the no-op conversion to occur if no "force conversion" flags
      * are set
+     *
+     * Types with different structural hashes can't be equal, so the full
+     * comparisons are only made when the hashes match.  Before searching
+     * the table, look for the path in the path cache, unless a new
+     * conversion function is being registered for the path.
      */
-    if(src->shared->force_conv == FALSE && dst->shared->force_conv == FALSE && 0 == H5T_cmp(src, dst, TRUE)) {
+    src_hash = H5T_struct_hash(src);
+    dst_hash = H5T_struct_hash(dst);
+    slot = H5T_PATH_CACHE_SLOT(src_hash, dst_hash);
+    if(src->shared->force_conv == FALSE && dst->shared->force_conv == FALSE &&
+            src_hash == dst_hash && 0 == H5T_cmp(src, dst, TRUE)) {
 	table = H5T_g.path[0];
 	cmp = 0;
 	md = 0;
     } /* end if */
+    else if(!func && NULL != (table = H5T_g.path_cache[slot]) &&
+            table->src_hash == src_hash && table->dst_hash == dst_hash &&
+            0 == H5T_cmp(src, table->src, FALSE) && 0 == H5T_cmp(dst, table->dst, FALSE))
+        HGOTO_DONE(table)
     else {
+        table = NULL;
 	lt = md = 1;
 	rt = H5T_g.npaths;
 	cmp = -1;
@@ -4604,6 +4890,7 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
         table = H5FL_FREE(H5T_path_t, table);
 	table = path;
 	H5T_g.path[md] = path;
+        H5T_PATH_CACHE_RESET();
     } else if(path != table) {
 	HDassert(cmp);
         if((size_t)H5T_g.npaths >= H5T_g.apaths) {
@@ -4628,6 +4915,13 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
     if(H5T_COMPOUND == H5T_get_class(src, TRUE) && H5T_COMPOUND == H5T_get_class(dst, TRUE))
         path->are_compounds = TRUE;
 
+    /* Remember the path for the next lookup */
+    if(!path->is_noop) {
+        path->src_hash = src_hash;
+        path->dst_hash = dst_hash;
+        H5T_g.path_cache[slot] = path;
+    } /* end if */
+
     /* Set return value */
     ret_value = path;
 
@@ -5038,6 +5332,7 @@ H5T_convert_committed_datatype(H5T_t *dt, H5F_t *f)
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTOPENOBJ, FAIL, "unable to reset path")
 
         dt->shared->state = H5T_STATE_TRANSIENT;
+        dt->shared->hash_valid = FALSE;
     }
 
 done:
@@ -5184,6 +5479,9 @@ H5T_set_loc(H5T_t *dt, H5F_t *f, H5T_loc_t loc)
     HDassert(dt);
     HDassert(loc>=H5T_LOC_BADLOC && loc<H5T_LOC_MAXLOC);
 
+    /* The type may change, even if it isn't transient */
+    dt->shared->hash_valid = FALSE;
+
     /* Datatypes can't change in size if the force_conv flag is not set */
     if(dt->shared->force_conv) {
         /* Check the datatype of this element */
@@ -5530,8 +5828,10 @@ H5T_patch_vlen_file(H5T_t *dt, H5F_t *f)
     HDassert(dt->shared);
     HDassert(f);
 
-    if((dt->shared->type == H5T_VLEN) && dt->shared->u.vlen.f != f)
+    if((dt->shared->type == H5T_VLEN) && dt->shared->u.vlen.f != f) {
         dt->shared->u.vlen.f = f;
+        dt->shared->hash_valid = FALSE;
+    } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5T_patch_vlen_file() */
@@ -59,6 +59,7 @@ typedef INIT_ONCE H5TS_once_t;
 #define H5TS_attr_destroy(attr_ptr) 0
 #define H5TS_wait_for_thread(thread) WaitForSingleObject(thread, INFINITE)
 #define H5TS_mutex_init(mutex) InitializeCriticalSection(mutex)
+#define H5TS_mutex_destroy(mutex) DeleteCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex) EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex) LeaveCriticalSection(mutex)
 
@@ -100,6 +101,7 @@ typedef pthread_once_t H5TS_once_t;
 #define H5TS_attr_destroy(attr_ptr) pthread_attr_destroy(attr_ptr)
 #define H5TS_wait_for_thread(thread) pthread_join(thread, NULL)
 #define H5TS_mutex_init(mutex) pthread_mutex_init(mutex, NULL)
+#define H5TS_mutex_destroy(mutex) pthread_mutex_destroy(mutex)
 #define H5TS_mutex_lock_simple(mutex) pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex) pthread_mutex_unlock(mutex)
 
@@ -34,8 +34,13 @@
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"		/* Property lists			*/
 #include "H5Tpkg.h"		/* Datatypes				*/
+#include "H5VMprivate.h"	/* Vectors and arrays 			*/
 
+#ifdef __F16C__
+#include <immintrin.h>          /* F16C half-precision conversions      */
+#endif /* __F16C__ */
 
+
 /****************/
 /* Local Macros */
 /****************/
@@ -116,6 +121,12 @@
  *              at least as wide as the destination.  Overflow can occur
  *              when the source magnitude is too large for the destination.
  *
+ * hF:		16-bit floats (IEEE half or bfloat16, held as uint16_t) to
+ *		float or double.  This case cannot generate overflows.
+ *
+ * Fh:		Float or double to 16-bit floats, rounding to nearest-even.
+ *		Overflows occur when the value rounds to infinity.
+ *
  * The macros take a subset of these arguments in the order listed here:
  *
  * CDATA:	A pointer to the H5T_cdata_t structure that was passed to the
@@ -502,6 +513,76 @@
     H5T_CONV(H5T_CONV_Ff, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
 }
 
+/* 16-bit floats have no C type, so they are converted to and from float
+ * or double with the helper routines below instead of a cast.  D_MIN and
+ * D_MAX are the bit patterns for negative and positive infinity in the
+ * 16-bit type.  H5T_CONV checks the alignment of the 16-bit values against
+ * H5T_NATIVE_FLOAT16_ALIGN_g or H5T_NATIVE_BFLOAT16_ALIGN_g.
+ */
+#define H5T_CONV_hF_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {			      \
+    *(D) = (DT)H5T_CONV_FROM_##STYPE(*(S));				      \
+}
+#define H5T_CONV_hF_NOEX_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX)		      \
+    H5T_CONV_hF_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX)
+
+#define H5T_CONV_hF(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
+    HDcompile_assert(sizeof(ST)==2);					      \
+    H5T_CONV(H5T_CONV_hF, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+}
+
+#define H5T_CONV_Fh_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {			      \
+    DT h = H5T_CONV_TO_##DTYPE(ST, *(S));				      \
+                                                                              \
+    if(h == (DT)(D_MAX)) {                                                    \
+        H5T_conv_ret_t except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI,               \
+                src_id, dst_id, S, D, cb_struct.user_data);                   \
+        if(except_ret == H5T_CONV_UNHANDLED)                                  \
+            /* Let the value overflow to infinity if case is ignored by user handler*/ \
+            *(D) = h;							      \
+        else if(except_ret == H5T_CONV_ABORT)                                 \
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception") \
+        /* if(except_ret==H5T_CONV_HANDLED): Fall through, user handled it */ \
+    } else if(h == (DT)(D_MIN)) {                                             \
+        H5T_conv_ret_t except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_LOW,              \
+                src_id, dst_id, S, D, cb_struct.user_data);                   \
+        if(except_ret == H5T_CONV_UNHANDLED)                                  \
+            /* Let the value overflow to infinity if case is ignored by user handler*/ \
+            *(D) = h;							      \
+        else if(except_ret == H5T_CONV_ABORT)                                 \
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception") \
+        /* if(except_ret==H5T_CONV_HANDLED): Fall through, user handled it */ \
+    } else								      \
+        *(D) = h;							      \
+}
+#define H5T_CONV_Fh_NOEX_CORE(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX) {		      \
+    *(D) = H5T_CONV_TO_##DTYPE(ST, *(S));				      \
+}
+
+#define H5T_CONV_Fh(STYPE,DTYPE,ST,DT,D_MIN,D_MAX) {			      \
+    HDcompile_assert(sizeof(DT)==2);					      \
+    H5T_CONV(H5T_CONV_Fh, STYPE, DTYPE, ST, DT, D_MIN, D_MAX, N)              \
+}
+
+/* Bit patterns for the infinities of the 16-bit float types */
+#define H5T_FLOAT16_POS_INF     ((uint16_t)0x7c00)
+#define H5T_FLOAT16_NEG_INF     ((uint16_t)0xfc00)
+#define H5T_BFLOAT16_POS_INF    ((uint16_t)0x7f80)
+#define H5T_BFLOAT16_NEG_INF    ((uint16_t)0xff80)
+
+/* Convert a 16-bit float to float.  Widening is exact, so the result is
+ * correct for double as well.
+ */
+#define H5T_CONV_FROM_FLOAT16(H)        H5T__float16_to_float(H)
+#define H5T_CONV_FROM_BFLOAT16(H)       H5T__bfloat16_to_float(H)
+
+/* Convert a float or double (chosen by the size of ST) to a 16-bit float */
+#define H5T_CONV_TO_FLOAT16(ST, X)                                            \
+    (sizeof(ST) == sizeof(float) ? H5T__float_to_float16((float)(X)) :        \
+        H5T__double_to_small_float((double)(X), 5, 10))
+#define H5T_CONV_TO_BFLOAT16(ST, X)                                           \
+    (sizeof(ST) == sizeof(float) ? H5T__float_to_bfloat16((float)(X)) :       \
+        H5T__double_to_small_float((double)(X), 8, 7))
+
 #define H5T_HI_LO_BIT_SET(TYP, V, LO, HI) {                                   \
     unsigned count;                                                           \
     unsigned char p;                                                          \
@@ -959,10 +1040,43 @@ done:                                                                         \
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE      4096
 
+/* Size of the buffer for converting compound members a block of elements
+ * at a time
+ */
+#define H5T_STRUCT_CONV_BUF_SIZE        (64 * 1024)
+
+/* Mask of the low N bits of a 64-bit word, for N from 0 to 64 */
+#define H5T_CONV_FLOAT_PLAN_MASK(N)                                           \
+    ((N) >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << (N)) - 1))
+
+/* Largest source value range mapped with a direct table by H5T__conv_enum(),
+ * as a multiple of the number of source members.  One- and two-byte
+ * sources always use a direct table.
+ */
+#define H5T_CONV_ENUM_DIRECT_RATIO      4
+
+/* Slot of a source value key in the H5T__conv_enum() hash table */
+#define H5T_CONV_ENUM_HASH(KEY, SHIFT)                                        \
+    ((size_t)(((KEY) * (uint64_t)0x9E3779B97F4A7C15ULL) >> (SHIFT)))
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* One operation of a compound conversion plan: a member copied or
+ * converted from the source element to the destination element
+ */
+typedef struct H5T_conv_struct_op_t {
+    size_t	src_offset;		/*byte offset in source element	     */
+    size_t	dst_offset;		/*byte offset in destination element */
+    size_t	src_size;		/*size of source member		     */
+    size_t	dst_size;		/*size of destination member	     */
+    H5T_path_t	*path;			/*member conversion path, or NULL to */
+					/*  simply copy the member	     */
+    hid_t	src_id;			/*source member type ID		     */
+    hid_t	dst_id;			/*destination member type ID	     */
+} H5T_conv_struct_op_t;
+
 /* Conversion data for H5T__conv_struct() */
 typedef struct H5T_conv_struct_t {
     int	*src2dst;		/*mapping from src to dst member num */
@@ -971,13 +1085,32 @@ typedef struct H5T_conv_struct_t {
     H5T_path_t	**memb_path;		/*conversion path for each member    */
     H5T_subset_info_t   subset_info;    /*info related to compound subsets   */
     unsigned            src_nmembs;     /*needed by free function            */
+    H5T_conv_struct_op_t *ops;          /*plan: copies, then conversions     */
+    size_t              nops;           /*number of operations in plan       */
+    size_t              nops_alloc;     /*number of operations allocated     */
+    size_t              ncopies;        /*number of copies in plan           */
+    size_t              block_nelmts;   /*elements converted at a time       */
+    uint8_t             *conv_buf;      /*buffer for member conversions      */
+    uint8_t             *conv_bkg;      /*background for member conversions */
 } H5T_conv_struct_t;
 
+/* How H5T__conv_enum() maps a source value to a destination member */
+typedef enum H5T_conv_enum_kind_t {
+    H5T_CONV_ENUM_SEARCH,               /*binary search of sorted values     */
+    H5T_CONV_ENUM_DIRECT,               /*table indexed by value - base      */
+    H5T_CONV_ENUM_HASH                  /*open-addressed table of values     */
+} H5T_conv_enum_kind_t;
+
 /* Conversion data for H5T__conv_enum() */
 typedef struct H5T_enum_struct_t {
-    int	base;			/*lowest `in' value		     */
-    unsigned length;		/*num elements in arrays	     */
-    int	*src2dst;		/*map from src to dst index	     */
+    H5T_conv_enum_kind_t kind;          /*lookup method                      */
+    hbool_t     identity;               /*members have the same values       */
+    hbool_t     big_endian;             /*source values are big-endian       */
+    uint64_t    base;                   /*lowest source key (direct table)   */
+    size_t      length;                 /*num elements in src2dst and keys   */
+    unsigned    shift;                  /*hash shift (hash table)            */
+    int         *src2dst;               /*map from src to dst index          */
+    uint64_t    *keys;                  /*source key of each slot (hash)     */
 } H5T_enum_struct_t;
 
 /* Conversion data for the hardware conversion functions */
@@ -986,6 +1119,27 @@ typedef struct H5T_conv_hw_t {
     size_t	d_aligned;		/*number destination elements aligned*/
 } H5T_conv_hw_t;
 
+/* Kinds of soft floating-point conversion plans */
+typedef enum H5T_conv_float_kind_t {
+    H5T_CONV_FLOAT_PLAN_F_F,            /*float to float                     */
+    H5T_CONV_FLOAT_PLAN_F_I,            /*float to integer                   */
+    H5T_CONV_FLOAT_PLAN_I_F             /*integer to float                   */
+} H5T_conv_float_kind_t;
+
+/* Conversion data for H5T__conv_f_f(), H5T__conv_f_i() and H5T__conv_i_f()
+ * when both types fit in a 64-bit word
+ */
+typedef struct H5T_conv_float_plan_t {
+    H5T_conv_float_kind_t kind;         /*which conversion this plan is for  */
+    size_t      src_size;               /*source type size                   */
+    size_t      dst_size;               /*destination type size              */
+    uint8_t     src_perm[8];            /*source bytes in little-endian order*/
+    uint8_t     dst_perm[8];            /*destination bytes in LE order      */
+    H5T_atomic_t src;                   /*atomic source info                 */
+    H5T_atomic_t dst;                   /*atomic destination info            */
+    uint64_t    dst_pad;                /*destination padding bits set to one*/
+} H5T_conv_float_plan_t;
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -996,6 +1150,8 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T_reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static herr_t H5T_conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata,
+    hid_t dxpl_id);
 
 
 /*********************/
@@ -1885,10 +2041,299 @@ H5T_conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->ops);
+    H5MM_xfree(priv->conv_buf);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T_conv_struct_free() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_op_cmp
+ *
+ * Purpose:	Orders the operations of a compound conversion plan: the
+ *		copies first, by source offset, then the conversions.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *		first operation is considered to be respectively less than,
+ *		equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5T_conv_struct_op_cmp(const void *_op1, const void *_op2)
+{
+    const H5T_conv_struct_op_t *op1 = (const H5T_conv_struct_op_t *)_op1;
+    const H5T_conv_struct_op_t *op2 = (const H5T_conv_struct_op_t *)_op2;
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if((NULL == op1->path) != (NULL == op2->path))
+        ret_value = op1->path ? 1 : -1;
+    else if(op1->src_offset < op2->src_offset)
+        ret_value = -1;
+    else if(op1->src_offset > op2->src_offset)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_op_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_add
+ *
+ * Purpose:	Appends the operations for the members of SRC present in
+ *		DST to the plan in PRIV, with the source and destination
+ *		offsets of the members shifted by SRC_BASE and DST_BASE.
+ *		MEMB_PRIV holds the member mapping and conversion paths
+ *		for SRC and DST, and is either PRIV itself or the data of a
+ *		nested compound conversion.
+ *
+ *		Members converted by another compound conversion are
+ *		flattened into the operations for their own members, so the
+ *		plan only contains copies and conversions of leaf members.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_plan_add(H5T_conv_struct_t *priv, const H5T_conv_struct_t *memb_priv,
+    const H5T_t *src, const H5T_t *dst, size_t src_base, size_t dst_base,
+    hid_t dxpl_id)
+{
+    const int   *src2dst = memb_priv->src2dst;
+    unsigned    u;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    for(u = 0; u < src->shared->u.compnd.nmembs; u++) {
+        const H5T_cmemb_t *src_memb, *dst_memb;
+        H5T_path_t *tpath;
+        H5T_conv_struct_op_t *op;
+
+        if(src2dst[u] < 0)
+            continue; /*subsetting*/
+        src_memb = src->shared->u.compnd.memb + u;
+        dst_memb = dst->shared->u.compnd.memb + src2dst[u];
+        tpath = memb_priv->memb_path[u];
+
+        if(!tpath->is_noop && (tpath->func == H5T__conv_struct || tpath->func == H5T__conv_struct_opt)) {
+            /* Bring the nested conversion up to date, and its types sorted
+             * as its member mapping expects
+             */
+            if(tpath->cdata.recalc && H5T_conv_struct_init(tpath->src, tpath->dst, &tpath->cdata, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
+            HDassert(tpath->cdata.priv);
+            H5T__sort_value(tpath->src, NULL);
+            H5T__sort_value(tpath->dst, NULL);
+
+            if(H5T_conv_struct_plan_add(priv, (const H5T_conv_struct_t *)tpath->cdata.priv,
+                    tpath->src, tpath->dst, src_base + src_memb->offset,
+                    dst_base + dst_memb->offset, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to flatten nested compound conversion")
+            continue;
+        } /* end if */
+
+        if(priv->nops >= priv->nops_alloc) {
+            size_t nops_alloc = MAX(16, 2 * priv->nops_alloc);
+            H5T_conv_struct_op_t *ops;
+
+            if(NULL == (ops = (H5T_conv_struct_op_t *)H5MM_realloc(priv->ops, nops_alloc * sizeof(H5T_conv_struct_op_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+            priv->ops = ops;
+            priv->nops_alloc = nops_alloc;
+        } /* end if */
+
+        op = priv->ops + priv->nops++;
+        op->src_offset = src_base + src_memb->offset;
+        op->dst_offset = dst_base + dst_memb->offset;
+        op->src_size = src_memb->size;
+        op->dst_size = dst_memb->size;
+        if(tpath->is_noop) {
+            HDassert(src_memb->size == dst_memb->size);
+            op->path = NULL;
+            op->src_id = op->dst_id = -1;
+        } /* end if */
+        else {
+            op->path = tpath;
+            op->src_id = memb_priv->src_memb_id[u];
+            op->dst_id = memb_priv->dst_memb_id[src2dst[u]];
+        } /* end else */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan
+ *
+ * Purpose:	Compiles the member conversion paths in PRIV into a flat
+ *		plan of operations on the source and destination elements.
+ *		Copies of members that are adjacent in both the source and
+ *		the destination are merged into one copy.  Also sizes the
+ *		buffers for converting members a block of elements at a
+ *		time.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_plan(H5T_conv_struct_t *priv, const H5T_t *src,
+    const H5T_t *dst, hid_t dxpl_id)
+{
+    size_t      max_buf_size = 0;       /* Max. size of a converted member */
+    size_t      max_bkg_size = 0;       /* Max. size of a destination member */
+    size_t      u, v;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    priv->nops = 0;
+    priv->conv_buf = (uint8_t *)H5MM_xfree(priv->conv_buf);
+    priv->conv_bkg = NULL;
+    if(H5T_conv_struct_plan_add(priv, priv, src, dst, (size_t)0, (size_t)0, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to build compound conversion plan")
+
+    /* Merge the copies of adjacent members */
+    if(priv->nops > 1)
+        HDqsort(priv->ops, priv->nops, sizeof(H5T_conv_struct_op_t), H5T_conv_struct_op_cmp);
+    priv->ncopies = 0;
+    for(u = 0, v = 0; u < priv->nops; u++) {
+        H5T_conv_struct_op_t *op = priv->ops + u;
+        H5T_conv_struct_op_t *prev = v > 0 ? priv->ops + v - 1 : NULL;
+
+        if(prev && NULL == prev->path && NULL == op->path &&
+                prev->src_offset + prev->src_size == op->src_offset &&
+                prev->dst_offset + prev->dst_size == op->dst_offset) {
+            prev->src_size += op->src_size;
+            prev->dst_size += op->dst_size;
+        } /* end if */
+        else {
+            if(op->path) {
+                max_buf_size = MAX3(max_buf_size, op->src_size, op->dst_size);
+                max_bkg_size = MAX(max_bkg_size, op->dst_size);
+            } /* end if */
+            else
+                priv->ncopies++;
+            if(v != u)
+                priv->ops[v] = *op;
+            v++;
+        } /* end else */
+    } /* end for */
+    priv->nops = v;
+
+    /* Convert members in blocks of elements that fit in the buffer */
+    if(max_buf_size > 0) {
+        priv->block_nelmts = MAX(1, H5T_STRUCT_CONV_BUF_SIZE / (max_buf_size + max_bkg_size));
+        if(NULL == (priv->conv_buf = (uint8_t *)H5MM_malloc(priv->block_nelmts * (max_buf_size + max_bkg_size))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        priv->conv_bkg = priv->conv_buf + priv->block_nelmts * max_buf_size;
+    } /* end if */
+    else
+        priv->block_nelmts = SIZET_MAX;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_apply
+ *
+ * Purpose:	Converts NELMTS compound elements in BUF with the plan in
+ *		PRIV.  Each block of elements is first scanned once to copy
+ *		the members that need no conversion to the elements in BKG.
+ *		Then each converted member is gathered from the block into
+ *		a packed buffer, converted with one call to its conversion
+ *		function and scattered to BKG.  Finally the elements in
+ *		BKG are copied back to BUF.
+ *
+ *		The strides are as for H5T__conv_struct_opt().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_apply(const H5T_conv_struct_t *priv, const H5T_t *src,
+    const H5T_t *dst, size_t nelmts, size_t buf_stride, size_t bkg_stride,
+    uint8_t *buf, uint8_t *bkg, hid_t dxpl_id)
+{
+    const H5T_conv_struct_op_t *op;
+    const H5T_conv_struct_op_t *copies_end = priv->ops + priv->ncopies;
+    const H5T_conv_struct_op_t *ops_end = priv->ops + priv->nops;
+    size_t      src_stride, dst_stride;     /* Strides through BUF */
+    size_t      start, nblock;              /* Block of elements converted */
+    size_t      elmtno;
+    uint8_t     *xbuf, *xbkg;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!buf_stride || !bkg_stride)
+        bkg_stride = dst->shared->size;
+    if(buf_stride)
+        src_stride = dst_stride = buf_stride;
+    else {
+        src_stride = src->shared->size;
+        dst_stride = dst->shared->size;
+    } /* end else */
+
+    for(start = 0; start < nelmts; start += nblock) {
+        nblock = MIN(priv->block_nelmts, nelmts - start);
+
+        /* Copy the members that need no conversion */
+        if(priv->ncopies > 0)
+            for(xbuf = buf + start * src_stride, xbkg = bkg + start * bkg_stride, elmtno = 0; elmtno < nblock; elmtno++) {
+                for(op = priv->ops; op < copies_end; op++)
+                    HDmemcpy(xbkg + op->dst_offset, xbuf + op->src_offset, op->src_size);
+                xbuf += src_stride;
+                xbkg += bkg_stride;
+            } /* end for */
+
+        /* Convert the other members, one member of the block at a time */
+        for(op = copies_end; op < ops_end; op++) {
+            for(xbuf = buf + start * src_stride + op->src_offset, elmtno = 0; elmtno < nblock; elmtno++) {
+                HDmemcpy(priv->conv_buf + elmtno * op->src_size, xbuf, op->src_size);
+                xbuf += src_stride;
+            } /* end for */
+            /* (Variable-length conversions use the old destination data to
+             *  free the sequences being overwritten)
+             */
+            if(op->path->cdata.need_bkg == H5T_BKG_YES || op->path->func == H5T__conv_vlen)
+                for(xbkg = bkg + start * bkg_stride + op->dst_offset, elmtno = 0; elmtno < nblock; elmtno++) {
+                    HDmemcpy(priv->conv_bkg + elmtno * op->dst_size, xbkg, op->dst_size);
+                    xbkg += bkg_stride;
+                } /* end for */
+
+            if(H5T_convert(op->path, op->src_id, op->dst_id, nblock, (size_t)0,
+                    (size_t)0, priv->conv_buf, priv->conv_bkg, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to convert compound datatype member")
+
+            for(xbkg = bkg + start * bkg_stride + op->dst_offset, elmtno = 0; elmtno < nblock; elmtno++) {
+                HDmemcpy(xbkg, priv->conv_buf + elmtno * op->dst_size, op->dst_size);
+                xbkg += bkg_stride;
+            } /* end for */
+        } /* end for */
+    } /* end for */
+
+    /* Move background buffer into result buffer */
+    for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+        HDmemmove(xbuf, xbkg, dst->shared->size);
+        xbuf += dst_stride;
+        xbkg += bkg_stride;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_apply() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_conv_struct_init
@@ -2033,6 +2478,12 @@ H5T_conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata, hid_t dxpl_id)
         } /* end if */
     } /* end for */
 
+    /* Compile the member conversions into a plan */
+    if(H5T_conv_struct_plan(priv, src, dst, dxpl_id) < 0) {
+        cdata->priv = H5T_conv_struct_free(priv);
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to build compound conversion plan")
+    } /* end if */
+
     /* The compound conversion functions need a background buffer */
     cdata->need_bkg = H5T_BKG_YES;
 
@@ -2127,20 +2578,21 @@ H5T__conv_struct_subset(const H5T_cdata_t *cdata)
  * Function:	H5T__conv_struct
  *
  * Purpose:	Converts between compound datatypes.  This is a soft
- *		conversion function.  The algorithm is basically:
- *
- * 		For each element do
- *		  For I=1..NELMTS do
- *		    If sizeof detination type <= sizeof source type then
- *		      Convert member to destination type;
- *		    Move member as far left as possible;
- *
- *		  For I=NELMTS..1 do
- *		    If not destination type then
- *		      Convert member to destination type;
- *		    Move member to correct position in BKG
- *
- *		  Copy BKG to BUF
+ *		conversion function.  The member conversions are compiled
+ *		into a plan when the path is initialized, with nested
+ *		compounds flattened and members that need no conversion
+ *		merged into as few copies as possible.  The algorithm is
+ *		then basically:
+ *
+ *		For each block of elements
+ *		  For each element of the block
+ *		    Copy the members that need no conversion to BKG
+ *		  For each member that needs a conversion
+ *		    Gather the member of the block into a packed buffer
+ *		    Convert it for the whole block
+ *		    Scatter it to its position in BKG
+ *
+ *		Copy BKG to BUF
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -2155,18 +2607,8 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
 {
     uint8_t	*buf = (uint8_t *)_buf;	/*cast for pointer arithmetic	*/
     uint8_t	*bkg = (uint8_t *)_bkg;	/*background pointer arithmetic	*/
-    uint8_t     *xbuf = buf, *xbkg = bkg;   /*temp pointers into buf and bkg*/
     H5T_t	*src = NULL;		/*source datatype		*/
     H5T_t	*dst = NULL;		/*destination datatype		*/
-    int	*src2dst = NULL;	/*maps src member to dst member	*/
-    H5T_cmemb_t	*src_memb = NULL;	/*source struct member descript.*/
-    H5T_cmemb_t	*dst_memb = NULL;	/*destination struct memb desc.	*/
-    size_t	offset;			/*byte offset wrt struct	*/
-    ssize_t	src_delta;	        /*source stride	*/
-    ssize_t	bkg_delta;	        /*background stride	*/
-    size_t	elmtno;
-    unsigned	u;		        /*counters			*/
-    int	        i;			/*counters			*/
     H5T_conv_struct_t *priv = (H5T_conv_struct_t *)(cdata->priv);
     herr_t      ret_value = SUCCEED;       /* Return value */
 
@@ -2209,120 +2651,10 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
 
             if(cdata->recalc && H5T_conv_struct_init(src, dst, cdata, dxpl_id) < 0)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
+            priv = (H5T_conv_struct_t *)(cdata->priv);
 
-            /*
-             * Insure that members are sorted.
-             */
-            H5T__sort_value(src, NULL);
-            H5T__sort_value(dst, NULL);
-            src2dst = priv->src2dst;
-
-            /*
-             * Direction of conversion and striding through background.
-             */
-            if(buf_stride) {
-                H5_CHECKED_ASSIGN(src_delta, ssize_t, buf_stride, size_t);
-                if(!bkg_stride) {
-                    H5_CHECKED_ASSIGN(bkg_delta, ssize_t, dst->shared->size, size_t);
-                } /* end if */
-                else
-                    H5_CHECKED_ASSIGN(bkg_delta, ssize_t, bkg_stride, size_t);
-            } /* end if */
-            else if(dst->shared->size <= src->shared->size) {
-                H5_CHECKED_ASSIGN(src_delta, ssize_t, src->shared->size, size_t);
-                H5_CHECKED_ASSIGN(bkg_delta, ssize_t, dst->shared->size, size_t);
-            } /* end else-if */
-            else {
-                H5_CHECK_OVERFLOW(src->shared->size, size_t, ssize_t);
-                src_delta = -(ssize_t)src->shared->size;
-                H5_CHECK_OVERFLOW(dst->shared->size, size_t, ssize_t);
-                bkg_delta = -(ssize_t)dst->shared->size;
-                xbuf += (nelmts - 1) * src->shared->size;
-                xbkg += (nelmts - 1) * dst->shared->size;
-            } /* end else */
-
-            /* Conversion loop... */
-            for(elmtno = 0; elmtno < nelmts; elmtno++) {
-                /*
-                 * For each source member which will be present in the
-                 * destination, convert the member to the destination type unless
-                 * it is larger than the source type.  Then move the member to the
-                 * left-most unoccupied position in the buffer.  This makes the
-                 * data point as small as possible with all the free space on the
-                 * right side.
-                 */
-                for(u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if(src2dst[u] < 0)
-                        continue; /*subsetting*/
-                    src_memb = src->shared->u.compnd.memb + u;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[u];
-
-                    if(dst_memb->size <= src_memb->size) {
-                        if(H5T_convert(priv->memb_path[u], priv->src_memb_id[u],
-                                priv->dst_memb_id[src2dst[u]],
-                                (size_t)1, (size_t)0, (size_t)0, /*no striding (packed array)*/
-                                xbuf + src_memb->offset, xbkg + dst_memb->offset,
-                                dxpl_id) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to convert compound datatype member")
-                        HDmemmove(xbuf + offset, xbuf + src_memb->offset, dst_memb->size);
-                        offset += dst_memb->size;
-                    } /* end if */
-                    else {
-                        HDmemmove (xbuf+offset, xbuf+src_memb->offset,
-                                   src_memb->size);
-                        offset += src_memb->size;
-                    } /* end else */
-                } /* end for */
-
-                /*
-                 * For each source member which will be present in the
-                 * destination, convert the member to the destination type if it
-                 * is larger than the source type (that is, has not been converted
-                 * yet).  Then copy the member to the destination offset in the
-                 * background buffer.
-                 */
-                H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
-                for(i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if(src2dst[i] < 0)
-                        continue; /*subsetting*/
-                    src_memb = src->shared->u.compnd.memb + i;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[i];
-
-                    if(dst_memb->size > src_memb->size) {
-                        offset -= src_memb->size;
-                        if(H5T_convert(priv->memb_path[i],
-                                    priv->src_memb_id[i], priv->dst_memb_id[src2dst[i]],
-                                    (size_t)1, (size_t)0, (size_t)0, /*no striding (packed array)*/
-                                    xbuf + offset, xbkg + dst_memb->offset,
-                                    dxpl_id) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to convert compound datatype member")
-                    } /* end if */
-                    else
-                        offset -= dst_memb->size;
-                    HDmemmove(xbkg + dst_memb->offset, xbuf + offset, dst_memb->size);
-                } /* end for */
-                HDassert(0 == offset);
-
-                /*
-                 * Update pointers
-                 */
-                xbuf += src_delta;
-                xbkg += bkg_delta;
-            } /* end for */
-
-            /* If the bkg_delta was set to -(dst->shared->size), make it positive now */
-            if(buf_stride == 0 && dst->shared->size > src->shared->size)
-                H5_CHECKED_ASSIGN(bkg_delta, ssize_t, dst->shared->size, size_t);
-
-            /*
-             * Copy the background buffer back into the in-place conversion
-             * buffer.
-             */
-            for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
-                HDmemmove(xbuf, xbkg, dst->shared->size);
-                xbuf += buf_stride ? buf_stride : dst->shared->size;
-                xbkg += bkg_delta;
-            } /* end for */
+            if(H5T_conv_struct_apply(priv, src, dst, nelmts, buf_stride, bkg_stride, buf, bkg, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to convert compound datatype")
             break;
 
         default:
@@ -2340,23 +2672,11 @@ done:
  *
  * Purpose:	Converts between compound datatypes in a manner more
  *		efficient than the general-purpose H5T__conv_struct()
- *		function.  This function isn't applicable if the destination
- *		is larger than the source type. This is a soft conversion
- *		function.  The algorithm is basically:
- *
- * 		For each member of the struct
- *		  If sizeof detination type <= sizeof source type then
- *		    Convert member to destination type for all elements
- *		    Move memb to BKG buffer for all elements
- *		  Else
- *		    Move member as far left as possible for all elements
- *
- *		For each member of the struct (in reverse order)
- *		  If not destination type then
- *		    Convert member to destination type for all elements
- *		    Move member to correct position in BKG for all elements
- *
- *		Copy BKG to BUF for all elements
+ *		function when the members of one type are a subset of the
+ *		other's, in the same order and with no conversion needed.
+ *		Other conversions are carried out with the compiled plan,
+ *		as by H5T__conv_struct().  This is a soft conversion
+ *		function.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -2414,16 +2734,10 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     uint8_t	*xbkg = NULL;		/*temporary pointer into `bkg'	*/
     H5T_t	*src = NULL;		/*source datatype		*/
     H5T_t	*dst = NULL;		/*destination datatype		*/
-    int	*src2dst = NULL;		/*maps src member to dst member	*/
-    H5T_cmemb_t	*src_memb = NULL;	/*source struct member descript.*/
-    H5T_cmemb_t	*dst_memb = NULL;	/*destination struct memb desc.	*/
-    size_t	offset;			/*byte offset wrt struct	*/
     size_t	elmtno;			/*element counter		*/
     size_t      copy_size;              /*size of element for copying   */
     H5T_conv_struct_t *priv = NULL;	/*private data			*/
     hbool_t     no_stride = FALSE;      /*flag to indicate no stride    */
-    unsigned	u;			/*counters			*/
-    int		i;			/*counters			*/
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -2446,43 +2760,6 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             /* Initialize data which is relatively constant */
             if(H5T_conv_struct_init(src, dst, cdata, dxpl_id) < 0)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
-            priv = (H5T_conv_struct_t *)(cdata->priv);
-            src2dst = priv->src2dst;
-
-            /*
-             * If the destination type is not larger than the source type then
-             * this conversion function is guaranteed to work (provided all
-             * members can be converted also). Otherwise the determination is
-             * quite a bit more complicated. Essentially we have to make sure
-             * that there is always room in the source buffer to do the
-             * conversion of a member in place. This is basically the same pair
-             * of loops as in the actual conversion except it checks that there
-             * is room for each conversion instead of actually doing anything.
-             */
-            if(dst->shared->size > src->shared->size) {
-                for(u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if(src2dst[u] < 0)
-                        continue;
-                    src_memb = src->shared->u.compnd.memb + u;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[u];
-                    if(dst_memb->size > src_memb->size)
-                        offset += src_memb->size;
-                } /* end for */
-                H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
-                for(i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if(src2dst[i] < 0)
-                        continue;
-                    src_memb = src->shared->u.compnd.memb + i;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[i];
-                    if(dst_memb->size > src_memb->size) {
-                        offset -= src_memb->size;
-                        if(dst_memb->size > src->shared->size-offset) {
-                            cdata->priv = H5T_conv_struct_free(priv);
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "convertion is unsupported by this function")
-                        } /* end if */
-                    } /* end if */
-                } /* end for */
-            } /* end if */
             break;
 
         case H5T_CONV_FREE:
@@ -2504,33 +2781,27 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
             priv = (H5T_conv_struct_t *)(cdata->priv);
             HDassert(priv);
-            src2dst = priv->src2dst;
             HDassert(bkg && cdata->need_bkg);
 
-            /*
-             * Insure that members are sorted.
-             */
-            H5T__sort_value(src, NULL);
-            H5T__sort_value(dst, NULL);
-
-            /*
-             * Calculate strides. If BUF_STRIDE is non-zero then convert one
-             * data element at every BUF_STRIDE bytes through the main buffer
-             * (BUF), leaving the result of each conversion at the same
-             * location; otherwise assume the source and destination data are
-             * packed tightly based on src->shared->size and dst->shared->size.  Also, if
-             * BUF_STRIDE and BKG_STRIDE are both non-zero then place
-             * background data into the BKG buffer at multiples of BKG_STRIDE;
-             * otherwise assume BKG buffer is the packed destination datatype.
-             */
-            if(!buf_stride || !bkg_stride)
-                bkg_stride = dst->shared->size;
-            if(!buf_stride) {
-                no_stride = TRUE;
-                buf_stride = src->shared->size;
-            } /* end if */
-
             if(priv->subset_info.subset == H5T_SUBSET_SRC || priv->subset_info.subset == H5T_SUBSET_DST) {
+                /*
+                 * Calculate strides. If BUF_STRIDE is non-zero then convert
+                 * one data element at every BUF_STRIDE bytes through the main
+                 * buffer (BUF), leaving the result of each conversion at the
+                 * same location; otherwise assume the source and destination
+                 * data are packed tightly based on src->shared->size and
+                 * dst->shared->size.  Also, if BUF_STRIDE and BKG_STRIDE are
+                 * both non-zero then place background data into the BKG
+                 * buffer at multiples of BKG_STRIDE; otherwise assume BKG
+                 * buffer is the packed destination datatype.
+                 */
+                if(!buf_stride || !bkg_stride)
+                    bkg_stride = dst->shared->size;
+                if(!buf_stride) {
+                    no_stride = TRUE;
+                    buf_stride = src->shared->size;
+                } /* end if */
+
                 /* If the optimization flag is set to indicate source members are a subset and
                  * in the top of the destination, simply copy the source members to background buffer.
                  */
@@ -2545,82 +2816,19 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                     xbuf += buf_stride;
                     xbkg += bkg_stride;
                 } /* end for */
-            } /* end if */
-            else {
-                /*
-                 * For each member where the destination is not larger than the
-                 * source, stride through all the elements converting only that member
-                 * in each element and then copying the element to its final
-                 * destination in the bkg buffer. Otherwise move the element as far
-                 * left as possible in the buffer.
-                 */
-                for(u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if(src2dst[u] < 0)
-                        continue; /*subsetting*/
-                    src_memb = src->shared->u.compnd.memb + u;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[u];
-
-                    if(dst_memb->size <= src_memb->size) {
-                        xbuf = buf + src_memb->offset;
-                        xbkg = bkg + dst_memb->offset;
-                        if(H5T_convert(priv->memb_path[u], priv->src_memb_id[u],
-                                priv->dst_memb_id[src2dst[u]], nelmts,
-                                buf_stride, bkg_stride, xbuf, xbkg, dxpl_id) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to convert compound datatype member")
-                        for(elmtno = 0; elmtno < nelmts; elmtno++) {
-                            HDmemmove(xbkg, xbuf, dst_memb->size);
-                            xbuf += buf_stride;
-                            xbkg += bkg_stride;
-                        } /* end for */
-                    } /* end if */
-                    else {
-                        for(xbuf = buf, elmtno = 0; elmtno < nelmts; elmtno++) {
-                            HDmemmove(xbuf + offset, xbuf + src_memb->offset, src_memb->size);
-                            xbuf += buf_stride;
-                        } /* end for */
-                        offset += src_memb->size;
-                    } /* end else */
-                } /* end else */
-
-                /*
-                 * Work from right to left, converting those members that weren't
-                 * converted in the previous loop (those members where the destination
-                 * is larger than the source) and them to their final position in the
-                 * bkg buffer.
-                 */
-                H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
-                for(i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if(src2dst[i] < 0)
-                        continue;
-                    src_memb = src->shared->u.compnd.memb + i;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[i];
-
-                    if(dst_memb->size > src_memb->size) {
-                        offset -= src_memb->size;
-                        xbuf = buf + offset;
-                        xbkg = bkg + dst_memb->offset;
-                        if(H5T_convert(priv->memb_path[i], priv->src_memb_id[i],
-                                priv->dst_memb_id[src2dst[i]], nelmts,
-                                buf_stride, bkg_stride, xbuf, xbkg, dxpl_id) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to convert compound datatype member")
-                        for(elmtno = 0; elmtno < nelmts; elmtno++) {
-                            HDmemmove(xbkg, xbuf, dst_memb->size);
-                            xbuf += buf_stride;
-                            xbkg += bkg_stride;
-                        } /* end for */
-                    } /* end if */
-                } /* end for */
-            } /* end else */
 
-            if(no_stride)
-                buf_stride = dst->shared->size;
+                if(no_stride)
+                    buf_stride = dst->shared->size;
 
-            /* Move background buffer into result buffer */
-            for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
-                HDmemmove(xbuf, xbkg, dst->shared->size);
-                xbuf += buf_stride;
-                xbkg += bkg_stride;
-            } /* end for */
+                /* Move background buffer into result buffer */
+                for(xbuf = buf, xbkg = bkg, elmtno = 0; elmtno < nelmts; elmtno++) {
+                    HDmemmove(xbuf, xbkg, dst->shared->size);
+                    xbuf += buf_stride;
+                    xbkg += bkg_stride;
+                } /* end for */
+            } /* end if */
+            else if(H5T_conv_struct_apply(priv, src, dst, nelmts, buf_stride, bkg_stride, buf, bkg, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to convert compound datatype")
             break;
 
         default:
@@ -2632,6 +2840,102 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_struct_opt() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_enum_key
+ *
+ * Purpose:	Forms the lookup key of an enumeration value of at most
+ *		eight bytes: the value's bits read as an unsigned integer
+ *		in the byte order of the source type, whatever the byte
+ *		order of this host.
+ *
+ * Return:	The key
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint64_t
+H5T_conv_enum_key(const uint8_t *s, size_t size, hbool_t big_endian)
+{
+    uint64_t    key = 0;
+    size_t      u;
+
+    if(big_endian)
+        for(u = 0; u < size; u++)
+            key = (key << 8) | s[u];
+    else
+        while(size > 0) {
+            size--;
+            key = (key << 8) | s[size];
+        } /* end while */
+
+    return key;
+} /* end H5T_conv_enum_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_enum_lookup
+ *
+ * Purpose:	Maps one source value to the index of the destination
+ *		member with the same name.  The source type must be sorted
+ *		by value when the binary search method is used.
+ *
+ * Return:	Success:	Destination member index
+ *
+ *		Failure:	Negative, the value is not a member
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE int
+H5T_conv_enum_lookup(const H5T_enum_struct_t *priv, const H5T_t *src,
+    const uint8_t *s)
+{
+    size_t      src_size = src->shared->size;
+    uint64_t    key;
+    size_t      h;
+
+    switch(priv->kind) {
+        case H5T_CONV_ENUM_DIRECT:
+            if(1 == src_size)
+                key = s[0];
+            else if(2 == src_size && !priv->big_endian)
+                key = (uint64_t)s[0] | ((uint64_t)s[1] << 8);
+            else
+                key = H5T_conv_enum_key(s, src_size, priv->big_endian);
+            key -= priv->base;
+            if(key >= priv->length)
+                return -1;
+            return priv->src2dst[key];
+
+        case H5T_CONV_ENUM_HASH:
+            key = H5T_conv_enum_key(s, src_size, priv->big_endian);
+            for(h = H5T_CONV_ENUM_HASH(key, priv->shift); priv->src2dst[h] >= 0; h = (h + 1) & (priv->length - 1))
+                if(priv->keys[h] == key)
+                    return priv->src2dst[h];
+            return -1;
+
+        case H5T_CONV_ENUM_SEARCH:
+        default:
+            {
+                unsigned lt = 0;
+                unsigned rt = src->shared->u.enumer.nmembs;
+                unsigned md;
+                int cmp;
+
+                while(lt < rt) {
+                    md = (lt + rt) / 2;
+                    cmp = HDmemcmp(s, src->shared->u.enumer.value + md * src_size, src_size);
+                    if(cmp < 0)
+                        rt = md;
+                    else if(cmp > 0)
+                        lt = md + 1;
+                    else
+                        return priv->src2dst[md];
+                } /* end while */
+            }
+            return -1;
+    } /* end switch */
+} /* end H5T_conv_enum_lookup() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_conv_enum_init
@@ -2653,10 +2957,12 @@ static herr_t
 H5T_conv_enum_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
 {
     H5T_enum_struct_t	*priv = NULL;	/*private conversion data	*/
-    int		n;		/*src value cast as native int	*/
-    int		domain[2] = {0, 0};	/*min and max source values	*/
+    size_t      src_size = src->shared->size;   /*source value size     */
+    unsigned    nmembs = src->shared->u.enumer.nmembs; /*source members */
+    uint64_t    key;            /*source value lookup key       */
+    uint64_t    domain[2] = {0, 0};	/*min and max source keys	*/
     int		*map = NULL;	/*map from src value to dst idx	*/
-    unsigned	length;		/*nelmts in map array		*/
+    size_t      h;              /*hash table slot               */
     unsigned	i, j;		/*counters			*/
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -2665,7 +2971,7 @@ H5T_conv_enum_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     cdata->need_bkg = H5T_BKG_NO;
     if(NULL == (priv = (H5T_enum_struct_t *)(cdata->priv = H5MM_calloc(sizeof(*priv)))))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-    if(0 == src->shared->u.enumer.nmembs)
+    if(0 == nmembs)
 	HGOTO_DONE(SUCCEED);
 
     /*
@@ -2675,10 +2981,10 @@ H5T_conv_enum_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
      */
     H5T__sort_name(src, NULL);
     H5T__sort_name(dst, NULL);
-    if(NULL == (priv->src2dst = (int *)H5MM_malloc(src->shared->u.enumer.nmembs * sizeof(int))))
+    if(NULL == (priv->src2dst = (int *)H5MM_malloc(nmembs * sizeof(int))))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
     for(i = 0, j = 0;
-             i < src->shared->u.enumer.nmembs && j < dst->shared->u.enumer.nmembs;
+             i < nmembs && j < dst->shared->u.enumer.nmembs;
              i++, j++) {
 	while(j < dst->shared->u.enumer.nmembs &&
 	       HDstrcmp(src->shared->u.enumer.name[i], dst->shared->u.enumer.name[j]))
@@ -2688,88 +2994,104 @@ H5T_conv_enum_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
 	priv->src2dst[i] = (int)j;
     } /* end for */
 
+    /*
+     * If every source member has the same value as its destination
+     * member, whatever the member order, a member value is already
+     * converted and only values that aren't members need handling.
+     */
+    if(src_size == dst->shared->size) {
+        for(i = 0; i < nmembs; i++)
+            if(HDmemcmp(src->shared->u.enumer.value + i * src_size,
+                    dst->shared->u.enumer.value + (unsigned)priv->src2dst[i] * src_size, src_size))
+                break;
+        priv->identity = (hbool_t)(i == nmembs);
+    } /* end if */
+
     /*
      * The conversion function will use an O(log N) lookup method for each
-     * value converted. However, if all of the following constraints are met
-     * then we can build a perfect hash table and use an O(1) lookup method.
-     *
-     *	  A: The source datatype size matches one of our native datatype
-     *	     sizes.
-     *
-     *	  B: After casting the source value bit pattern to a native type
-     *	     the size of the range of values is less than 20% larger than
-     *	     the number of values.
+     * value converted. However, if the source values fit in 64 bits we
+     * build a table and use an O(1) lookup method instead, keyed on the
+     * value's bits read as an unsigned integer in the source byte order
+     * (so unlike the native integer casts used before, the key doesn't
+     * depend on the byte order of this host).
      *
-     * If this special case is met then we use the source bit pattern cast as
-     * a native integer type as an index into the `val2dst'. The values of
-     * that array are the index numbers in the destination type or negative
-     * if the entry is unused.
-     *
-     * (This optimized algorithm doesn't work when the byte orders are different.  
-     * The code such as "n = *((int*)(src->shared->u.enumer.value+i*src->shared->size));"
-     * can change the value significantly. i.g. if the source value is big-endian 0x0000000f,
-     * executing the casting on little-endian machine will get a big number 0x0f000000.
-     * Then it can't meet the condition 
-     * "if(src->shared->u.enumer.nmembs<2 || (double)length/src->shared->u.enumer.nmembs<1.2)"
-     * Because this is the optimized code, we won't fix it. It should still work in some 
-     * situations. SLU - 2011/5/24) 
+     * When the values are one or two bytes, or the range of keys is at
+     * most a few times the number of values, the table is indexed
+     * directly by the key less the smallest key.  Otherwise the keys of
+     * the members are placed in an open-addressed hash table at most
+     * half full.  The values of the `src2dst' table are the index numbers
+     * in the destination type or negative if the entry is unused.
      */
-    if(1 == src->shared->size || sizeof(short) == src->shared->size || sizeof(int) == src->shared->size) {
-	for(i = 0; i < src->shared->u.enumer.nmembs; i++) {
-	    if(1 == src->shared->size)
-		n = *((signed char *)(src->shared->u.enumer.value + i));
-	    else if (sizeof(short) == src->shared->size)
-		n = *((short *)(src->shared->u.enumer.value + i * src->shared->size));
-	    else
-		n = *((int *)(src->shared->u.enumer.value + i * src->shared->size));
+    if(src_size <= sizeof(uint64_t)) {
+        priv->big_endian = (hbool_t)(H5T_ORDER_BE == src->shared->parent->shared->u.atomic.order);
+	for(i = 0; i < nmembs; i++) {
+            key = H5T_conv_enum_key(src->shared->u.enumer.value + i * src_size, src_size, priv->big_endian);
 	    if(0 == i) {
-		domain[0] = domain[1] = n;
+		domain[0] = domain[1] = key;
 	    } else {
-		domain[0] = MIN(domain[0], n);
-		domain[1] = MAX(domain[1], n);
+		domain[0] = MIN(domain[0], key);
+		domain[1] = MAX(domain[1], key);
 	    }
 	} /* end for */
 
-        HDassert(domain[1] >= domain[0]);
-	length = (unsigned)(domain[1] - domain[0]) + 1;
-	if(src->shared->u.enumer.nmembs < 2 ||
-                (double)length / src->shared->u.enumer.nmembs < (double)(1.2f)) {
+        if(src_size <= 2 || (domain[1] - domain[0]) / H5T_CONV_ENUM_DIRECT_RATIO < nmembs) {
+	    priv->kind = H5T_CONV_ENUM_DIRECT;
 	    priv->base = domain[0];
-	    priv->length = length;
-	    if(NULL == (map = (int *)H5MM_malloc(length * sizeof(int))))
+	    priv->length = (size_t)(domain[1] - domain[0]) + 1;
+	    if(NULL == (map = (int *)H5MM_malloc(priv->length * sizeof(int))))
 		HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-	    for(i = 0; i < length; i++)
-                map[i] = -1; /*entry unused*/
-	    for(i = 0; i < src->shared->u.enumer.nmembs; i++) {
-		if(1 == src->shared->size)
-		    n = *((signed char *)(src->shared->u.enumer.value + i));
-		else if(sizeof(short) == src->shared->size)
-		    n = *((short *)(src->shared->u.enumer.value + i * src->shared->size));
-		else
-		    n = *((int *)(src->shared->u.enumer.value + i * src->shared->size));
-		n -= priv->base;
-		HDassert(n >= 0 && (unsigned)n < priv->length);
-		HDassert(map[n] < 0);
-		map[n] = priv->src2dst[i];
+	    for(h = 0; h < priv->length; h++)
+                map[h] = -1; /*entry unused*/
+	    for(i = 0; i < nmembs; i++) {
+                key = H5T_conv_enum_key(src->shared->u.enumer.value + i * src_size, src_size, priv->big_endian) - priv->base;
+		HDassert(key < priv->length);
+		HDassert(map[key] < 0);
+		map[key] = priv->src2dst[i];
 	    } /* end for */
+        } /* end if */
+        else {
+            priv->kind = H5T_CONV_ENUM_HASH;
+            priv->length = 2;
+            priv->shift = 63;
+            while(priv->length < 2 * (size_t)nmembs) {
+                priv->length *= 2;
+                priv->shift--;
+            } /* end while */
+	    if(NULL == (map = (int *)H5MM_malloc(priv->length * sizeof(int))))
+		HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+	    if(NULL == (priv->keys = (uint64_t *)H5MM_malloc(priv->length * sizeof(uint64_t))))
+		HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+	    for(h = 0; h < priv->length; h++)
+                map[h] = -1; /*entry unused*/
+	    for(i = 0; i < nmembs; i++) {
+                key = H5T_conv_enum_key(src->shared->u.enumer.value + i * src_size, src_size, priv->big_endian);
+                for(h = H5T_CONV_ENUM_HASH(key, priv->shift); map[h] >= 0; h = (h + 1) & (priv->length - 1))
+                    HDassert(priv->keys[h] != key);
+                map[h] = priv->src2dst[i];
+                priv->keys[h] = key;
+	    } /* end for */
+        } /* end else */
 
-	    /*
-	     * Replace original src2dst array with our new one. The original
-	     * was indexed by source member number while the new one is
-	     * indexed by source values.
-	     */
-	    H5MM_xfree(priv->src2dst);
-	    priv->src2dst = map;
-	    HGOTO_DONE(SUCCEED);
-	}
-    }
+        /*
+         * Replace original src2dst array with our new one. The original
+         * was indexed by source member number while the new one is
+         * indexed by source values.
+         */
+        H5MM_xfree(priv->src2dst);
+        priv->src2dst = map;
+        map = NULL;
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
 
     /* Sort source type by value and adjust src2dst[] appropriately */
+    priv->length = nmembs;
     H5T__sort_value(src, priv->src2dst);
 
 done:
     if (ret_value<0 && priv) {
+        H5MM_xfree(map);
 	H5MM_xfree(priv->src2dst);
+	H5MM_xfree(priv->keys);
 	H5MM_xfree(priv);
 	cdata->priv = NULL;
     }
@@ -2799,7 +3121,9 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     H5T_t	*src = NULL, *dst = NULL;	/*src and dst datatypes	*/
     uint8_t	*s = NULL, *d = NULL;	/*src and dst BUF pointers	*/
     ssize_t	src_delta, dst_delta;	/*conversion strides		*/
-    int	n;			/*src value cast as native int	*/
+    const uint8_t *dst_value;   /*destination member values     */
+    size_t      dst_size;       /*destination value size        */
+    int	n;			/*destination member index	*/
     H5T_enum_struct_t *priv = (H5T_enum_struct_t*)(cdata->priv);
     H5P_genplist_t      *plist;         /*property list pointer         */
     H5T_conv_cb_t       cb_struct;      /*conversion callback structure */
@@ -2831,13 +3155,15 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
         case H5T_CONV_FREE:
 #ifdef H5T_DEBUG
             if (H5DEBUG(T)) {
-                fprintf(H5DEBUG(T), "      Using %s mapping function%s\n",
-                        priv->length?"O(1)":"O(log N)",
-                        priv->length?"":", where N is the number of enum members");
+                fprintf(H5DEBUG(T), "      Using %s mapping function%s%s\n",
+                        H5T_CONV_ENUM_SEARCH == priv->kind ? "O(log N)" : "O(1)",
+                        H5T_CONV_ENUM_SEARCH == priv->kind ? ", where N is the number of enum members" : "",
+                        priv->identity ? " (identical values)" : "");
             }
 #endif
             if (priv) {
                 H5MM_xfree(priv->src2dst);
+                H5MM_xfree(priv->keys);
                 H5MM_xfree(priv);
             }
             cdata->priv = NULL;
@@ -2854,9 +3180,9 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             /* priv->src2dst map was computed for certain sort keys. Make sure those same
              * sort keys are used here during conversion. See H5T_conv_enum_init(). But
              * we actually don't care about the source type's order when doing the O(1)
-             * conversion algorithm, which is turned on by non-zero priv->length */
+             * conversion algorithms, which don't use the binary search */
             H5T__sort_name(dst, NULL);
-            if(!priv->length)
+            if(H5T_CONV_ENUM_SEARCH == priv->kind)
                 H5T__sort_value(src, NULL);
 
             /*
@@ -2887,77 +3213,25 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(H5P_get(plist, H5D_XFER_CONV_CB_NAME, &cb_struct) < 0)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
 
+            dst_value = dst->shared->u.enumer.value;
+            dst_size = dst->shared->size;
             for(i = 0; i < nelmts; i++, s += src_delta, d += dst_delta) {
-                if(priv->length) {
-                    /* Use O(1) lookup */
-                    /* (The casting won't work when the byte orders are different. i.g. if the source value
-                     * is big-endian 0x0000000f, the direct casting "n = *((int*)s);" will make it a big
-                     * number 0x0f000000 on little-endian machine. But we won't fix it because it's an 
-                     * optimization code. Please also see the comment in the H5T_conv_enum_init() function.
-                     * SLU - 2011/5/24)
-                     */ 
-                    if(1 == src->shared->size)
-                        n = *((signed char*)s);
-                    else if(sizeof(short) == src->shared->size)
-                        n = *((short*)s);
-                    else
-                        n = *((int*)s);
-                    n -= priv->base;
-                    if(n < 0 || (unsigned)n >= priv->length || priv->src2dst[n] < 0) {
-                        /*overflow*/
-                        except_ret = H5T_CONV_UNHANDLED;
-                        /*If user's exception handler is present, use it*/
-                        if(cb_struct.func)
-                            except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI, src_id, dst_id,
-                                    s, d, cb_struct.user_data);
+                if((n = H5T_conv_enum_lookup(priv, src, s)) < 0) {
+                    /*overflow*/
+                    except_ret = H5T_CONV_UNHANDLED;
+                    /*If user's exception handler is present, use it*/
+                    if(cb_struct.func)
+                        except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI, src_id, dst_id,
+                                s, d, cb_struct.user_data);
 
-                        if(except_ret == H5T_CONV_UNHANDLED)
-                            HDmemset(d, 0xff, dst->shared->size);
-                        else if(except_ret == H5T_CONV_ABORT)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
-                    } else
-                        HDmemcpy(d,
-                                 dst->shared->u.enumer.value + (unsigned)priv->src2dst[n] * dst->shared->size,
-                                 dst->shared->size);
+                    if(except_ret == H5T_CONV_UNHANDLED)
+                        HDmemset(d, 0xff, dst_size);
+                    else if(except_ret == H5T_CONV_ABORT)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
                 } /* end if */
-                else {
-                    /* Use O(log N) lookup */
-                    unsigned lt = 0;
-                    unsigned rt = src->shared->u.enumer.nmembs;
-                    unsigned md = 0;
-                    int cmp;
-
-                    while(lt < rt) {
-                        md = (lt + rt) / 2;
-                        cmp = HDmemcmp(s, src->shared->u.enumer.value + md * src->shared->size,
-                                       src->shared->size);
-                        if(cmp < 0)
-                            rt = md;
-                        else if(cmp > 0)
-                            lt = md + 1;
-                        else
-                            break;
-                    } /* end while */
-                    if(lt >= rt) {
-                        except_ret = H5T_CONV_UNHANDLED;
-                        /*If user's exception handler is present, use it*/
-                        if(cb_struct.func)
-                            except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI, src_id, dst_id,
-                                    src, d, cb_struct.user_data);
-
-                        if(except_ret == H5T_CONV_UNHANDLED)
-                            HDmemset(d, 0xff, dst->shared->size);
-                        else if(except_ret == H5T_CONV_ABORT)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
-                    } /* end if */
-                    else {
-                        HDassert(priv->src2dst[md] >= 0);
-                        HDmemcpy(d,
-                                 dst->shared->u.enumer.value + (unsigned)priv->src2dst[md] * dst->shared->size,
-                                 dst->shared->size);
-                    } /* end else */
-                } /* end else */
-            }
+                else if(!priv->identity)
+                    HDmemcpy(d, dst_value + (unsigned)n * dst_size, dst_size);
+            } /* end for */
 
             break;
 
@@ -3068,6 +3342,13 @@ done:
  *                6. Write dst VL data into dst heap
  *                7. Store (heap ID or pointer) and length in main dst buffer
  *
+ *		When reading from the file, the sequences of a batch of
+ *		elements are read together, with each global heap collection
+ *		protected once per batch, before steps 3-7 are carried out
+ *		for each of them.  When writing to the file, step 6 is
+ *		deferred until the end of the batch, when its sequences are
+ *		laid out in order in new global heap collections.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Quincey Koziol
@@ -3118,6 +3399,10 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     void	*tmp_buf = NULL;     	/*temporary background buffer 	     */
     size_t	tmp_buf_size = 0;	/*size of temporary bkg buffer	     */
     hbool_t     nested = FALSE;         /*flag of nested VL case             */
+    hbool_t     batch_read = FALSE;     /*flag to read sequences in batches  */
+    hbool_t     batch_write = FALSE;    /*flag to write sequences in batches */
+    H5T_vlen_batch_t batch;             /*batch of sequences read or written */
+    size_t      batch_start = 0, batch_end = 0; /*elements in the batch     */
     size_t	elmtno;			/*element number counter	     */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -3219,6 +3504,13 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Read or write the sequences of several elements at once */
+            HDmemset(&batch, 0, sizeof(batch));
+            if(write_to_file)
+                batch_write = TRUE;
+            else if(src->shared->u.vlen.f != NULL)
+                batch_read = TRUE;
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while(nelmts > 0) {
@@ -3258,8 +3550,19 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                     b = (uint8_t *)bkg;
                     safe = nelmts;
                 } /* end else */
+                batch_start = batch_end = 0;
 
                 for(elmtno = 0; elmtno < safe; elmtno++) {
+                    /* Read the sequences of the next batch of elements */
+                    if(batch_read && elmtno == batch_end) {
+                        size_t nread;   /* # of elements in the batch */
+
+                        if(H5T__vlen_disk_read_batch(src, dxpl_id, s, s_stride, safe - elmtno, MAX(src_base_size, dst_base_size), &batch, &nread) < 0)
+                            HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+                        batch_start = elmtno;
+                        batch_end = elmtno + nread;
+                    } /* end if */
+
                     /* Check for "nil" source sequence */
                     if((*(src->shared->u.vlen.isnull))(src->shared->u.vlen.f, s)) {
                         /* Write "nil" sequence to destination location */
@@ -3269,6 +3572,8 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                     else {
                         ssize_t sseq_len;   /* (signed) The number of elements in the current sequence*/
                         size_t 	seq_len;    /* The number of elements in the current sequence*/
+                        void    *seq_buf;   /* Buffer holding the current sequence */
+                        size_t  seq_buf_size; /* Size of the sequence buffer in bytes */
 
                         /* Get length of element sequences */
                         if((sseq_len = (*(src->shared->u.vlen.getlen))(s)) < 0)
@@ -3280,6 +3585,13 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             /* Get direct pointer to sequence */
                             if(NULL == (conv_buf = (*(src->shared->u.vlen.getptr))(s)))
                                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid source pointer")
+                            seq_buf = conv_buf;
+                            seq_buf_size = conv_buf_size;
+                        } /* end if */
+                        else if(batch_read) {
+                            /* The sequence has already been read with its batch */
+                            seq_buf = batch.seqs[elmtno - batch_start];
+                            seq_buf_size = seq_len * MAX(src_base_size, dst_base_size);
                         } /* end if */
                         else {
                             size_t	src_size, dst_size;     /*source & destination total size in bytes*/
@@ -3306,14 +3618,16 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             /* Read in VL sequence */
                             if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, dxpl_id, s, conv_buf, src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+                            seq_buf = conv_buf;
+                            seq_buf_size = conv_buf_size;
                         } /* end else */
 
                         if(!noop_conv) {
                             /* Check if temporary buffer is large enough, resize if necessary */
-                            /* (Chain off the conversion buffer size) */
-                            if(tmp_buf && tmp_buf_size < conv_buf_size) {
+                            /* (Chain off the sequence buffer size) */
+                            if(tmp_buf && tmp_buf_size < seq_buf_size) {
                                 /* Set up initial background buffer */
-                                tmp_buf_size = conv_buf_size;
+                                tmp_buf_size = seq_buf_size;
                                 if(NULL == (tmp_buf = H5FL_BLK_REALLOC(vlen_seq, tmp_buf, tmp_buf_size)))
                                     HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
                                 HDmemset(tmp_buf, 0, tmp_buf_size);
@@ -3344,12 +3658,18 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             } /* end if */
 
                             /* Convert VL sequence */
-                            if(H5T_convert(tpath, tsrc_id, tdst_id, seq_len, (size_t)0, (size_t)0, conv_buf, tmp_buf, dxpl_id) < 0)
+                            if(H5T_convert(tpath, tsrc_id, tdst_id, seq_len, (size_t)0, (size_t)0, seq_buf, tmp_buf, dxpl_id) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "datatype conversion failed")
                         } /* end if */
 
                         /* Write sequence to destination location */
-                        if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, dxpl_id, vl_alloc_info, d, conv_buf, b, seq_len, dst_base_size) < 0)
+                        /* (The conversion buffer is reused, so its sequences
+                         *      are copied into the batch) */
+                        if(batch_write) {
+                            if(H5T__vlen_disk_write_batch(dst, dxpl_id, d, seq_buf, !noop_conv, seq_len, dst_base_size, b, &batch) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+                        } /* end if */
+                        else if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, dxpl_id, vl_alloc_info, d, seq_buf, b, seq_len, dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if(!noop_conv) {
@@ -3380,6 +3700,11 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                     b += b_stride;
                 } /* end for */
 
+                /* Write the sequences still queued */
+                if(batch_write && batch.nireqs > 0)
+                    if(H5T__vlen_disk_write_batch_flush(dst, dxpl_id, &batch) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+
                 /* Decrement number of elements left to convert */
                 nelmts -= safe;
             } /* end while */
@@ -3405,6 +3730,9 @@ done:
     /* Release the background buffer, if we have one */
     if(tmp_buf)
         tmp_buf = H5FL_BLK_FREE(vlen_seq, tmp_buf);
+    /* Release the sequences read or written in batches */
+    if(batch_read || batch_write)
+        H5T__vlen_batch_free(&batch);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_vlen() */
@@ -3945,29 +4273,457 @@ H5T__conv_i_i(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                     }
                 }
 
-                /*
-                 * If we had used a temporary buffer for the destination then we
-                 * should copy the value to the true destination buffer.
-                 */
-                if(d==dbuf)
-                    HDmemcpy(dp, d, dst->shared->size);
+                /*
+                 * If we had used a temporary buffer for the destination then we
+                 * should copy the value to the true destination buffer.
+                 */
+                if(d==dbuf)
+                    HDmemcpy(dp, d, dst->shared->size);
+
+                /* Advance source & destination pointers by delta amounts */
+                sp += src_delta;
+                dp += dst_delta;
+            } /* end for */
+
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "unknown conversion command")
+    } /* end switch */
+
+done:
+    if(src_rev)
+        H5MM_free(src_rev);
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_i_i() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_float_plan_perm
+ *
+ * Purpose:	Build the byte permutation that takes a value of SIZE bytes
+ *		in byte order ORDER to little-endian order: byte I of the
+ *		little-endian value is byte PERM[I] of the stored value.
+ *		The swaps are the same ones the soft conversion functions
+ *		apply in place, so the permutation matches them exactly.
+ *		IS_FLOAT says whether VAX order is honored, since the
+ *		integer conversions only ever reverse big-endian values.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_conv_float_plan_perm(uint8_t *perm, size_t size, H5T_order_t order,
+    hbool_t is_float)
+{
+    size_t      i;                      /* Local index variable */
+
+    for(i = 0; i < size; i++)
+        perm[i] = (uint8_t)i;
+
+    if(H5T_ORDER_BE == order) {
+        for(i = 0; i < size / 2; i++)
+            H5_SWAP_BYTES(perm, i, size - (i + 1))
+    } /* end if */
+    else if(H5T_ORDER_VAX == order && is_float) {
+        for(i = 0; i < size; i += 4) {
+            H5_SWAP_BYTES(perm, i, (size - 2) - i)
+            H5_SWAP_BYTES(perm, i + 1, (size - 1) - i)
+        } /* end for */
+    } /* end if */
+} /* end H5T_conv_float_plan_perm() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_float_plan_init
+ *
+ * Purpose:	Build the plan used by H5T__conv_f_f, H5T__conv_f_i and
+ *		H5T__conv_i_f to convert whole words instead of walking the
+ *		bit fields of every element.  The plan is only built when
+ *		both types fit in 64 bits and have the layout the word
+ *		kernels expect (implied normalization, fields inside the
+ *		precision); otherwise CDATA->PRIV is left NULL and the
+ *		bit-field code does all the work.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_float_plan_init(const H5T_t *src_p, const H5T_t *dst_p,
+    H5T_conv_float_kind_t kind, H5T_cdata_t *cdata)
+{
+    const H5T_atomic_t *src = &src_p->shared->u.atomic;   /* Source info */
+    const H5T_atomic_t *dst = &dst_p->shared->u.atomic;   /* Destination info */
+    hbool_t     src_float = (kind != H5T_CONV_FLOAT_PLAN_I_F); /* Source is floating-point */
+    hbool_t     dst_float = (kind != H5T_CONV_FLOAT_PLAN_F_I); /* Destination is floating-point */
+    H5T_conv_float_plan_t *plan;        /* New conversion plan */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    cdata->priv = NULL;
+
+    /* Both values must fit in a 64-bit word */
+    if(src_p->shared->size > 8 || dst_p->shared->size > 8)
+        HGOTO_DONE(SUCCEED)
+    if(src->offset + src->prec > 8 * src_p->shared->size || dst->offset + dst->prec > 8 * dst_p->shared->size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Floating-point sides must be normalized with an implied bit */
+    if(src_float && (H5T_NORM_IMPLIED != src->u.f.norm || 0 == src->u.f.msize || 0 == src->u.f.esize))
+        HGOTO_DONE(SUCCEED)
+    if(dst_float && (H5T_NORM_IMPLIED != dst->u.f.norm || 0 == dst->u.f.msize || 0 == dst->u.f.esize))
+        HGOTO_DONE(SUCCEED)
+
+    /* The float-to-float kernel writes the whole precision, so the
+     * destination fields must tile it exactly */
+    if(H5T_CONV_FLOAT_PLAN_F_F == kind) {
+        uint64_t fields;                /* Bits covered by the destination fields */
+
+        if(1 + dst->u.f.esize + dst->u.f.msize != dst->prec)
+            HGOTO_DONE(SUCCEED)
+        fields = H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.msize) << dst->u.f.mpos;
+        if(fields & (H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.esize) << dst->u.f.epos))
+            HGOTO_DONE(SUCCEED)
+        fields |= H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.esize) << dst->u.f.epos;
+        if(fields & ((uint64_t)1 << dst->u.f.sign))
+            HGOTO_DONE(SUCCEED)
+        fields |= (uint64_t)1 << dst->u.f.sign;
+        if(fields != H5T_CONV_FLOAT_PLAN_MASK(dst->prec) << dst->offset)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    if(NULL == (plan = (H5T_conv_float_plan_t *)H5MM_malloc(sizeof(H5T_conv_float_plan_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    plan->kind = kind;
+    plan->src_size = src_p->shared->size;
+    plan->dst_size = dst_p->shared->size;
+    H5T_conv_float_plan_perm(plan->src_perm, plan->src_size, src->order, src_float);
+    H5T_conv_float_plan_perm(plan->dst_perm, plan->dst_size, dst->order, dst_float);
+    plan->src = *src;
+    plan->dst = *dst;
+
+    /* External padding of the destination is the same for every value */
+    plan->dst_pad = 0;
+    if(H5T_PAD_ONE == dst->lsb_pad)
+        plan->dst_pad |= H5T_CONV_FLOAT_PLAN_MASK(dst->offset);
+    if(H5T_PAD_ONE == dst->msb_pad)
+        plan->dst_pad |= H5T_CONV_FLOAT_PLAN_MASK(8 * plan->dst_size) & ~H5T_CONV_FLOAT_PLAN_MASK(dst->offset + dst->prec);
+
+    cdata->priv = plan;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_float_plan_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_float_plan_f_f
+ *
+ * Purpose:	Convert the normalized floating-point value in word V to the
+ *		destination format, rounding the same way H5T__conv_f_f
+ *		does.  Zeros and normalized values that stay normalized are
+ *		handled here; denormalized values, infinities, NaNs and
+ *		results that overflow or underflow are left to the
+ *		reference code.
+ *
+ * Return:	TRUE if *W holds the result, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE hbool_t
+H5T_conv_float_plan_f_f(const H5T_conv_float_plan_t *plan, uint64_t v, uint64_t *w)
+{
+    const H5T_atomic_t *src = &plan->src;
+    const H5T_atomic_t *dst = &plan->dst;
+    uint64_t    sign = (v >> src->u.f.sign) & 1;
+    uint64_t    m = (v >> src->u.f.mpos) & H5T_CONV_FLOAT_PLAN_MASK(src->u.f.msize);
+    uint64_t    e = (v >> src->u.f.epos) & H5T_CONV_FLOAT_PLAN_MASK(src->u.f.esize);
+    int64_t     expo_max = (int64_t)H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.esize);
+    int64_t     expo;
+
+    if(0 == e) {
+        if(m)
+            return FALSE;       /* Denormalized */
+        *w = (sign << dst->u.f.sign) | plan->dst_pad;
+        return TRUE;
+    } /* end if */
+    if(e == H5T_CONV_FLOAT_PLAN_MASK(src->u.f.esize))
+        return FALSE;           /* Infinity or NaN */
+
+    expo = (int64_t)e - (int64_t)src->u.f.ebias + (int64_t)dst->u.f.ebias;
+    if(expo <= 0 || expo >= expo_max)
+        return FALSE;           /* Denormalized or overflowed result */
+
+    if(src->u.f.msize > dst->u.f.msize) {
+        size_t drop = src->u.f.msize - dst->u.f.msize;
+        uint64_t hi = m >> drop;
+
+        /* Round half up, unless that would carry into infinity */
+        if(((m >> (drop - 1)) & 1) && (hi != H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.msize) || expo < expo_max - 1)) {
+            if(++hi > H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.msize)) {
+                hi = 0;
+                expo++;
+            } /* end if */
+        } /* end if */
+        m = hi;
+    } /* end if */
+    else
+        m <<= dst->u.f.msize - src->u.f.msize;
+
+    *w = (sign << dst->u.f.sign) | ((uint64_t)expo << dst->u.f.epos) | (m << dst->u.f.mpos) | plan->dst_pad;
+    return TRUE;
+} /* end H5T_conv_float_plan_f_f() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_float_plan_f_i
+ *
+ * Purpose:	Convert the normalized floating-point value in word V to the
+ *		destination integer, truncating toward zero and clipping to
+ *		the integer's range the same way H5T__conv_f_i does when no
+ *		exception callback is set.  Denormalized values, infinities
+ *		and NaNs are left to the reference code.
+ *
+ * Return:	TRUE if *W holds the result, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE hbool_t
+H5T_conv_float_plan_f_i(const H5T_conv_float_plan_t *plan, uint64_t v, uint64_t *w)
+{
+    const H5T_atomic_t *src = &plan->src;
+    const H5T_atomic_t *dst = &plan->dst;
+    uint64_t    sign = (v >> src->u.f.sign) & 1;
+    uint64_t    m = (v >> src->u.f.mpos) & H5T_CONV_FLOAT_PLAN_MASK(src->u.f.msize);
+    uint64_t    e = (v >> src->u.f.epos) & H5T_CONV_FLOAT_PLAN_MASK(src->u.f.esize);
+    uint64_t    mag = 0;                /* Magnitude of the integer part */
+    uint64_t    x;                      /* Destination value */
+    int64_t     expo;
+    size_t      first = 0;              /* Most significant bit of MAG */
+
+    if(0 == e) {
+        if(m)
+            return FALSE;       /* Denormalized */
+    } /* end if */
+    else {
+        if(e == H5T_CONV_FLOAT_PLAN_MASK(src->u.f.esize))
+            return FALSE;       /* Infinity or NaN */
+
+        expo = (int64_t)e - (int64_t)src->u.f.ebias;
+        if(expo >= 64)
+            first = (size_t)expo;   /* Clipped below whatever MAG would be */
+        else if(expo >= 0) {
+            m |= (uint64_t)1 << src->u.f.msize;
+            mag = (size_t)expo >= src->u.f.msize ? m << ((size_t)expo - src->u.f.msize) : m >> (src->u.f.msize - (size_t)expo);
+            first = (size_t)expo;
+        } /* end if */
+    } /* end else */
+
+    if(0 == mag && first < 64)
+        x = 0;
+    else if(H5T_SGN_NONE == dst->u.i.sign) {
+        if(sign)
+            x = 0;
+        else if(first >= dst->prec)
+            x = H5T_CONV_FLOAT_PLAN_MASK(dst->prec);
+        else
+            x = mag;
+    } /* end if */
+    else {
+        if(sign)
+            x = first < dst->prec - 1 ? (0 - mag) & H5T_CONV_FLOAT_PLAN_MASK(dst->prec) : (uint64_t)1 << (dst->prec - 1);
+        else
+            x = first >= dst->prec - 1 ? H5T_CONV_FLOAT_PLAN_MASK(dst->prec - 1) : mag;
+    } /* end else */
+
+    *w = (x << dst->offset) | plan->dst_pad;
+    return TRUE;
+} /* end H5T_conv_float_plan_f_i() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_float_plan_i_f
+ *
+ * Purpose:	Convert the integer in word V to the destination
+ *		floating-point format, rounding and clipping the same way
+ *		H5T__conv_i_f does.  When an exception callback is set,
+ *		values that would raise an exception are left to the
+ *		reference code.
+ *
+ * Return:	TRUE if *W holds the result, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE hbool_t
+H5T_conv_float_plan_i_f(const H5T_conv_float_plan_t *plan, uint64_t v, uint64_t *w,
+    hbool_t have_cb)
+{
+    const H5T_atomic_t *src = &plan->src;
+    const H5T_atomic_t *dst = &plan->dst;
+    uint64_t    x = (v >> src->offset) & H5T_CONV_FLOAT_PLAN_MASK(src->prec);
+    uint64_t    neg = (H5T_SGN_2 == src->u.i.sign) ? (x >> (src->prec - 1)) & 1 : 0;
+    uint64_t    mag = neg ? (0 - x) & H5T_CONV_FLOAT_PLAN_MASK(src->prec) : x;
+    uint64_t    expo_max = H5T_CONV_FLOAT_PLAN_MASK(dst->u.f.esize);
+    uint64_t    expo;
+    size_t      first;                  /* Most significant bit of MAG */
+
+    if(0 == mag) {
+        *w = plan->dst_pad;
+        return TRUE;
+    } /* end if */
+
+    first = (size_t)H5VM_log2_gen(mag);
+    expo = first + dst->u.f.ebias;
+    mag &= ~((uint64_t)1 << first);     /* Implied bit */
+
+    if(first > dst->u.f.msize) {
+        size_t drop = first - dst->u.f.msize;
+        hbool_t do_round;
+
+        if(have_cb)
+            return FALSE;       /* Precision exception */
+
+        /* Round to nearest, ties to even */
+        do_round = (hbool_t)((mag >> (drop - 1)) & 1);
+        if(do_round && 0 == (mag & H5T_CONV_FLOAT_PLAN_MASK(drop - 1)))
+            do_round = (hbool_t)((mag >> drop) & 1);
+        mag >>= drop;
+        if(do_round && (++mag >> dst->u.f.msize)) {
+            mag = 0;
+            expo++;
+        } /* end if */
+    } /* end if */
+    else
+        mag <<= dst->u.f.msize - first;
+
+    if(expo > expo_max) {
+        if(have_cb)
+            return FALSE;       /* Overflow exception */
+        expo = expo_max;
+        mag = 0;
+    } /* end if */
+
+    *w = (neg << dst->u.f.sign) | (expo << dst->u.f.epos) | (mag << dst->u.f.mpos) | plan->dst_pad;
+    return TRUE;
+} /* end H5T_conv_float_plan_i_f() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_float_plan_conv
+ *
+ * Purpose:	Convert NELMTS values with the plan in CDATA->PRIV.  Each
+ *		value is loaded into a 64-bit word through the plan's byte
+ *		permutation, converted with shifts and masks and stored back
+ *		the same way.  Values the word kernels don't handle are
+ *		converted one at a time by REF, the bit-field conversion
+ *		function that built the plan, so exception callbacks and the
+ *		results for special values are exactly the reference ones.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_float_plan_conv(H5T_conv_t ref, hid_t src_id, hid_t dst_id,
+    H5T_cdata_t *cdata, size_t nelmts, size_t buf_stride, void *buf,
+    hid_t dxpl_id)
+{
+    const H5T_conv_float_plan_t *plan = (const H5T_conv_float_plan_t *)cdata->priv;
+    H5T_cdata_t ref_cdata;              /* Conversion data for the reference function */
+    H5P_genplist_t *plist;              /* Property list pointer */
+    H5T_conv_cb_t cb_struct = {NULL, NULL};     /* Conversion callback structure */
+    hbool_t     have_cb;                /* Whether an exception callback is set */
+    ssize_t     src_delta, dst_delta;   /* Source & destination stride */
+    uint8_t     *sp, *dp;               /* Source and dest traversal ptrs */
+    uint8_t     tmp[8];                 /* Value handed to the reference function */
+    uint64_t    v, w = 0;               /* Source and destination words */
+    hbool_t     done;                   /* Whether the kernel converted the value */
+    size_t      elmtno, j;              /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(plan);
+
+    /* The reference function must not find the plan again */
+    ref_cdata = *cdata;
+    ref_cdata.priv = NULL;
+
+    /* Get conversion exception callback property */
+    if(NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find property list for ID")
+    if(H5P_get(plist, H5D_XFER_CONV_CB_NAME, &cb_struct) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+    have_cb = (hbool_t)(NULL != cb_struct.func);
+
+    /* Float-to-integer conversion raises a truncation exception for almost
+     * every value when there's a callback, so leave it all to the reference */
+    if(have_cb && H5T_CONV_FLOAT_PLAN_F_I == plan->kind) {
+        if((ref)(src_id, dst_id, &ref_cdata, nelmts, buf_stride, (size_t)0, buf, NULL, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    if(0 == nelmts)
+        HGOTO_DONE(SUCCEED)
+
+    /* Walk the buffer the same direction as the reference function does.
+     * Each value is read completely before its destination is written, so
+     * no temporary destination buffer is needed. */
+    H5_CHECK_OVERFLOW(buf_stride, size_t, ssize_t);
+    if(buf_stride || plan->src_size >= plan->dst_size) {
+        sp = dp = (uint8_t *)buf;
+        src_delta = (ssize_t)(buf_stride ? buf_stride : plan->src_size);
+        dst_delta = (ssize_t)(buf_stride ? buf_stride : plan->dst_size);
+    } /* end if */
+    else {
+        sp = (uint8_t *)buf + (nelmts - 1) * plan->src_size;
+        dp = (uint8_t *)buf + (nelmts - 1) * plan->dst_size;
+        src_delta = -(ssize_t)plan->src_size;
+        dst_delta = -(ssize_t)plan->dst_size;
+    } /* end else */
 
-                /* Advance source & destination pointers by delta amounts */
-                sp += src_delta;
-                dp += dst_delta;
-            } /* end for */
+    for(elmtno = 0; elmtno < nelmts; elmtno++) {
+        v = 0;
+        for(j = 0; j < plan->src_size; j++)
+            v |= (uint64_t)sp[plan->src_perm[j]] << (8 * j);
 
-            break;
+        switch(plan->kind) {
+            case H5T_CONV_FLOAT_PLAN_F_F:
+                done = H5T_conv_float_plan_f_f(plan, v, &w);
+                break;
 
-        default:
-            HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "unknown conversion command")
-    } /* end switch */
+            case H5T_CONV_FLOAT_PLAN_F_I:
+                done = H5T_conv_float_plan_f_i(plan, v, &w);
+                break;
+
+            case H5T_CONV_FLOAT_PLAN_I_F:
+            default:
+                done = H5T_conv_float_plan_i_f(plan, v, &w, have_cb);
+                break;
+        } /* end switch */
+
+        if(done) {
+            for(j = 0; j < plan->dst_size; j++)
+                dp[j] = (uint8_t)(w >> (8 * plan->dst_perm[j]));
+        } /* end if */
+        else {
+            HDmemcpy(tmp, sp, plan->src_size);
+            if((ref)(src_id, dst_id, &ref_cdata, (size_t)1, (size_t)0, (size_t)0, tmp, NULL, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+            HDmemcpy(dp, tmp, plan->dst_size);
+        } /* end else */
+
+        sp += src_delta;
+        dp += dst_delta;
+    } /* end for */
 
 done:
-    if(src_rev)
-        H5MM_free(src_rev);
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5T__conv_i_i() */
+} /* end H5T_conv_float_plan_conv() */
 
 
 /*-------------------------------------------------------------------------
@@ -4057,12 +4813,24 @@ H5T__conv_f_f(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(8 * sizeof(expo) - 1 < src.u.f.esize || 8 * sizeof(expo) - 1 < dst.u.f.esize)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "exponent field is too large")
             cdata->need_bkg = H5T_BKG_NO;
+
+            /* Build the word-at-a-time plan, when the types allow one */
+            if(H5T_conv_float_plan_init(src_p, dst_p, H5T_CONV_FLOAT_PLAN_F_F, cdata) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion plan")
             break;
 
         case H5T_CONV_FREE:
+            cdata->priv = H5MM_xfree(cdata->priv);
             break;
 
         case H5T_CONV_CONV:
+            /* Convert whole words with the plan, if there is one */
+            if(cdata->priv) {
+                if(H5T_conv_float_plan_conv(H5T__conv_f_f, src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+                break;
+            } /* end if */
+
             /* Get the datatypes */
             if(NULL == (src_p = (H5T_t *)H5I_object(src_id)) || NULL == (dst_p = (H5T_t *)H5I_object(dst_id)))
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
@@ -4119,6 +4887,8 @@ H5T__conv_f_f(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                 /* Set these variables to default */
                 except_ret = H5T_CONV_UNHANDLED;
                 reverse    = TRUE;
+                denormalized = FALSE;
+                carry      = FALSE;
 
                 /*
                  * If the source and destination buffers overlap then use a
@@ -4586,6 +5356,8 @@ H5T__conv_s_s(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     size_t	elmtno;			/*element number		*/
     size_t	olap;			/*num overlapping elements	*/
     size_t	nchars=0;		/*number of characters copied	*/
+    size_t      src_size, dst_size;     /*source & destination sizes    */
+    const uint8_t *nul;                 /*first nul in a source string  */
     uint8_t	*s, *sp, *d, *dp;	/*src and dst traversal pointers*/
     uint8_t	*dbuf=NULL;		/*temp buf for overlap convers.	*/
     herr_t      ret_value=SUCCEED;       /* Return value */
@@ -4662,6 +5434,17 @@ H5T__conv_s_s(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(NULL == (dbuf = (uint8_t *)H5MM_malloc(dst->shared->size)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for string conversion")
 
+            /*
+             * Each string is scanned with memchr() for its terminator, its
+             * characters are copied in one block (not at all when the
+             * conversion is in place) and the rest of the destination is
+             * filled in one block.  So a conversion between the same size
+             * strings that only changes the padding doesn't move any
+             * characters.
+             */
+            src_size = src->shared->size;
+            dst_size = dst->shared->size;
+
             /* The conversion loop. */
             for(elmtno = 0; elmtno < nelmts; elmtno++) {
 
@@ -4692,26 +5475,19 @@ H5T__conv_s_s(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                 /* Copy characters from source to destination */
                 switch(src->shared->u.atomic.u.s.pad) {
                     case H5T_STR_NULLTERM:
-                        for (nchars=0;
-                             nchars<dst->shared->size && nchars<src->shared->size && s[nchars];
-                             nchars++) {
-                            d[nchars] = s[nchars];
-                        }
-                        break;
-
                     case H5T_STR_NULLPAD:
-                        for (nchars=0;
-                             nchars<dst->shared->size && nchars<src->shared->size && s[nchars];
-                             nchars++) {
-                            d[nchars] = s[nchars];
-                        }
+                        nchars = MIN(dst_size, src_size);
+                        if(NULL != (nul = (const uint8_t *)HDmemchr(s, '\0', nchars)))
+                            nchars = (size_t)(nul - s);
+                        if(d != s)
+                            HDmemcpy(d, s, nchars);
                         break;
 
                     case H5T_STR_SPACEPAD:
-                        nchars = src->shared->size;
+                        nchars = src_size;
                         while (nchars>0 && ' '==s[nchars-1])
                             --nchars;
-                        nchars = MIN(dst->shared->size, nchars);
+                        nchars = MIN(dst_size, nchars);
                         if(d != s)
                             HDmemcpy(d, s, nchars);
                         break;
@@ -4737,19 +5513,16 @@ H5T__conv_s_s(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                 /* Terminate or pad the destination */
                 switch(dst->shared->u.atomic.u.s.pad) {
                     case H5T_STR_NULLTERM:
-                        while(nchars < dst->shared->size)
-                            d[nchars++] = '\0';
-                        d[dst->shared->size - 1] = '\0';
+                        HDmemset(d + nchars, '\0', dst_size - nchars);
+                        d[dst_size - 1] = '\0';
                         break;
 
                     case H5T_STR_NULLPAD:
-                        while(nchars < dst->shared->size)
-                            d[nchars++] = '\0';
+                        HDmemset(d + nchars, '\0', dst_size - nchars);
                         break;
 
                     case H5T_STR_SPACEPAD:
-                        while(nchars < dst->shared->size)
-                            d[nchars++] = ' ';
+                        HDmemset(d + nchars, ' ', dst_size - nchars);
                         break;
 
                     case H5T_STR_RESERVED_3:
@@ -7272,6 +8045,382 @@ H5T__conv_ldouble_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__round_shift
+ *
+ * Purpose:	Shift an integer mantissa right by SHIFT bits, rounding the
+ *		bits shifted out to nearest, ties to even.
+ *
+ * Return:	The rounded, shifted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint64_t
+H5T__round_shift(uint64_t v, unsigned shift)
+{
+    uint64_t    q = v >> shift;                 /* Truncated value */
+    uint64_t    rem = v & (((uint64_t)1 << shift) - 1); /* Bits shifted out */
+    uint64_t    half = (uint64_t)1 << (shift - 1);      /* Halfway point */
+
+    if(rem > half || (rem == half && (q & 1)))
+        q++;
+
+    return q;
+} /* end H5T__round_shift() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__double_to_small_float
+ *
+ * Purpose:	Convert a double to a 16-bit IEEE-style float with EBITS
+ *		exponent bits and MBITS mantissa bits, rounding to nearest,
+ *		ties to even.  Values too large for the type become
+ *		infinity, values too small become (signed) zero or
+ *		denormalized, and NaNs stay (quiet) NaNs.
+ *
+ *		Rounding directly from double avoids the double-rounding
+ *		errors of converting through float.
+ *
+ * Return:	The bit pattern of the converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint16_t
+H5T__double_to_small_float(double x, unsigned ebits, unsigned mbits)
+{
+    uint64_t    u;                      /* Bits of the double */
+    uint64_t    mant;                   /* Mantissa, with implied bit */
+    uint16_t    sign;                   /* Sign bit of the result */
+    unsigned    emax = (1u << ebits) - 1;       /* All-ones exponent */
+    int         exp;                    /* Biased exponent of the result */
+
+    HDmemcpy(&u, &x, sizeof(u));
+    sign = (uint16_t)((u >> 48) & 0x8000);
+    exp = (int)((u >> 52) & 0x7ff);
+    mant = u & (((uint64_t)1 << 52) - 1);
+
+    /* Infinity & NaN */
+    if(exp == 0x7ff) {
+        if(mant)
+            return (uint16_t)(sign | (emax << mbits) | (1u << (mbits - 1)) | (unsigned)(mant >> (52 - mbits)));
+        return (uint16_t)(sign | (emax << mbits));
+    } /* end if */
+
+    /* Zero.  Denormalized doubles are far below the smallest 16-bit value
+     * and round to zero below. */
+    if(exp == 0 && mant == 0)
+        return sign;
+
+    mant |= (uint64_t)1 << 52;
+    exp = exp - 1023 + (int)(emax >> 1);
+    if(exp >= (int)emax)
+        return (uint16_t)(sign | (emax << mbits));
+    if(exp >= 1)
+        /* Normalized.  Adding the rounded mantissa (with its implied bit) to
+         * the exponent field one below carries into the exponent when the
+         * mantissa rounds up, and into infinity past the largest value. */
+        return (uint16_t)(sign + (((unsigned)(exp - 1) << mbits) + (unsigned)H5T__round_shift(mant, 52 - mbits)));
+    else {
+        /* Denormalized, or rounds up to the smallest normalized value */
+        unsigned shift = 52 - mbits + (unsigned)(1 - exp);
+
+        if(shift > 53)
+            return sign;
+        return (uint16_t)(sign | (unsigned)H5T__round_shift(mant, shift));
+    } /* end else */
+} /* end H5T__double_to_small_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__float16_to_float
+ *
+ * Purpose:	Convert an IEEE half-precision float to float.  This is
+ *		always exact.
+ *
+ * Return:	The converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE float
+H5T__float16_to_float(uint16_t h)
+{
+#ifdef __F16C__
+    return _cvtsh_ss(h);
+#else /* __F16C__ */
+    uint32_t    u;                      /* Bits of the float */
+    uint32_t    exp = (h >> 10) & 0x1f; /* Exponent */
+    uint32_t    mant = h & 0x3ffu;      /* Mantissa */
+    float       f;                      /* Result */
+
+    if(exp == 0x1f)
+        /* Infinity & NaN */
+        u = 0x7f800000u | (mant << 13);
+    else if(exp == 0) {
+        /* Zero & denormalized values, which are exact in float */
+        f = (float)mant * 5.9604644775390625e-8f;        /* 2^-24 */
+        return (h & 0x8000) ? -f : f;
+    } /* end if */
+    else
+        u = ((exp + 112) << 23) | (mant << 13);
+    u |= (uint32_t)(h & 0x8000) << 16;
+
+    HDmemcpy(&f, &u, sizeof(f));
+    return f;
+#endif /* __F16C__ */
+} /* end H5T__float16_to_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__float_to_float16
+ *
+ * Purpose:	Convert a float to an IEEE half-precision float, rounding to
+ *		nearest, ties to even.
+ *
+ * Return:	The bit pattern of the converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint16_t
+H5T__float_to_float16(float f)
+{
+#ifdef __F16C__
+    return (uint16_t)_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT);
+#else /* __F16C__ */
+    /* float to double is exact, so this rounds only once */
+    return H5T__double_to_small_float((double)f, 5, 10);
+#endif /* __F16C__ */
+} /* end H5T__float_to_float16() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__bfloat16_to_float
+ *
+ * Purpose:	Convert a bfloat16 to float.  A bfloat16 is the high half of
+ *		a float, so this is always exact.
+ *
+ * Return:	The converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE float
+H5T__bfloat16_to_float(uint16_t h)
+{
+    uint32_t    u = (uint32_t)h << 16;  /* Bits of the float */
+    float       f;                      /* Result */
+
+    HDmemcpy(&f, &u, sizeof(f));
+    return f;
+} /* end H5T__bfloat16_to_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__float_to_bfloat16
+ *
+ * Purpose:	Convert a float to bfloat16, rounding to nearest, ties to
+ *		even.  Rounding up past the largest value carries into
+ *		infinity.
+ *
+ * Return:	The bit pattern of the converted value
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_INLINE uint16_t
+H5T__float_to_bfloat16(float f)
+{
+    uint32_t    u;                      /* Bits of the float */
+
+    HDmemcpy(&u, &f, sizeof(u));
+
+    /* Keep NaNs NaNs (and quiet), rounding could turn them into infinity */
+    if((u & 0x7fffffffu) > 0x7f800000u)
+        return (uint16_t)((u >> 16) | 0x40);
+
+    u += 0x7fffu + ((u >> 16) & 1);
+    return (uint16_t)(u >> 16);
+} /* end H5T__float_to_bfloat16() */
+
+/* The 16-bit float conversions can't be done with a cast, so always use
+ * their own cores, even when hardware conversion exceptions are disabled.
+ */
+#ifndef H5_WANT_DCONV_EXCEPTION
+#undef H5T_CONV_LOOP_GUTS
+#define H5T_CONV_LOOP_GUTS(GUTS,STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX)			      \
+        H5_GLUE(GUTS,_CORE)(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX)
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_float16_float
+ *
+ * Purpose:	Convert native IEEE 16-bit float to native `float' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float16_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_hF(FLOAT16, FLOAT, uint16_t, float, H5T_FLOAT16_NEG_INF, H5T_FLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_float16_double
+ *
+ * Purpose:	Convert native IEEE 16-bit float to native `double' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float16_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_hF(FLOAT16, DOUBLE, uint16_t, double, H5T_FLOAT16_NEG_INF, H5T_FLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_float_float16
+ *
+ * Purpose:	Convert native `float' to native IEEE 16-bit float using hardware.
+ *		This is a fast special case. Values are rounded to
+ *		nearest, ties to even.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float_float16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_Fh(FLOAT, FLOAT16, float, uint16_t, H5T_FLOAT16_NEG_INF, H5T_FLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_double_float16
+ *
+ * Purpose:	Convert native `double' to native IEEE 16-bit float using hardware.
+ *		This is a fast special case. Values are rounded to
+ *		nearest, ties to even.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_double_float16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_Fh(DOUBLE, FLOAT16, double, uint16_t, H5T_FLOAT16_NEG_INF, H5T_FLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_bfloat16_float
+ *
+ * Purpose:	Convert native bfloat16 to native `float' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_bfloat16_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_hF(BFLOAT16, FLOAT, uint16_t, float, H5T_BFLOAT16_NEG_INF, H5T_BFLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_bfloat16_double
+ *
+ * Purpose:	Convert native bfloat16 to native `double' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_bfloat16_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_hF(BFLOAT16, DOUBLE, uint16_t, double, H5T_BFLOAT16_NEG_INF, H5T_BFLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_float_bfloat16
+ *
+ * Purpose:	Convert native `float' to native bfloat16 using hardware.
+ *		This is a fast special case. Values are rounded to
+ *		nearest, ties to even.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float_bfloat16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_Fh(FLOAT, BFLOAT16, float, uint16_t, H5T_BFLOAT16_NEG_INF, H5T_BFLOAT16_POS_INF);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_double_bfloat16
+ *
+ * Purpose:	Convert native `double' to native bfloat16 using hardware.
+ *		This is a fast special case. Values are rounded to
+ *		nearest, ties to even.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_double_bfloat16(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t H5_ATTR_UNUSED dxpl_id)
+{
+    H5T_CONV_Fh(DOUBLE, BFLOAT16, double, uint16_t, H5T_BFLOAT16_NEG_INF, H5T_BFLOAT16_POS_INF);
+}
+
+/* Back to the common "no exception" core for the remaining conversions */
+#ifndef H5_WANT_DCONV_EXCEPTION
+#undef H5T_CONV_LOOP_GUTS
+#define H5T_CONV_LOOP_GUTS(GUTS,STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX)			      \
+        H5_GLUE(H5T_CONV_NO_EXCEPT,_CORE)(STYPE,DTYPE,S,D,ST,DT,D_MIN,D_MAX)
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_schar_float
@@ -8915,12 +10064,24 @@ H5T__conv_f_i(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(8 * sizeof(expo) - 1 < src.u.f.esize)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "exponent field is too large")
             cdata->need_bkg = H5T_BKG_NO;
+
+            /* Build the word-at-a-time plan, when the types allow one */
+            if(H5T_conv_float_plan_init(src_p, dst_p, H5T_CONV_FLOAT_PLAN_F_I, cdata) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion plan")
             break;
 
         case H5T_CONV_FREE:
+            cdata->priv = H5MM_xfree(cdata->priv);
             break;
 
         case H5T_CONV_CONV:
+            /* Convert whole words with the plan, if there is one */
+            if(cdata->priv) {
+                if(H5T_conv_float_plan_conv(H5T__conv_f_i, src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+                break;
+            } /* end if */
+
             /* Get the datatypes */
             if(NULL == (src_p = (H5T_t*)H5I_object(src_id)) || NULL == (dst_p = (H5T_t*)H5I_object(dst_id)))
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
@@ -8952,9 +10113,12 @@ H5T__conv_f_i(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             }
 
             /* Allocate enough space for the buffer holding temporary
-             * converted value
+             * converted value.  Negative values are copied out with the
+             * full destination precision, so it must cover that too.
              */
             buf_size = (size_t) (HDpow((double)2.0f, (double)src.u.f.esize) / 8 + 1);
+            if(buf_size < dst.prec / 8 + 1)
+                buf_size = dst.prec / 8 + 1;
             int_buf = (uint8_t*)H5MM_calloc(buf_size);
 
             /* Get the plist structure. Do I need to close it? */
@@ -9503,12 +10667,24 @@ H5T__conv_i_f(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(8 * sizeof(expo) - 1 < src.u.f.esize)
                 HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "exponent field is too large")
             cdata->need_bkg = H5T_BKG_NO;
+
+            /* Build the word-at-a-time plan, when the types allow one */
+            if(H5T_conv_float_plan_init(src_p, dst_p, H5T_CONV_FLOAT_PLAN_I_F, cdata) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion plan")
             break;
 
         case H5T_CONV_FREE:
+            cdata->priv = H5MM_xfree(cdata->priv);
             break;
 
         case H5T_CONV_CONV:
+            /* Convert whole words with the plan, if there is one */
+            if(cdata->priv) {
+                if(H5T_conv_float_plan_conv(H5T__conv_i_f, src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+                break;
+            } /* end if */
+
             /* Get the datatypes */
             if(NULL == (src_p = (H5T_t *)H5I_object(src_id)) || NULL == (dst_p = (H5T_t *)H5I_object(dst_id)))
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
@@ -39,6 +39,7 @@
 /* Other private headers needed by this file */
 #include "H5Fprivate.h"		/* Files				*/
 #include "H5FLprivate.h"	/* Free Lists				*/
+#include "H5HGprivate.h"	/* Global heaps				*/
 #include "H5Oprivate.h"		/* Object headers		  	*/
 
 /* Other public headers needed by this file */
@@ -158,6 +159,8 @@ struct H5T_path_t {
     hbool_t	is_hard;		/*is it a hard function?	     */
     hbool_t	is_noop;		/*is it the noop conversion?	     */
     hbool_t	are_compounds;		/*are source and dest both compounds?*/
+    uint32_t	src_hash;		/*structural hash of source type     */
+    uint32_t	dst_hash;		/*structural hash of destination type*/
     H5T_stats_t	stats;			/*statistics for the conversion	     */
     H5T_cdata_t	cdata;			/*data for this function	     */
 };
@@ -246,6 +249,20 @@ typedef enum {
     H5T_VLEN_MAXTYPE        /* highest type (Invalid as true type) */
 } H5T_vlen_type_t;
 
+/* Sequences of disk-based VL elements read or written together
+ * (H5T__vlen_disk_read_batch, H5T__vlen_disk_write_batch) */
+typedef struct H5T_vlen_batch_t {
+    size_t      nalloc;         /* # of elements allocated in the arrays */
+    H5HG_read_req_t *reqs;      /* Global heap objects to read */
+    H5HG_insert_req_t *ireqs;   /* Global heap objects to insert */
+    size_t      nireqs;         /* # of global heap objects to insert */
+    uint8_t     **seqs;         /* Each element's sequence (NULL for "nil") when
+                                 * reading, its disk VL information when writing */
+    size_t      buf_size;       /* Size of the sequence buffer in bytes */
+    size_t      buf_used;       /* # of bytes of the buffer in use when writing */
+    uint8_t     *buf;           /* Buffer holding all sequences of the batch */
+} H5T_vlen_batch_t;
+
 /* A VL datatype */
 typedef struct H5T_vlen_t {
     H5T_vlen_type_t     type;   /* Type of VL data in buffer */
@@ -290,6 +307,8 @@ typedef struct H5T_shared_t {
     size_t		size;	/*total size of an instance of this type     */
     unsigned            version;        /* Version of object header message to encode this object with */
     hbool_t		force_conv;/* Set if this type always needs to be converted and H5T__conv_noop cannot be called */
+    hbool_t		hash_valid;/* Set if 'hash' is up to date (only for types that aren't transient) */
+    uint32_t		hash;	/*structural hash of the type, see H5T_struct_hash() */
     struct H5T_t	*parent;/*parent type for derived datatypes	     */
     union {
         H5T_atomic_t	atomic; /* an atomic datatype              */
@@ -376,6 +395,9 @@ H5_DLLVAR size_t	H5T_NATIVE_DOUBLE_ALIGN_g;
 #if H5_SIZEOF_LONG_DOUBLE !=0
 H5_DLLVAR size_t	H5T_NATIVE_LDOUBLE_ALIGN_g;
 #endif
+/* Read by the 16-bit float hard conversions, through H5T_CONV */
+H5_DLLVAR size_t	H5T_NATIVE_FLOAT16_ALIGN_g;
+H5_DLLVAR size_t	H5T_NATIVE_BFLOAT16_ALIGN_g;
 
 /* C9x alignment constraints */
 H5_DLLVAR size_t	H5T_NATIVE_INT8_ALIGN_g;
@@ -974,6 +996,46 @@ H5_DLL herr_t H5T__conv_ldouble_double(hid_t src_id, hid_t dst_id,
 				     size_t buf_stride, size_t bkg_stride,
                                      void *buf, void *bkg,
                                      hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_float16_float(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_float16_double(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_float_float16(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_double_float16(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_bfloat16_float(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_bfloat16_double(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_float_bfloat16(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_double_bfloat16(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
 H5_DLL herr_t H5T__conv_schar_float(hid_t src_id, hid_t dst_id,
 				     H5T_cdata_t *cdata, size_t nelmts,
 				     size_t buf_stride, size_t bkg_stride,
@@ -1293,6 +1355,15 @@ H5_DLL void H5T__bit_neg(uint8_t *buf, size_t start, size_t size);
 /* VL functions */
 H5_DLL H5T_t * H5T__vlen_create(H5T_t *base);
 H5_DLL htri_t H5T__vlen_set_loc(const H5T_t *dt, H5F_t *f, H5T_loc_t loc);
+H5_DLL herr_t H5T__vlen_disk_read_batch(const H5T_t *dt, hid_t dxpl_id,
+    const uint8_t *s, ssize_t s_stride, size_t nelmts, size_t base_size,
+    H5T_vlen_batch_t *batch, size_t *nread);
+H5_DLL herr_t H5T__vlen_disk_write_batch(const H5T_t *dt, hid_t dxpl_id,
+    void *vl, const void *seq, hbool_t copy, size_t seq_len, size_t base_size,
+    void *bg, H5T_vlen_batch_t *batch);
+H5_DLL herr_t H5T__vlen_disk_write_batch_flush(const H5T_t *dt, hid_t dxpl_id,
+    H5T_vlen_batch_t *batch);
+H5_DLL void H5T__vlen_batch_free(H5T_vlen_batch_t *batch);
 
 /* Array functions */
 H5_DLL H5T_t *H5T__array_create(H5T_t *base, unsigned ndims, const hsize_t dim[/* ndims */]);
@@ -225,15 +225,28 @@ typedef H5T_conv_ret_t (*H5T_conv_except_func_t)(H5T_conv_except_t except_type,
 /*
  * The IEEE floating point types in various byte orders.
  */
+#define H5T_IEEE_F16BE		(H5OPEN H5T_IEEE_F16BE_g)
+#define H5T_IEEE_F16LE		(H5OPEN H5T_IEEE_F16LE_g)
 #define H5T_IEEE_F32BE		(H5OPEN H5T_IEEE_F32BE_g)
 #define H5T_IEEE_F32LE		(H5OPEN H5T_IEEE_F32LE_g)
 #define H5T_IEEE_F64BE		(H5OPEN H5T_IEEE_F64BE_g)
 #define H5T_IEEE_F64LE		(H5OPEN H5T_IEEE_F64LE_g)
+H5_DLLVAR hid_t H5T_IEEE_F16BE_g;
+H5_DLLVAR hid_t H5T_IEEE_F16LE_g;
 H5_DLLVAR hid_t H5T_IEEE_F32BE_g;
 H5_DLLVAR hid_t H5T_IEEE_F32LE_g;
 H5_DLLVAR hid_t H5T_IEEE_F64BE_g;
 H5_DLLVAR hid_t H5T_IEEE_F64LE_g;
 
+/*
+ * The "brain" floating point type (the upper half of an IEEE 32-bit float,
+ * with an 8-bit exponent and a 7-bit mantissa) in both byte orders.
+ */
+#define H5T_FLOAT_BFLOAT16BE	(H5OPEN H5T_FLOAT_BFLOAT16BE_g)
+#define H5T_FLOAT_BFLOAT16LE	(H5OPEN H5T_FLOAT_BFLOAT16LE_g)
+H5_DLLVAR hid_t H5T_FLOAT_BFLOAT16BE_g;
+H5_DLLVAR hid_t H5T_FLOAT_BFLOAT16LE_g;
+
 /*
  * These are "standard" types.  For instance, signed (2's complement) and
  * unsigned integers of various sizes and byte orders.
@@ -406,6 +419,9 @@ H5_DLLVAR hid_t H5T_VAX_F64_g;
 #if H5_SIZEOF_LONG_DOUBLE !=0
 #define H5T_NATIVE_LDOUBLE	(H5OPEN H5T_NATIVE_LDOUBLE_g)
 #endif
+/* 16-bit floats, held in memory as uint16_t in the machine's byte order */
+#define H5T_NATIVE_FLOAT16      (H5OPEN H5T_NATIVE_FLOAT16_g)
+#define H5T_NATIVE_BFLOAT16     (H5OPEN H5T_NATIVE_BFLOAT16_g)
 #define H5T_NATIVE_B8		(H5OPEN H5T_NATIVE_B8_g)
 #define H5T_NATIVE_B16		(H5OPEN H5T_NATIVE_B16_g)
 #define H5T_NATIVE_B32		(H5OPEN H5T_NATIVE_B32_g)
@@ -431,6 +447,8 @@ H5_DLLVAR hid_t H5T_NATIVE_DOUBLE_g;
 #if H5_SIZEOF_LONG_DOUBLE !=0
 H5_DLLVAR hid_t H5T_NATIVE_LDOUBLE_g;
 #endif
+H5_DLLVAR hid_t H5T_NATIVE_FLOAT16_g;
+H5_DLLVAR hid_t H5T_NATIVE_BFLOAT16_g;
 H5_DLLVAR hid_t H5T_NATIVE_B8_g;
 H5_DLLVAR hid_t H5T_NATIVE_B16_g;
 H5_DLLVAR hid_t H5T_NATIVE_B32_g;
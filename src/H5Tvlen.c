@@ -28,6 +28,13 @@
 #include "H5Pprivate.h"		/* Property lists			*/
 #include "H5Tpkg.h"		/* Datatypes				*/
 
+/* Limits on the elements read from the global heap in one batch */
+#define H5T_VLEN_BATCH_NELMTS   8192
+#define H5T_VLEN_BATCH_SIZE     (1024 * 1024)
+
+/* Round sequence sizes in a batch up to a multiple of 8 bytes */
+#define H5T_VLEN_BATCH_ALIGN(X) (((X) + 7) & ~(size_t)7)
+
 /* Local functions */
 static herr_t H5T_vlen_reclaim_recurse(void *elem, const H5T_t *dt, H5MM_free_t free_func, void *free_info);
 static ssize_t H5T_vlen_seq_mem_getlen(const void *_vl);
@@ -861,6 +868,284 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5T_vlen_disk_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_read_batch
+ *
+ * Purpose:	Reads the sequences of up to NELMTS disk based VL elements,
+ *		starting at S and STRIDE bytes apart, into one buffer.  The
+ *		sequences are read with H5HG_read_batch(), so that each
+ *		global heap collection is protected once per batch rather
+ *		than once per element.
+ *
+ *		Each sequence gets BASE_SIZE bytes (at least the size of
+ *		DT's base type) per sequence element, so that it can be
+ *		converted in place.  On return BATCH->seqs[N] points to the
+ *		sequence of element N (or is NULL if the element is "nil"),
+ *		and *NREAD holds the number of elements in the batch, which
+ *		is limited by the number of bytes in their sequences.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__vlen_disk_read_batch(const H5T_t *dt, hid_t dxpl_id, const uint8_t *s,
+    ssize_t s_stride, size_t nelmts, size_t base_size, H5T_vlen_batch_t *batch,
+    size_t *nread)
+{
+    H5F_t       *f = dt->shared->u.vlen.f;      /* File holding the sequences */
+    const uint8_t *vl;          /* Pointer to the disk VL information */
+    size_t      seq_len;        /* Sequence length */
+    haddr_t     addr;           /* Sequence's heap address */
+    size_t      buf_size = 0;   /* Bytes needed for the sequences */
+    size_t      nreqs = 0;      /* # of heap objects to read */
+    size_t      n, u;           /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(s);
+    HDassert(nelmts > 0);
+    HDassert(base_size >= H5T_get_size(dt->shared->parent));
+    HDassert(batch);
+    HDassert(nread);
+
+    /* Choose the elements of the batch */
+    nelmts = MIN(nelmts, H5T_VLEN_BATCH_NELMTS);
+    for(n = 0, vl = s; n < nelmts; n++, vl += s_stride) {
+        const uint8_t *p = vl;
+        size_t size;
+
+        UINT32DECODE(p, seq_len);
+        H5F_addr_decode(f, &p, &addr);
+        if(addr == 0)
+            continue;
+        size = H5T_VLEN_BATCH_ALIGN(seq_len * base_size);
+        if(n > 0 && buf_size + size > H5T_VLEN_BATCH_SIZE)
+            break;
+        buf_size += size;
+    } /* end for */
+    nelmts = n;
+
+    /* Make room for them */
+    if(batch->nalloc < nelmts) {
+        H5HG_read_req_t *reqs;
+        uint8_t **seqs;
+
+        if(NULL == (reqs = (H5HG_read_req_t *)H5MM_realloc(batch->reqs, nelmts * sizeof(H5HG_read_req_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+        batch->reqs = reqs;
+        if(NULL == (seqs = (uint8_t **)H5MM_realloc(batch->seqs, nelmts * sizeof(uint8_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+        batch->seqs = seqs;
+        batch->nalloc = nelmts;
+    } /* end if */
+    if(batch->buf_size < buf_size || NULL == batch->buf) {
+        batch->buf = (uint8_t *)H5MM_xfree(batch->buf);
+        batch->buf_size = 0;
+        if(NULL == (batch->buf = (uint8_t *)H5MM_malloc(MAX(buf_size, H5T_VLEN_BATCH_ALIGN(1)))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+        batch->buf_size = MAX(buf_size, H5T_VLEN_BATCH_ALIGN(1));
+    } /* end if */
+
+    /* Lay out the sequences and read them */
+    buf_size = 0;
+    for(u = 0, vl = s; u < nelmts; u++, vl += s_stride) {
+        const uint8_t *p = vl;
+        size_t size;
+
+        UINT32DECODE(p, seq_len);
+        H5F_addr_decode(f, &p, &addr);
+        if(addr == 0) {
+            batch->seqs[u] = NULL;
+            continue;
+        } /* end if */
+        size = H5T_VLEN_BATCH_ALIGN(seq_len * base_size);
+        batch->seqs[u] = batch->buf + buf_size;
+        batch->reqs[nreqs].hobj.addr = addr;
+        UINT32DECODE(p, batch->reqs[nreqs].hobj.idx);
+        batch->reqs[nreqs].buf = batch->seqs[u];
+        batch->reqs[nreqs].buf_size = size;
+        nreqs++;
+        buf_size += size;
+    } /* end for */
+    if(H5HG_read_batch(f, dxpl_id, nreqs, batch->reqs) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "unable to read VL information")
+
+    *nread = nelmts;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5T__vlen_disk_read_batch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_write_batch
+ *
+ * Purpose:	Writes the disk based VL element VL, like
+ *		H5T_vlen_disk_write(), except that its sequence of SEQ_LEN
+ *		elements of BASE_SIZE bytes is only queued for insertion into
+ *		the global heap, along with the rest of BATCH.  The element's
+ *		heap ID is filled in by H5T__vlen_disk_write_batch_flush(),
+ *		which is called here when the batch is full and must be
+ *		called by the caller for the last batch.
+ *
+ *		If COPY is set, SEQ is copied into the batch; otherwise it
+ *		must stay unchanged until the batch is flushed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__vlen_disk_write_batch(const H5T_t *dt, hid_t dxpl_id, void *_vl,
+    const void *seq, hbool_t copy, size_t seq_len, size_t base_size, void *_bg,
+    H5T_vlen_batch_t *batch)
+{
+    H5F_t       *f = dt->shared->u.vlen.f;      /* File to write the sequence to */
+    uint8_t     *vl = (uint8_t *)_vl;   /* Pointer to the disk VL information */
+    uint8_t     *bg = (uint8_t *)_bg;   /* Pointer to the old disk VL information */
+    size_t      size = seq_len * base_size;     /* Size of the sequence in bytes */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check parameters */
+    HDassert(f);
+    HDassert(vl);
+    HDassert(seq_len == 0 || seq);
+    HDassert(batch);
+
+    /* Free heap object for old data.  */
+    if(bg != NULL) {
+        H5HG_t bg_hobjid;       /* "Background" VL info sequence's ID info */
+
+        /* Skip the length of the sequence and heap object ID from background data. */
+        bg += 4;
+
+        /* Get heap information */
+        H5F_addr_decode(f, (const uint8_t **)&bg, &(bg_hobjid.addr));
+        UINT32DECODE(bg, bg_hobjid.idx);
+
+        /* Free heap object for old data */
+        if(bg_hobjid.addr > 0)
+            if(H5HG_remove(f, dxpl_id, &bg_hobjid) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to remove heap object")
+    } /* end if */
+
+    /* Make room for the element */
+    if(NULL == batch->ireqs) {
+        HDassert(NULL == batch->seqs);
+        if(NULL == (batch->ireqs = (H5HG_insert_req_t *)H5MM_malloc(H5T_VLEN_BATCH_NELMTS * sizeof(H5HG_insert_req_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+        if(NULL == (batch->seqs = (uint8_t **)H5MM_malloc(H5T_VLEN_BATCH_NELMTS * sizeof(uint8_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+        batch->nalloc = H5T_VLEN_BATCH_NELMTS;
+    } /* end if */
+    if(batch->nireqs == batch->nalloc)
+        if(H5T__vlen_disk_write_batch_flush(dt, dxpl_id, batch) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "unable to write VL information")
+    if(copy && batch->buf_used + size > batch->buf_size) {
+        if(batch->nireqs > 0)
+            if(H5T__vlen_disk_write_batch_flush(dt, dxpl_id, batch) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "unable to write VL information")
+        if(size > batch->buf_size) {
+            batch->buf = (uint8_t *)H5MM_xfree(batch->buf);
+            batch->buf_size = 0;
+            if(NULL == (batch->buf = (uint8_t *)H5MM_malloc(MAX(size, H5T_VLEN_BATCH_SIZE))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for VL batch")
+            batch->buf_size = MAX(size, H5T_VLEN_BATCH_SIZE);
+        } /* end if */
+    } /* end if */
+
+    /* Set the length of the sequence and queue the sequence */
+    UINT32ENCODE(vl, seq_len);
+    if(copy && size > 0) {
+        HDmemcpy(batch->buf + batch->buf_used, seq, size);
+        seq = batch->buf + batch->buf_used;
+        batch->buf_used += size;
+    } /* end if */
+    batch->ireqs[batch->nireqs].obj = seq;
+    batch->ireqs[batch->nireqs].size = size;
+    batch->seqs[batch->nireqs] = (uint8_t *)_vl;
+    batch->nireqs++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5T__vlen_disk_write_batch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_write_batch_flush
+ *
+ * Purpose:	Inserts the sequences queued in BATCH by
+ *		H5T__vlen_disk_write_batch() into the global heap, in order
+ *		and in new collections (see H5HG_insert_batch), and fills in
+ *		the heap IDs of their elements.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__vlen_disk_write_batch_flush(const H5T_t *dt, hid_t dxpl_id,
+    H5T_vlen_batch_t *batch)
+{
+    H5F_t       *f = dt->shared->u.vlen.f;      /* File to write the sequences to */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f);
+    HDassert(batch);
+
+    if(H5HG_insert_batch(f, dxpl_id, batch->nireqs, batch->ireqs) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to write VL information")
+
+    /* Encode the heap information, after the sequence lengths */
+    for(u = 0; u < batch->nireqs; u++) {
+        uint8_t *vl = batch->seqs[u] + 4;
+
+        H5F_addr_encode(f, &vl, batch->ireqs[u].hobj.addr);
+        UINT32ENCODE(vl, batch->ireqs[u].hobj.idx);
+    } /* end for */
+
+    batch->nireqs = 0;
+    batch->buf_used = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5T__vlen_disk_write_batch_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_batch_free
+ *
+ * Purpose:	Releases the buffers of a batch of VL sequences.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__vlen_batch_free(H5T_vlen_batch_t *batch)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(batch);
+
+    batch->reqs = (H5HG_read_req_t *)H5MM_xfree(batch->reqs);
+    batch->ireqs = (H5HG_insert_req_t *)H5MM_xfree(batch->ireqs);
+    batch->seqs = (uint8_t **)H5MM_xfree(batch->seqs);
+    batch->buf = (uint8_t *)H5MM_xfree(batch->buf);
+    batch->nalloc = batch->nireqs = batch->buf_size = batch->buf_used = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+}   /* end H5T__vlen_batch_free() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_write
@@ -1173,7 +1458,8 @@ done:
     SUCCEED/FAIL
  DESCRIPTION
     Retrieve the VL allocation functions and information from a dataset
-    transfer property list.
+    transfer property list.  If the property list has a VL arena, the arena's
+    allocation functions are used instead.
  GLOBAL VARIABLES
  COMMENTS, BUGS, ASSUMPTIONS
     The VL_ALLOC_INFO pointer should point at already allocated memory to place
@@ -1186,6 +1472,7 @@ herr_t
 H5T_vlen_get_alloc_info(hid_t dxpl_id, H5T_vlen_alloc_info_t **vl_alloc_info)
 {
     H5P_genplist_t *plist;              /* DX property list */
+    H5D_vlen_arena_t *arena;            /* VL data arena */
     herr_t ret_value=SUCCEED;
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -1210,6 +1497,16 @@ H5T_vlen_get_alloc_info(hid_t dxpl_id, H5T_vlen_alloc_info_t **vl_alloc_info)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
         if (H5P_get(plist,H5D_XFER_VLEN_FREE_INFO_NAME,&(*vl_alloc_info)->free_info) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+        if (H5P_get(plist,H5D_XFER_VLEN_ARENA_NAME,&arena) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+        /* An arena takes the place of the allocation functions */
+        if(arena) {
+            (*vl_alloc_info)->alloc_func = H5D_vlen_arena_alloc;
+            (*vl_alloc_info)->alloc_info = arena;
+            (*vl_alloc_info)->free_func = H5D_vlen_arena_free_elmt;
+            (*vl_alloc_info)->free_info = arena;
+        } /* end if */
     } /* end else */
 
 done:
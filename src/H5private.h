@@ -90,6 +90,14 @@
 #   include <sys/stat.h>
 #endif
 
+/*
+ * Memory-mapped files and POSIX shared memory, used by the shared page
+ * buffer.
+ */
+#ifdef H5_HAVE_SYS_MMAN_H
+#   include <sys/mman.h>
+#endif
+
 /*
  * If a program may include both `time.h' and `sys/time.h' then
  * TIME_WITH_SYS_TIME is defined (see AC_HEADER_TIME in configure.ac).
@@ -1110,9 +1118,15 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDmktime
     #define HDmktime(T)    mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+    #define HDmmap(A,L,P,F,D,O)    mmap(A,L,P,F,D,O)
+#endif /* HDmmap */
 #ifndef HDmodf
     #define HDmodf(X,Y)    modf(X,Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+    #define HDmunmap(A,L)    munmap(A,L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
     #define HDnanosleep(N, O)    nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1144,6 +1158,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDpowf
     #define HDpowf(X,Y)   powf(X,Y)
 #endif /* HDpowf */
+#ifndef HDpread
+    #define HDpread(F,M,Z,O)    pread(F,M,Z,O)
+#endif /* HDpread */
 #ifndef HDprintf
     #define HDprintf(...)   HDfprintf(stdout, __VA_ARGS__)
 #endif /* HDprintf */
@@ -1156,6 +1173,9 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDputs
     #define HDputs(S)    puts(S)
 #endif /* HDputs */
+#ifndef HDpwrite
+    #define HDpwrite(F,M,Z,O)    pwrite(F,M,Z,O)
+#endif /* HDpwrite */
 #ifndef HDqsort
     #define HDqsort(M,N,Z,F)  qsort(M,N,Z,F)
 #endif /* HDqsort*/
@@ -1251,6 +1271,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDsetvbuf
     #define HDsetvbuf(F,S,M,Z)  setvbuf(F,S,M,Z)
 #endif /* HDsetvbuf */
+#ifndef HDshm_open
+    #define HDshm_open(S,F,M)  shm_open(S,F,M)
+#endif /* HDshm_open */
+#ifndef HDshm_unlink
+    #define HDshm_unlink(S)  shm_unlink(S)
+#endif /* HDshm_unlink */
 #ifndef HDsigaddset
     #define HDsigaddset(S,N)  sigaddset(S,N)
 #endif /* HDsigaddset */
@@ -971,6 +971,33 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         } /* end else */
                         break;
 
+                    case 'p':
+                        if(ptr) {
+                            if(vp)
+                                fprintf(out, "0x%llx", (unsigned long long)vp);
+                            else
+                                fprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5F_page_buffer_policy_t pb_policy = (H5F_page_buffer_policy_t)va_arg(ap, int);
+
+                            switch(pb_policy) {
+                                case H5F_PAGE_BUFFER_POLICY_LRU:
+                                    fprintf(out, "H5F_PAGE_BUFFER_POLICY_LRU");
+                                    break;
+
+                                case H5F_PAGE_BUFFER_POLICY_2Q:
+                                    fprintf(out, "H5F_PAGE_BUFFER_POLICY_2Q");
+                                    break;
+
+                                case H5F_PAGE_BUFFER_POLICY_NTYPES:
+                                default:
+                                    fprintf(out, "%ld", (long)pb_policy);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
                     case 's':
                         if(ptr) {
                             if(vp)
@@ -42,11 +42,15 @@
 #include "H5FDcore.h"		/* Files stored entirely in memory	*/
 #include "H5FDdirect.h"     	/* Linux direct I/O			*/
 #include "H5FDfamily.h"		/* File families 			*/
+#include "H5FDimage.h"		/* Read-only user-owned file image	*/
 #include "H5FDlog.h"        	/* sec2 driver with I/O logging (for debugging) */
+#include "H5FDmmap.h"        	/* Read-only memory-mapped file I/O	*/
 #include "H5FDmpi.h"            /* MPI-based file drivers		*/
 #include "H5FDmulti.h"		/* Usage-partitioned file family	*/
 #include "H5FDsec2.h"		/* POSIX unbuffered file I/O		*/
 #include "H5FDstdio.h"		/* Standard C buffered I/O		*/
+#include "H5FDstripe.h"		/* Striped file set (RAID-0)		*/
+#include "H5FDtrace.h"		/* Binary I/O trace of another driver	*/
 #ifdef H5_HAVE_WINDOWS
 #include "H5FDwindows.h"        /* Windows buffered I/O     */
 #endif
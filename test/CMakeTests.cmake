@@ -32,6 +32,7 @@ if (HDF5_TEST_VFD)
       stdio
       core
       core_paged
+      core_lazy
       split
       multi
       family
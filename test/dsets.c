@@ -61,6 +61,7 @@ const char *FILENAME[] = {
     "bt2_hdr_fd",       /* 21 */
     "storage_size",	/* 22 */
     "dls_01_strings",   /* 23 */
+    "chunk_alloc_reserve", /* 24 */
     NULL
 };
 #define FILENAME_BUF_SIZE       1024
@@ -244,6 +245,15 @@ const char *FILENAME[] = {
 #define STORAGE_SIZE_CHUNK_DIM1 5
 #define STORAGE_SIZE_CHUNK_DIM2 5
 
+/* Parameters for chunk allocation reservation test */
+#define RESERVE_DIM1            12
+#define RESERVE_DIM2            6
+#define RESERVE_CHUNK_DIM1      5
+#define RESERVE_CHUNK_DIM2      5
+#define RESERVE_ALIGN           512
+#define RESERVE_ALIGN2          20
+#define RESERVE_FILL            7
+
 /* Shared global arrays */
 #define DSET_DIM1       100
 #define DSET_DIM2       200
@@ -1273,14 +1283,17 @@ static herr_t
 test_tconv(hid_t file)
 {
     char	*out = NULL, *in = NULL;
-    hsize_t	dims[1];
-    hid_t	space = -1, dataset = -1;
+    long long	*wide = NULL;
+    hsize_t	dims[1], start[1], count[1];
+    hid_t	space = -1, mspace = -1, dataset = -1, dxpl = -1;
     int		i;
 
     if ((out = (char *)HDmalloc((size_t)(4 * 1000 * 1000))) == NULL)
         goto error;
     if ((in = (char *)HDmalloc((size_t)(4 * 1000 * 1000))) == NULL)
         goto error;
+    if ((wide = (long long *)HDmalloc(2000 * sizeof(long long))) == NULL)
+        goto error;
 
     TESTING("data type conversion");
 
@@ -1321,10 +1334,38 @@ test_tconv(hid_t file)
         }
     }
 
+    /* Read 1000 elements, widened, into the middle of a bigger buffer, with
+     * a type conversion buffer too small to hold them all at once */
+    for(i = 0; i < 2000; i++)
+        wide[i] = -1;
+    start[0] = 1000;
+    count[0] = 1000;
+    if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0) goto error;
+    dims[0] = 2000;
+    if((mspace = H5Screate_simple(1, dims, NULL)) < 0) goto error;
+    start[0] = 500;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0) goto error;
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) goto error;
+    if(H5Pset_buffer(dxpl, (size_t)1024, NULL, NULL) < 0) goto error;
+    if(H5Dread(dataset, H5T_NATIVE_LLONG, mspace, space, dxpl, wide) < 0)
+        goto error;
+
+    /* Check */
+    for(i = 0; i < 2000; i++) {
+        if(wide[i] != ((i < 500 || i >= 1500) ? -1 : 0x44332211)) {
+            H5_FAILED();
+            puts("    Read with widening conversion failed.");
+            goto error;
+        }
+    }
+
+    if(H5Pclose(dxpl) < 0) goto error;
+    if(H5Sclose(mspace) < 0) goto error;
     if(H5Dclose(dataset) < 0) goto error;
     if(H5Sclose(space) < 0) goto error;
     HDfree(out);
     HDfree(in);
+    HDfree(wide);
 
     puts(" PASSED");
     return 0;
@@ -1334,8 +1375,12 @@ error:
         HDfree(out);
     if(in)
         HDfree(in);
+    if(wide)
+        HDfree(wide);
 
     H5E_BEGIN_TRY {
+        H5Pclose(dxpl);
+        H5Sclose(mspace);
         H5Dclose(dataset);
         H5Sclose(space);
     } H5E_END_TRY;
@@ -11345,6 +11390,147 @@ error:
     return -1;
 } /* end test_storage_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_alloc_reserve
+ *
+ * Purpose:     Tests reserving the file space for all the chunks of an
+ *              early allocation at once, when creating and extending a
+ *              dataset, without alignment, with an alignment that would
+ *              need padding between chunks (so chunks are allocated
+ *              individually) and with one that wouldn't.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_alloc_reserve(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       my_fapl = -1;   /* File access property list ID */
+    hid_t       fapl2 = -1;     /* File access property list ID, from file */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2], max_dims[2]; /* Dataset dimensions */
+    hsize_t     chunk_dims[2];  /* Chunk dimensions */
+    hsize_t     ssize;          /* Dataset storage size */
+    hbool_t     reserve;        /* Chunk allocation reservation flag */
+    int         fill = RESERVE_FILL; /* Fill value */
+    int         wdata[RESERVE_DIM1][RESERVE_DIM2];
+    int         rdata[2 * RESERVE_DIM1][2 * RESERVE_DIM2];
+    unsigned    align;          /* How to align the chunks */
+    unsigned    i, j;           /* Local index variables */
+
+    TESTING("reserving file space for chunk allocation");
+
+    h5_fixname(FILENAME[24], fapl, filename, sizeof filename);
+
+    /* Check the default value & setting the flag */
+    if((my_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_alloc_reserve(my_fapl, &reserve) < 0) FAIL_STACK_ERROR
+    if(reserve) TEST_ERROR
+    if(H5Pset_chunk_alloc_reserve(my_fapl, TRUE) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_alloc_reserve(my_fapl, &reserve) < 0) FAIL_STACK_ERROR
+    if(!reserve) TEST_ERROR
+
+    /* Create dataset creation property list, w/early allocation */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dims[0] = RESERVE_CHUNK_DIM1;
+    chunk_dims[1] = RESERVE_CHUNK_DIM2;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0) FAIL_STACK_ERROR
+
+    /* Initialize the data to write */
+    for(i = 0; i < RESERVE_DIM1; i++)
+        for(j = 0; j < RESERVE_DIM2; j++)
+            wdata[i][j] = (int)((i * RESERVE_DIM2) + j);
+
+    for(align = 0; align < 3; align++) {
+        if(align && H5Pset_alignment(my_fapl, (hsize_t)1, (hsize_t)(align == 1 ? RESERVE_ALIGN : RESERVE_ALIGN2)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Create file */
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) FAIL_STACK_ERROR
+
+        /* Check the flag is retrieved from the file */
+        if((fapl2 = H5Fget_access_plist(fid)) < 0) FAIL_STACK_ERROR
+        reserve = FALSE;
+        if(H5Pget_chunk_alloc_reserve(fapl2, &reserve) < 0) FAIL_STACK_ERROR
+        if(!reserve) TEST_ERROR
+        if(H5Pclose(fapl2) < 0) FAIL_STACK_ERROR
+
+        /* Create the chunked dataset (6 chunks) */
+        dims[0] = RESERVE_DIM1;
+        dims[1] = RESERVE_DIM2;
+        max_dims[0] = H5S_UNLIMITED;
+        max_dims[1] = H5S_UNLIMITED;
+        if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if((sizeof(int) * 6 * RESERVE_CHUNK_DIM1 * RESERVE_CHUNK_DIM2) != H5Dget_storage_size(dsid))
+            TEST_ERROR
+
+        /* Check the chunks were filled */
+        if(H5Dread(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rdata) < 0) FAIL_STACK_ERROR
+        for(i = 0; i < RESERVE_DIM1 * RESERVE_DIM2; i++)
+            if(((int *)rdata)[i] != RESERVE_FILL) TEST_ERROR
+
+        /* Write the data */
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wdata) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+        /* Extend the dataset (to 15 chunks) */
+        dims[0] = 2 * RESERVE_DIM1;
+        dims[1] = 2 * RESERVE_DIM2;
+        if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+        if(0 == (ssize = H5Dget_storage_size(dsid))) FAIL_STACK_ERROR
+        if((sizeof(int) * 15 * RESERVE_CHUNK_DIM1 * RESERVE_CHUNK_DIM2) != ssize) TEST_ERROR
+
+        /* Close the file and re-open it without reserving or alignment */
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+        /* Verify the data & the fill values in the new chunks */
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0) FAIL_STACK_ERROR
+        for(i = 0; i < 2 * RESERVE_DIM1; i++)
+            for(j = 0; j < 2 * RESERVE_DIM2; j++)
+                if(i < RESERVE_DIM1 && j < RESERVE_DIM2) {
+                    if(rdata[i][j] != wdata[i][j]) TEST_ERROR
+                } /* end if */
+                else if(rdata[i][j] != RESERVE_FILL) {
+                    TEST_ERROR
+                } /* end if */
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(my_fapl) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(sid);
+        H5Dclose(dsid);
+        H5Pclose(dcpl);
+        H5Pclose(fapl2);
+        H5Pclose(my_fapl);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_alloc_reserve() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
@@ -12813,6 +12999,7 @@ main(void)
             nerrors += (test_large_chunk_shrink(my_fapl) < 0        ? 1 : 0);
             nerrors += (test_zero_dim_dset(my_fapl) < 0             ? 1 : 0);
             nerrors += (test_storage_size(my_fapl) < 0              ? 1 : 0);
+            nerrors += (test_chunk_alloc_reserve(my_fapl) < 0       ? 1 : 0);
 
             nerrors += (test_swmr_non_latest(envval, my_fapl) < 0   ? 1 : 0);
             nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0     ? 1 : 0);
@@ -457,6 +457,8 @@ reset_hdf5(void)
 #if H5_SIZEOF_LONG_DOUBLE !=0
     SET_ALIGNMENT(LDOUBLE, H5_SIZEOF_LONG_DOUBLE);
 #endif
+    SET_ALIGNMENT(FLOAT16, 2);
+    SET_ALIGNMENT(BFLOAT16, 2);
 #endif
 
 }
@@ -5146,6 +5148,379 @@ run_fp_int_conv(const char *name)
     return nerrors;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    flt16_value
+ *
+ * Purpose:     Decodes the bits of a 16-bit float with EBITS exponent bits
+ *              and MBITS mantissa bits, to check the library against.
+ *
+ * Return:      The value, with *IS_NAN set for NaNs
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+flt16_value(unsigned bits, unsigned ebits, unsigned mbits, hbool_t *is_nan)
+{
+    unsigned    emax = (1u << ebits) - 1;
+    int         bias = (int)(emax >> 1);
+    unsigned    e = (bits >> mbits) & emax;
+    unsigned    m = bits & ((1u << mbits) - 1);
+    double      v;
+
+    *is_nan = FALSE;
+    if(e == emax) {
+        *is_nan = (m != 0);
+        v = DBL_MAX * 2.0;
+    } /* end if */
+    else if(e == 0)
+        v = HDldexp((double)m, 1 - bias - (int)mbits);
+    else
+        v = HDldexp((double)(m + (1u << mbits)), (int)e - bias - (int)mbits);
+
+    return (bits & 0x8000) ? -v : v;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    count_except
+ *
+ * Purpose:     Counts the overflow exceptions raised by a conversion,
+ *              leaving the library to produce the default value.
+ *
+ * Return:      H5T_CONV_UNHANDLED
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_ret_t
+count_except(H5T_conv_except_t except_type, hid_t H5_ATTR_UNUSED src_id, hid_t H5_ATTR_UNUSED dst_id,
+    void H5_ATTR_UNUSED *src_buf, void H5_ATTR_UNUSED *dst_buf, void *user_data)
+{
+    if(except_type == H5T_CONV_EXCEPT_RANGE_HI || except_type == H5T_CONV_EXCEPT_RANGE_LOW)
+        (*(int *)user_data)++;
+
+    return H5T_CONV_UNHANDLED;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_flt16
+ *
+ * Purpose:     Tests the hard conversions between the native 16-bit float
+ *              types (IEEE half-precision and bfloat16) and float/double.
+ *              Every 16-bit value is widened and checked against its
+ *              decoded value and narrowed back to itself; values halfway
+ *              between two 16-bit floats must round to the even one; and
+ *              values too large must overflow to infinity, raising an
+ *              exception.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_flt16(void)
+{
+    struct {
+        const char  *name;
+        hid_t       type;
+        hid_t       ieee_le, ieee_be;
+        unsigned    ebits, mbits;
+        double      big;                /* Rounds to infinity */
+    } types[2];
+    hid_t       dxpl_id = -1;
+    uint16_t    *h = NULL;
+    double      *buf = NULL;
+    float       *fbuf;
+    unsigned    t, u;
+    int         nexcept;
+
+    types[0].name = "float16";
+    types[0].type = H5T_NATIVE_FLOAT16;
+    types[0].ieee_le = H5T_IEEE_F16LE;
+    types[0].ieee_be = H5T_IEEE_F16BE;
+    types[0].ebits = 5;
+    types[0].mbits = 10;
+    types[0].big = 65520.0;
+    types[1].name = "bfloat16";
+    types[1].type = H5T_NATIVE_BFLOAT16;
+    types[1].ieee_le = H5T_FLOAT_BFLOAT16LE;
+    types[1].ieee_be = H5T_FLOAT_BFLOAT16BE;
+    types[1].ebits = 8;
+    types[1].mbits = 7;
+    types[1].big = 3.4e38;
+
+    if(NULL == (h = (uint16_t *)HDmalloc(65536 * sizeof(uint16_t)))) goto error;
+    if(NULL == (buf = (double *)HDmalloc(65536 * sizeof(double)))) goto error;
+    fbuf = (float *)buf;
+
+    for(t = 0; t < 2; t++) {
+        hid_t       dst[2];
+        unsigned    d;
+
+        if(t == 0) {
+            TESTING("hard float16 <-> float/double conversions");
+        } /* end if */
+        else {
+            TESTING("hard bfloat16 <-> float/double conversions");
+        } /* end else */
+
+        /* The native type is one of the two byte orders */
+        if(H5Tequal(types[t].type, H5T_ORDER_BE == H5Tget_order(H5T_NATIVE_INT) ?
+                types[t].ieee_be : types[t].ieee_le) != TRUE) {
+            H5_FAILED();
+            HDprintf("    native %s is not the 2-byte type in native order\n", types[t].name);
+            goto error;
+        } /* end if */
+
+        /* The conversions to and from float & double are hard ones */
+        dst[0] = H5T_NATIVE_FLOAT;
+        dst[1] = H5T_NATIVE_DOUBLE;
+        for(d = 0; d < 2; d++)
+            if(H5Tcompiler_conv(types[t].type, dst[d]) != TRUE ||
+                    H5Tcompiler_conv(dst[d], types[t].type) != TRUE) {
+                H5_FAILED();
+                HDprintf("    conversions between %s and %s aren't hard\n",
+                        types[t].name, d ? "double" : "float");
+                goto error;
+            } /* end if */
+
+        for(d = 0; d < 2; d++) {
+            /* Widen every 16-bit value */
+            for(u = 0; u < 65536; u++)
+                ((uint16_t *)buf)[u] = (uint16_t)u;
+            if(H5Tconvert(types[t].type, dst[d], (size_t)65536, buf, NULL, H5P_DEFAULT) < 0)
+                goto error;
+            for(u = 0; u < 65536; u++) {
+                hbool_t is_nan;
+                double  expect = flt16_value(u, types[t].ebits, types[t].mbits, &is_nan);
+                double  got = d ? buf[u] : (double)fbuf[u];
+
+                if(is_nan ? (got == got) : (got != expect)) {
+                    H5_FAILED();
+                    HDprintf("    %s 0x%04x widened to %g, expected %g\n",
+                            types[t].name, u, got, expect);
+                    goto error;
+                } /* end if */
+            } /* end for */
+
+            /* Narrow them back.  NaNs stay NaNs, everything else is exact. */
+            if(H5Tconvert(dst[d], types[t].type, (size_t)65536, buf, NULL, H5P_DEFAULT) < 0)
+                goto error;
+            for(u = 0; u < 65536; u++) {
+                hbool_t is_nan;
+                unsigned got = ((uint16_t *)buf)[u];
+
+                (void)flt16_value(u, types[t].ebits, types[t].mbits, &is_nan);
+                if(is_nan ? !(((got >> types[t].mbits) & ((1u << types[t].ebits) - 1)) == ((1u << types[t].ebits) - 1) &&
+                            (got & ((1u << types[t].mbits) - 1)) != 0) : got != u) {
+                    H5_FAILED();
+                    HDprintf("    %s 0x%04x narrowed from %s back to 0x%04x\n",
+                            types[t].name, u, d ? "double" : "float", got);
+                    goto error;
+                } /* end if */
+            } /* end for */
+
+            /* Halfway between two positive finite values rounds to the one
+             * with an even mantissa, and the next value above halfway rounds
+             * up.  The midpoints are exact in float. */
+            for(u = 0; u + 1 < ((1u << types[t].ebits) - 1) << types[t].mbits; u++) {
+                hbool_t is_nan;
+                double  mid = (flt16_value(u, types[t].ebits, types[t].mbits, &is_nan) +
+                        flt16_value(u + 1, types[t].ebits, types[t].mbits, &is_nan)) / 2.0;
+
+                if(d) {
+                    uint64_t bits;
+
+                    buf[0] = buf[1] = mid;
+                    HDmemcpy(&bits, &buf[1], sizeof(bits));
+                    bits++;
+                    HDmemcpy(&buf[1], &bits, sizeof(bits));
+                } /* end if */
+                else {
+                    uint32_t bits;
+
+                    fbuf[0] = fbuf[1] = (float)mid;
+                    HDmemcpy(&bits, &fbuf[1], sizeof(bits));
+                    bits++;
+                    HDmemcpy(&fbuf[1], &bits, sizeof(bits));
+                } /* end else */
+                if(H5Tconvert(dst[d], types[t].type, (size_t)2, buf, NULL, H5P_DEFAULT) < 0)
+                    goto error;
+                if(((uint16_t *)buf)[0] != ((u & 1) ? u + 1 : u) || ((uint16_t *)buf)[1] != u + 1) {
+                    H5_FAILED();
+                    HDprintf("    %s rounding from %s between 0x%04x and 0x%04x gave 0x%04x and 0x%04x\n",
+                            types[t].name, d ? "double" : "float", u, u + 1,
+                            ((uint16_t *)buf)[0], ((uint16_t *)buf)[1]);
+                    goto error;
+                } /* end if */
+            } /* end for */
+
+            /* Overflow to infinity raises an exception for each value */
+            if((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) goto error;
+            nexcept = 0;
+            if(H5Pset_type_conv_cb(dxpl_id, count_except, &nexcept) < 0) goto error;
+            if(d) {
+                buf[0] = types[t].big;
+                buf[1] = -types[t].big;
+                buf[2] = 1.0;
+            } /* end if */
+            else {
+                fbuf[0] = (float)types[t].big;
+                fbuf[1] = -(float)types[t].big;
+                fbuf[2] = 1.0F;
+            } /* end else */
+            if(H5Tconvert(dst[d], types[t].type, (size_t)3, buf, NULL, dxpl_id) < 0)
+                goto error;
+            if(H5Pclose(dxpl_id) < 0) goto error;
+            dxpl_id = -1;
+            h[0] = (uint16_t)(((1u << types[t].ebits) - 1) << types[t].mbits);
+            h[1] = (uint16_t)(h[0] | 0x8000);
+            h[2] = (uint16_t)(((1u << (types[t].ebits - 1)) - 1) << types[t].mbits);
+            if(nexcept != 2 || HDmemcmp(buf, h, 3 * sizeof(uint16_t))) {
+                H5_FAILED();
+                HDprintf("    %s overflow from %s: %d exceptions, values 0x%04x 0x%04x 0x%04x\n",
+                        types[t].name, d ? "double" : "float", nexcept,
+                        ((uint16_t *)buf)[0], ((uint16_t *)buf)[1], ((uint16_t *)buf)[2]);
+                goto error;
+            } /* end if */
+        } /* end for */
+
+        PASSED();
+    } /* end for */
+
+    HDfree(h);
+    HDfree(buf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl_id);
+    } H5E_END_TRY;
+    if(h)
+        HDfree(h);
+    if(buf)
+        HDfree(buf);
+
+    return 1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_odd_flt
+ *
+ * Purpose:     Tests the software conversions between the native types
+ *              and floating-point types that have no hardware
+ *              counterpart: a 24-bit float in both byte orders and the
+ *              VAX single-precision float.  Covers rounding, overflow,
+ *              values that are denormalized in the 24-bit type and
+ *              clipping when converting to integers.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_odd_flt(void)
+{
+    /* Doubles and their values after a trip through the 24-bit float,
+     * which has a 7-bit exponent and a 16-bit mantissa */
+    const double d_in[] = {0.0, -1.0, 3.25, 1024.015625, -65535.0,
+        1.0 + 1.0 / 131072.0, 1.0 + 1.0 / 262144.0, -3.75, 0.75 / 1099511627776.0,
+        1.0 / 1180591620717411303424.0, 1e30};
+    const double d_out[] = {0.0, -1.0, 3.25, 1024.015625, -65535.0,
+        1.0 + 1.0 / 65536.0, 1.0, -3.75, 0.75 / 1099511627776.0,
+        1.0 / 1180591620717411303424.0, HUGE_VAL};
+    /* Integers, their values after a trip through the 24-bit float and
+     * their values after converting the 24-bit float back to int */
+    const int i_in[] = {0, -7, 131073, 131075, -131075, 2147483647};
+    const double i_flt[] = {0.0, -7.0, 131072.0, 131076.0, -131076.0, 2147483648.0};
+    const int i_out[] = {0, -7, 131072, 131076, -131076, 2147483647};
+    const float f_in[] = {1.0F, -2.5F, 1e20F, 3e-30F, 123456.789F};
+    const unsigned char vax_one[4] = {0x80, 0x40, 0x00, 0x00};
+    const size_t nd = sizeof(d_in) / sizeof(d_in[0]);
+    const size_t ni = sizeof(i_in) / sizeof(i_in[0]);
+    const size_t nf = sizeof(f_in) / sizeof(f_in[0]);
+    hid_t       f24 = -1;
+    double      dbuf[16];
+    int         ibuf[16];
+    float       fbuf[16];
+    size_t      u;
+    int         order;
+
+    TESTING("soft conversions of 24-bit and VAX floats");
+
+    if((f24 = H5Tcopy(H5T_IEEE_F32LE)) < 0) goto error;
+    if(H5Tset_fields(f24, (size_t)23, (size_t)16, (size_t)7, (size_t)0, (size_t)16) < 0) goto error;
+    if(H5Tset_precision(f24, (size_t)24) < 0) goto error;
+    if(H5Tset_size(f24, (size_t)3) < 0) goto error;
+    if(H5Tset_ebias(f24, (size_t)63) < 0) goto error;
+
+    for(order = 0; order < 2; order++) {
+        if(H5Tset_order(f24, order ? H5T_ORDER_BE : H5T_ORDER_LE) < 0) goto error;
+
+        /* double -> 24-bit float -> double */
+        HDmemcpy(dbuf, d_in, sizeof(d_in));
+        if(H5Tconvert(H5T_NATIVE_DOUBLE, f24, nd, dbuf, NULL, H5P_DEFAULT) < 0) goto error;
+        if(H5Tconvert(f24, H5T_NATIVE_DOUBLE, nd, dbuf, NULL, H5P_DEFAULT) < 0) goto error;
+        for(u = 0; u < nd; u++)
+            if(dbuf[u] != d_out[u]) {
+                H5_FAILED();
+                HDprintf("    %s 24-bit float: %g became %g, expected %g\n",
+                        order ? "big-endian" : "little-endian", d_in[u], dbuf[u], d_out[u]);
+                goto error;
+            } /* end if */
+
+        /* int -> 24-bit float -> double, and 24-bit float -> int */
+        HDmemcpy(ibuf, i_in, sizeof(i_in));
+        if(H5Tconvert(H5T_NATIVE_INT, f24, ni, ibuf, NULL, H5P_DEFAULT) < 0) goto error;
+        HDmemcpy(dbuf, ibuf, ni * 3);
+        if(H5Tconvert(f24, H5T_NATIVE_INT, ni, ibuf, NULL, H5P_DEFAULT) < 0) goto error;
+        if(H5Tconvert(f24, H5T_NATIVE_DOUBLE, ni, dbuf, NULL, H5P_DEFAULT) < 0) goto error;
+        for(u = 0; u < ni; u++)
+            if(dbuf[u] != i_flt[u] || ibuf[u] != i_out[u]) {
+                H5_FAILED();
+                HDprintf("    %s 24-bit float: %d became %g and %d, expected %g and %d\n",
+                        order ? "big-endian" : "little-endian", i_in[u], dbuf[u], ibuf[u],
+                        i_flt[u], i_out[u]);
+                goto error;
+            } /* end if */
+    } /* end for */
+
+    /* float -> VAX float -> float */
+    HDmemcpy(fbuf, f_in, sizeof(f_in));
+    if(H5Tconvert(H5T_NATIVE_FLOAT, H5T_VAX_F32, nf, fbuf, NULL, H5P_DEFAULT) < 0) goto error;
+    if(HDmemcmp(fbuf, vax_one, sizeof(vax_one))) {
+        H5_FAILED();
+        HDprintf("    1.0 has the wrong VAX representation\n");
+        goto error;
+    } /* end if */
+    if(H5Tconvert(H5T_VAX_F32, H5T_NATIVE_FLOAT, nf, fbuf, NULL, H5P_DEFAULT) < 0) goto error;
+    for(u = 0; u < nf; u++)
+        if(fbuf[u] != f_in[u]) {
+            H5_FAILED();
+            HDprintf("    VAX float: %g became %g\n", (double)f_in[u], (double)fbuf[u]);
+            goto error;
+        } /* end if */
+
+    if(H5Tclose(f24) < 0) goto error;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(f24);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -5214,6 +5589,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test hardware conversions for the 16-bit float types */
+    nerrors += (unsigned long)test_conv_flt16();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
@@ -5238,6 +5616,10 @@ main(void)
     /* Test software integer-float conversion functions */
     nerrors += (unsigned long)run_int_fp_conv("soft");
 
+    /* Test software conversions of floating-point types without hardware
+     * counterparts */
+    nerrors += (unsigned long)test_conv_odd_flt();
+
     /* Restore the default error handler (set in h5_reset()) */
     h5_restore_err();
 
@@ -3392,6 +3392,141 @@ error:
     return 1;
 } /* end test_compound_18() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_19
+ *
+ * Purpose:     Tests conversions between compound datatypes with nested
+ *              compound members, where some members only need to be
+ *              moved and others converted, over more elements than are
+ *              converted at a time.  Destination members without a
+ *              source member must keep the background values.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_19(void)
+{
+    typedef struct {
+        char    c;
+        int     i;
+        float   f;
+    } src_inner_t;
+
+    typedef struct {
+        int     a;
+        src_inner_t in;
+        short   s;
+        int     b;
+        int     dropped;
+    } src_t;
+
+    typedef struct {
+        double  f;
+        long long i;
+        char    c;
+    } dst_inner_t;
+
+    typedef struct {
+        int     a;
+        int     b;
+        dst_inner_t in;
+        long    s;
+        int     extra;
+    } dst_t;
+
+    hid_t src_inner_tid = -1, src_tid = -1;
+    hid_t dst_inner_tid = -1, dst_tid = -1;
+    src_t *src_buf = NULL;
+    dst_t *buf = NULL, *bkg = NULL;
+    size_t nelmts = 20000;
+    size_t u;
+
+    TESTING("compound conversions with nested compounds");
+
+    /* Create the source types */
+    if((src_inner_tid = H5Tcreate(H5T_COMPOUND, sizeof(src_inner_t))) < 0) TEST_ERROR
+    if(H5Tinsert(src_inner_tid, "c", HOFFSET(src_inner_t, c), H5T_NATIVE_CHAR) < 0) TEST_ERROR
+    if(H5Tinsert(src_inner_tid, "i", HOFFSET(src_inner_t, i), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(src_inner_tid, "f", HOFFSET(src_inner_t, f), H5T_NATIVE_FLOAT) < 0) TEST_ERROR
+    if((src_tid = H5Tcreate(H5T_COMPOUND, sizeof(src_t))) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "a", HOFFSET(src_t, a), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "in", HOFFSET(src_t, in), src_inner_tid) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "s", HOFFSET(src_t, s), H5T_NATIVE_SHORT) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "b", HOFFSET(src_t, b), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(src_tid, "dropped", HOFFSET(src_t, dropped), H5T_NATIVE_INT) < 0) TEST_ERROR
+
+    /* Create the destination types, with the members in another order */
+    if((dst_inner_tid = H5Tcreate(H5T_COMPOUND, sizeof(dst_inner_t))) < 0) TEST_ERROR
+    if(H5Tinsert(dst_inner_tid, "f", HOFFSET(dst_inner_t, f), H5T_NATIVE_DOUBLE) < 0) TEST_ERROR
+    if(H5Tinsert(dst_inner_tid, "i", HOFFSET(dst_inner_t, i), H5T_NATIVE_LLONG) < 0) TEST_ERROR
+    if(H5Tinsert(dst_inner_tid, "c", HOFFSET(dst_inner_t, c), H5T_NATIVE_CHAR) < 0) TEST_ERROR
+    if((dst_tid = H5Tcreate(H5T_COMPOUND, sizeof(dst_t))) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "a", HOFFSET(dst_t, a), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "b", HOFFSET(dst_t, b), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "in", HOFFSET(dst_t, in), dst_inner_tid) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "s", HOFFSET(dst_t, s), H5T_NATIVE_LONG) < 0) TEST_ERROR
+    if(H5Tinsert(dst_tid, "extra", HOFFSET(dst_t, extra), H5T_NATIVE_INT) < 0) TEST_ERROR
+
+    /* Allocate and initialize the buffers */
+    if(NULL == (src_buf = (src_t *)HDcalloc(nelmts, sizeof(src_t)))) TEST_ERROR
+    if(NULL == (buf = (dst_t *)HDcalloc(nelmts, MAX(sizeof(src_t), sizeof(dst_t))))) TEST_ERROR
+    if(NULL == (bkg = (dst_t *)HDcalloc(nelmts, sizeof(dst_t)))) TEST_ERROR
+    for(u = 0; u < nelmts; u++) {
+        src_buf[u].a = (int)u;
+        src_buf[u].in.c = (char)(u % 128);
+        src_buf[u].in.i = -(int)u;
+        src_buf[u].in.f = (float)u / 4.0F;
+        src_buf[u].s = (short)(u % 1000);
+        src_buf[u].b = (int)(u * 3);
+        src_buf[u].dropped = -1;
+        bkg[u].extra = (int)(u * 7);
+    } /* end for */
+    HDmemcpy(buf, src_buf, nelmts * sizeof(src_t));
+
+    if(H5Tconvert(src_tid, dst_tid, nelmts, buf, bkg, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    for(u = 0; u < nelmts; u++)
+        if(buf[u].a != src_buf[u].a || buf[u].b != src_buf[u].b ||
+                buf[u].in.c != src_buf[u].in.c ||
+                buf[u].in.i != (long long)src_buf[u].in.i ||
+                !H5_DBL_ABS_EQUAL(buf[u].in.f, (double)src_buf[u].in.f) ||
+                buf[u].s != (long)src_buf[u].s || buf[u].extra != (int)(u * 7)) {
+            H5_FAILED(); AT();
+            printf("    element %u converted incorrectly\n", (unsigned)u);
+            goto error;
+        } /* end if */
+
+    if(H5Tclose(dst_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dst_inner_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(src_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(src_inner_tid) < 0) FAIL_STACK_ERROR
+    HDfree(bkg);
+    HDfree(buf);
+    HDfree(src_buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(dst_tid);
+        H5Tclose(dst_inner_tid);
+        H5Tclose(src_tid);
+        H5Tclose(src_inner_tid);
+    } H5E_END_TRY;
+    if(bkg)
+        HDfree(bkg);
+    if(buf)
+        HDfree(buf);
+    if(src_buf)
+        HDfree(src_buf);
+    return 1;
+} /* end test_compound_19() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_query
@@ -4233,6 +4368,31 @@ test_conv_str_1(void)
     if (H5Tclose(src_type) < 0) goto error;
     if (H5Tclose(dst_type) < 0) goto error;
 
+    /*
+     * Changing only the padding of same size strings: the characters stay
+     * where they are and whatever follows the terminator is replaced.
+     */
+    if((src_type = mkstr((size_t)10, H5T_STR_NULLTERM)) < 0) goto error;
+    if((dst_type = mkstr((size_t)10, H5T_STR_NULLPAD)) < 0) goto error;
+    if(NULL == (buf = (char*)HDcalloc((size_t)3, (size_t)10))) goto error;
+    HDmemcpy(buf, "abc\0xxxxxxabcdefghijabcdefghi\0", (size_t)30);
+    if (H5Tconvert(src_type, dst_type, (size_t)3, buf, NULL, H5P_DEFAULT) < 0) goto error;
+    if (HDmemcmp(buf, "abc\0\0\0\0\0\0\0abcdefghijabcdefghi\0", (size_t)30)) {
+	H5_FAILED();
+	HDputs("    Same size padding test 1");
+	goto error;
+    }
+    if (H5Tconvert(dst_type, src_type, (size_t)3, buf, NULL, H5P_DEFAULT) < 0) goto error;
+    if (HDmemcmp(buf, "abc\0\0\0\0\0\0\0abcdefghi\0abcdefghi\0", (size_t)30)) {
+	H5_FAILED();
+	HDputs("    Same size padding test 2");
+	goto error;
+    }
+    HDfree(buf);
+    buf = NULL;
+    if (H5Tclose(src_type) < 0) goto error;
+    if (H5Tclose(dst_type) < 0) goto error;
+
     /*
      * Test C string to Fortran and vice versa.
      */
@@ -4715,6 +4875,135 @@ test_conv_enum_2(void)
     return 0;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_enum_3
+ *
+ * Purpose:     Tests enumeration conversions between types with many
+ *              sparse members, between types with the same values in a
+ *              different member order and from a big-endian source, each
+ *              with some values that aren't members.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_enum_3(void)
+{
+    const int   nmembs = 2000;          /* Number of sparse members */
+    const int   nbe = 500;              /* Number of big-endian members */
+    hid_t       sparse = -1, dense = -1, reorder = -1, betype = -1;
+    int         *ibuf = NULL, *orig = NULL;
+    short       *sbuf = NULL;
+    unsigned char *bebuf = NULL;
+    char        name[32];
+    int         i, val;
+    short       sval;
+
+    TESTING("sparse and reordered enumeration type conversion");
+
+    /* Source type with sparse values, destination types with dense values
+     * and with the same value bits inserted in the opposite order (over an
+     * unsigned base type, so the conversion isn't a no-op) */
+    if((sparse = H5Tenum_create(H5T_NATIVE_INT)) < 0) TEST_ERROR
+    if((dense = H5Tenum_create(H5T_NATIVE_SHORT)) < 0) TEST_ERROR
+    if((reorder = H5Tenum_create(H5T_NATIVE_UINT)) < 0) TEST_ERROR
+    for(i = 0; i < nmembs; i++) {
+        HDsnprintf(name, sizeof(name), "m%d", i);
+        val = i * 7919 - 4000000;
+        if(H5Tenum_insert(sparse, name, &val) < 0) TEST_ERROR
+        sval = (short)i;
+        if(H5Tenum_insert(dense, name, &sval) < 0) TEST_ERROR
+    } /* end for */
+    for(i = nmembs - 1; i >= 0; i--) {
+        HDsnprintf(name, sizeof(name), "m%d", i);
+        val = i * 7919 - 4000000;
+        if(H5Tenum_insert(reorder, name, &val) < 0) TEST_ERROR
+    } /* end for */
+
+    /* Source data: members, with every tenth value not a member */
+    if(NULL == (ibuf = (int *)HDmalloc(NTESTELEM * sizeof(int)))) TEST_ERROR
+    if(NULL == (orig = (int *)HDmalloc(NTESTELEM * sizeof(int)))) TEST_ERROR
+    if(NULL == (sbuf = (short *)HDmalloc(NTESTELEM * sizeof(short)))) TEST_ERROR
+    for(i = 0; i < NTESTELEM; i++)
+        orig[i] = (i % 10) ? (HDrand() % nmembs) * 7919 - 4000000 : 1 + (HDrand() % nmembs) * 7919 - 4000000;
+
+    /* Sparse to dense */
+    HDmemcpy(ibuf, orig, NTESTELEM * sizeof(int));
+    if(H5Tconvert(sparse, dense, (size_t)NTESTELEM, ibuf, NULL, H5P_DEFAULT) < 0) TEST_ERROR
+    HDmemcpy(sbuf, ibuf, NTESTELEM * sizeof(short));
+    for(i = 0; i < NTESTELEM; i++)
+        if(sbuf[i] != ((i % 10) ? (short)((orig[i] + 4000000) / 7919) : (short)-1)) {
+            H5_FAILED();
+            printf("    sparse to dense element %d is %d\n", i, (int)sbuf[i]);
+            goto error;
+        } /* end if */
+
+    /* Same values in a different member order */
+    HDmemcpy(ibuf, orig, NTESTELEM * sizeof(int));
+    if(H5Tconvert(sparse, reorder, (size_t)NTESTELEM, ibuf, NULL, H5P_DEFAULT) < 0) TEST_ERROR
+    for(i = 0; i < NTESTELEM; i++)
+        if(ibuf[i] != ((i % 10) ? orig[i] : -1)) {
+            H5_FAILED();
+            printf("    reordered element %d is %d but should be %d\n", i, ibuf[i], orig[i]);
+            goto error;
+        } /* end if */
+
+    /* Big-endian two-byte source with sparse values */
+    if((betype = H5Tenum_create(H5T_STD_I16BE)) < 0) TEST_ERROR
+    for(i = 0; i < nbe; i++) {
+        unsigned char pattern[2];
+
+        HDsnprintf(name, sizeof(name), "m%d", i);
+        pattern[0] = (unsigned char)((i * 31) >> 8);
+        pattern[1] = (unsigned char)(i * 31);
+        if(H5Tenum_insert(betype, name, pattern) < 0) TEST_ERROR
+    } /* end for */
+    bebuf = (unsigned char *)ibuf;
+    for(i = 0; i < NTESTELEM; i++) {
+        val = (i % 10) ? (orig[i] + 4000000) / 7919 % nbe * 31 : 1;
+        bebuf[2 * i] = (unsigned char)(val >> 8);
+        bebuf[2 * i + 1] = (unsigned char)val;
+    } /* end for */
+    if(H5Tconvert(betype, dense, (size_t)NTESTELEM, ibuf, NULL, H5P_DEFAULT) < 0) TEST_ERROR
+    HDmemcpy(sbuf, ibuf, NTESTELEM * sizeof(short));
+    for(i = 0; i < NTESTELEM; i++)
+        if(sbuf[i] != ((i % 10) ? (short)((orig[i] + 4000000) / 7919 % nbe) : (short)-1)) {
+            H5_FAILED();
+            printf("    big-endian element %d is %d\n", i, (int)sbuf[i]);
+            goto error;
+        } /* end if */
+
+    if(H5Tclose(sparse) < 0) TEST_ERROR
+    if(H5Tclose(dense) < 0) TEST_ERROR
+    if(H5Tclose(reorder) < 0) TEST_ERROR
+    if(H5Tclose(betype) < 0) TEST_ERROR
+    HDfree(ibuf);
+    HDfree(orig);
+    HDfree(sbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(sparse);
+        H5Tclose(dense);
+        H5Tclose(reorder);
+        H5Tclose(betype);
+    } H5E_END_TRY;
+    if(ibuf)
+        HDfree(ibuf);
+    if(orig)
+        HDfree(orig);
+    if(sbuf)
+        HDfree(sbuf);
+    return 1;
+} /* end test_conv_enum_3() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_conv_bitfield
@@ -7466,8 +7755,10 @@ main(void)
     nerrors += test_compound_16();
     nerrors += test_compound_17();
     nerrors += test_compound_18();
+    nerrors += test_compound_19();
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
+    nerrors += test_conv_enum_3();
     nerrors += test_conv_bitfield();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
@@ -26,6 +26,7 @@ const char *FILENAME[] = {
     "extern_4",
     "extern_dir/file_1",
     "extern_5",
+    "extern_6",
     NULL
 };
 
@@ -955,6 +956,115 @@ test_write_file_set(hid_t fapl)
     return 1;
 } /* end test_write_file_set() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_shared_file_set
+ *
+ * Purpose:     Tests an external file list whose entries are all parts of
+ *              one file, stored in reverse order.  The file is read while
+ *              open for reading only, then written, then read again.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_shared_file_set(hid_t fapl)
+{
+    hid_t	file = -1;          /* file to which to write               */
+    hid_t	dcpl = -1;          /* dataset creation properties          */
+    hid_t	space = -1;         /* data space                           */
+    hid_t	dset = -1;          /* dataset                              */
+    int         fd = -1;            /* external file descriptor             */
+    unsigned i, j;              /* miscellaneous counters               */
+    int	    part[PART_SIZE];    /* raw data buffer (partial)            */
+    int     whole[TOTAL_SIZE];  /* raw data buffer (total)              */
+    int     check[TOTAL_SIZE];  /* raw data buffer to check             */
+    hsize_t	cur_size = TOTAL_SIZE;  /* current data space size          */
+    char	filename[1024];     /* file name                            */
+
+    TESTING("external file list sharing one file");
+
+    if(HDsetenv("HDF5_EXTFILE_PREFIX", "", 1) < 0)
+        TEST_ERROR
+
+    h5_fixname(FILENAME[6], fapl, filename, sizeof(filename));
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Each entry of the list is a part of the same file, last part first */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < N_EXT_FILES; i++)
+        if(H5Pset_external(dcpl, "extern_s.raw", (off_t)((N_EXT_FILES - 1 - i) * sizeof(part)), (hsize_t)sizeof(part)) < 0)
+            FAIL_STACK_ERROR
+    HDremove("extern_s.raw");
+
+    /* Create and write the dataset */
+    if((space = H5Screate_simple(1, &cur_size, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if((dset = H5Dcreate2(file, "dset1", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < TOTAL_SIZE; i++)
+        whole[i] = (int)i;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, whole) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dclose(dset) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check the layout of the external file */
+    if((fd = HDopen("extern_s.raw", O_RDONLY, 0)) < 0)
+        TEST_ERROR
+    for(i = 0; i < N_EXT_FILES; i++) {
+        if(HDread(fd, part, sizeof(part)) != (ssize_t)sizeof(part))
+            TEST_ERROR
+        for(j = 0; j < PART_SIZE; j++)
+            if(part[j] != (int)((N_EXT_FILES - 1 - i) * PART_SIZE + j))
+                FAIL_PUTS_ERROR("   External file contents differ from expected value.")
+    } /* end for */
+    HDclose(fd);
+    fd = -1;
+
+    /* Reopen the dataset and read it before writing it again */
+    if((dset = H5Dopen2(file, "dset1", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(check, 0, sizeof(check));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < TOTAL_SIZE; i++)
+        if(check[i] != whole[i])
+            FAIL_PUTS_ERROR("   Read differs from expected value.")
+    for(i = 0; i < TOTAL_SIZE; i++)
+        whole[i] = TOTAL_SIZE - (int)i;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, whole) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < TOTAL_SIZE; i++)
+        if(check[i] != whole[i])
+            FAIL_PUTS_ERROR("   Read differs from expected value.")
+
+    if(H5Dclose(dset) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(space) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Pclose(dcpl);
+        H5Sclose(space);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(fd >= 0)
+        HDclose(fd);
+    return 1;
+} /* end test_shared_file_set() */
+
  
  /*-------------------------------------------------------------------------
  * Function:    test_path_absolute
@@ -1582,6 +1692,7 @@ main(void)
         /* These file set tests use the VFD-aware fapl */
         nerrors += test_read_file_set(current_fapl_id);
         nerrors += test_write_file_set(current_fapl_id);
+        nerrors += test_shared_file_set(current_fapl_id);
         nerrors += test_path_absolute(current_fapl_id);
         nerrors += test_path_relative(current_fapl_id);
         nerrors += test_path_relative_cwd(current_fapl_id);
@@ -1614,6 +1725,8 @@ main(void)
         HDremove("extern_3w.raw");
         HDremove("extern_4w.raw");
 
+        HDremove("extern_s.raw");
+
         HDrmdir("extern_dir");
     } /* end if */
 
@@ -36,6 +36,15 @@
 /* Number of heap objects to test */
 #define GHEAP_TEST_NOBJS        1024
 
+/* Objects inserted in a batch by test_batch(): one of them more than 1MB,
+ * the others filling several collections, and a short run */
+#define GHEAP_BATCH_NOBJS       256
+#define GHEAP_BATCH_OBJ_SIZE    1000
+#define GHEAP_BATCH_BIG_OBJ     (GHEAP_BATCH_NOBJS / 2)
+#define GHEAP_BATCH_BIG_SIZE    ((1024 * 1024) + 24)
+#define GHEAP_BATCH_NSMALL      3
+#define GHEAP_BATCH_SMALL_SIZE  16
+
 #define GHEAP_REPEATED_ERR(MSG)                                                \
 {                                                                              \
     nerrors++;                                                                 \
@@ -53,6 +62,7 @@ const char *FILENAME[] = {
     "gheap3",
     "gheap4",
     "gheapooo",
+    "gheap5",
     NULL
 };
 
@@ -559,6 +569,160 @@ test_ooo_indices(hid_t fapl)
     return MAX(1, nerrors);
 } /* end test_ooo_indices */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_batch
+ *
+ * Purpose:	Inserts objects with H5HG_insert_batch() and reads them
+ *		back after the file is reopened.  A short run of objects
+ *		must go into the free space of an existing collection; a
+ *		longer batch is laid out in order in new collections, a new
+ *		one being started each time one is full, with an object of
+ *		more than 1MB in a collection of its own.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_batch(hid_t fapl)
+{
+    hid_t	file = -1;
+    H5F_t 	*f = NULL;
+    H5HG_t	first;
+    H5HG_insert_req_t reqs[GHEAP_BATCH_NOBJS];
+    H5HG_insert_req_t sreqs[GHEAP_BATCH_NSMALL];
+    uint8_t	*obj[GHEAP_BATCH_NOBJS];
+    uint8_t	small[GHEAP_BATCH_NSMALL][GHEAP_BATCH_SMALL_SIZE];
+    uint8_t	*in = NULL;
+    size_t	ncolls, nobjs;
+    size_t	size;
+    size_t	u, v;
+    int		nerrors = 0;
+    char	filename[1024];
+
+    TESTING("batch insertion");
+
+    HDmemset(obj, 0, sizeof(obj));
+    for(u = 0; u < GHEAP_BATCH_NOBJS; u++) {
+        reqs[u].size = (u == GHEAP_BATCH_BIG_OBJ) ? GHEAP_BATCH_BIG_SIZE : GHEAP_BATCH_OBJ_SIZE;
+        if(NULL == (obj[u] = (uint8_t *)HDmalloc(reqs[u].size)))
+            goto error;
+        for(v = 0; v < reqs[u].size; v++)
+            obj[u][v] = (uint8_t)(u + v);
+        reqs[u].obj = obj[u];
+    } /* end for */
+    for(u = 0; u < GHEAP_BATCH_NSMALL; u++) {
+        HDmemset(small[u], (int)('a' + u), (size_t)GHEAP_BATCH_SMALL_SIZE);
+        sreqs[u].obj = small[u];
+        sreqs[u].size = GHEAP_BATCH_SMALL_SIZE;
+    } /* end for */
+    if(NULL == (in = (uint8_t *)HDmalloc(GHEAP_BATCH_BIG_SIZE)))
+        goto error;
+
+    /* Open a clean file */
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+	goto error;
+    if(NULL == (f = (H5F_t *)H5I_object(file))) {
+	H5_FAILED();
+	puts("    Unable to create file");
+	goto error;
+    }
+
+    /* A short run goes into the free space of the collection created here */
+    if(H5HG_insert(f, H5AC_ind_read_dxpl_id, (size_t)GHEAP_BATCH_SMALL_SIZE, small[0], &first) < 0) {
+        H5_FAILED();
+        puts("    Unable to insert object into global heap");
+        goto error;
+    }
+    if(H5HG_insert_batch(f, H5AC_ind_read_dxpl_id, (size_t)GHEAP_BATCH_NSMALL, sreqs) < 0) {
+        H5_FAILED();
+        puts("    Unable to insert short run into global heap");
+        goto error;
+    }
+    for(u = 0; u < GHEAP_BATCH_NSMALL; u++)
+        if(!H5F_addr_eq(sreqs[u].hobj.addr, first.addr))
+            GHEAP_REPEATED_ERR("    Short run not put in the existing collection")
+
+    /* The other objects are laid out in order in new collections */
+    if(H5HG_insert_batch(f, H5AC_ind_read_dxpl_id, (size_t)GHEAP_BATCH_NOBJS, reqs) < 0) {
+        H5_FAILED();
+        puts("    Unable to insert batch into global heap");
+        goto error;
+    }
+    ncolls = nobjs = 0;
+    for(u = 0; u < GHEAP_BATCH_NOBJS; u++) {
+        if(H5F_addr_eq(reqs[u].hobj.addr, first.addr))
+            GHEAP_REPEATED_ERR("    Batch object put in an existing collection")
+        if(u == 0 || !H5F_addr_eq(reqs[u].hobj.addr, reqs[u - 1].hobj.addr)) {
+            ncolls++;
+            nobjs = 0;
+        } /* end if */
+        nobjs++;
+        if(reqs[u].hobj.idx != nobjs)
+            GHEAP_REPEATED_ERR("    Unexpected global heap index")
+        if(u != GHEAP_BATCH_BIG_OBJ && nobjs * GHEAP_BATCH_OBJ_SIZE > H5HG_MAXSIZE)
+            GHEAP_REPEATED_ERR("    Collection filled past its maximum size")
+    } /* end for */
+    if(ncolls <= (GHEAP_BATCH_NOBJS * GHEAP_BATCH_OBJ_SIZE) / H5HG_MAXSIZE) {
+        H5_FAILED();
+        puts("    Batch didn't start a new collection when one was full");
+        nerrors++;
+    }
+    if(H5F_addr_eq(reqs[GHEAP_BATCH_BIG_OBJ].hobj.addr, reqs[GHEAP_BATCH_BIG_OBJ - 1].hobj.addr)
+            || H5F_addr_eq(reqs[GHEAP_BATCH_BIG_OBJ].hobj.addr, reqs[GHEAP_BATCH_BIG_OBJ + 1].hobj.addr)) {
+        H5_FAILED();
+        puts("    Large object shares a collection");
+        nerrors++;
+    }
+
+    /* Reopen the file */
+    if(H5Fclose(file) < 0) goto error;
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        goto error;
+    if(NULL == (f = (H5F_t *)H5I_object(file))) {
+        H5_FAILED();
+        puts("    Unable to open file");
+        goto error;
+    }
+
+    /* Read the objects back */
+    for(u = 0; u < GHEAP_BATCH_NSMALL; u++) {
+        if(NULL == H5HG_read(f, H5AC_ind_read_dxpl_id, &sreqs[u].hobj, in, &size))
+            GHEAP_REPEATED_ERR("    Unable to read object")
+        else if(size != GHEAP_BATCH_SMALL_SIZE || HDmemcmp(in, small[u], size))
+            GHEAP_REPEATED_ERR("    Value read doesn't match value written")
+    } /* end for */
+    for(u = 0; u < GHEAP_BATCH_NOBJS; u++) {
+        if(NULL == H5HG_read(f, H5AC_ind_read_dxpl_id, &reqs[u].hobj, in, &size))
+            GHEAP_REPEATED_ERR("    Unable to read object")
+        else if(size != reqs[u].size || HDmemcmp(in, obj[u], size))
+            GHEAP_REPEATED_ERR("    Value read doesn't match value written")
+    } /* end for */
+
+    if(H5Fclose(file) < 0) goto error;
+    if(nerrors) goto error;
+    for(u = 0; u < GHEAP_BATCH_NOBJS; u++)
+        HDfree(obj[u]);
+    HDfree(in);
+    PASSED();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+	H5Fclose(file);
+    } H5E_END_TRY;
+    for(u = 0; u < GHEAP_BATCH_NOBJS; u++)
+        if(obj[u])
+            HDfree(obj[u]);
+    if(in)
+        HDfree(in);
+    return MAX(1, nerrors);
+} /* end test_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	main
@@ -590,6 +754,7 @@ main (void)
     nerrors += test_3(fapl);
     nerrors += test_4(fapl);
     nerrors += test_ooo_indices(fapl);
+    nerrors += test_batch(fapl);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl) < 0 ? 1 : 0);
@@ -158,7 +158,7 @@ h5_clean_files(const char *base_name[], hid_t fapl)
 
         driver = H5Pget_driver(fapl);
 
-        if(driver == H5FD_FAMILY) {
+        if(driver == H5FD_FAMILY || driver == H5FD_STRIPE) {
             int j;
 
             for(j = 0; /*void*/; j++) {
@@ -228,7 +228,7 @@ h5_delete_test_file(const char *base_name, hid_t fapl)
 
     driver = H5Pget_driver(fapl);
 
-    if(driver == H5FD_FAMILY) {
+    if(driver == H5FD_FAMILY || driver == H5FD_STRIPE) {
         int j;
         for(j = 0; /*void*/; j++) {
             HDsnprintf(sub_filename, sizeof(sub_filename), filename, j);
@@ -590,7 +590,7 @@ h5_fixname_real(const char *base_name, hid_t fapl, const char *_suffix,
             return NULL;
 
         if(suffix) {
-            if(H5FD_FAMILY == driver)
+            if(H5FD_FAMILY == driver || H5FD_STRIPE == driver)
                 suffix = nest_printf ? "%%05d.h5" : "%05d.h5";
             else if (H5FD_MULTI == driver)
                 suffix = NULL;
@@ -850,6 +850,15 @@ h5_fileaccess(void)
         if(H5Pset_core_write_tracking(fapl, TRUE, (size_t)4096) < 0)
             return -1;
     }
+    else if(!HDstrcmp(name, "core_lazy")) {
+        /* In-memory driver with pages of existing files loaded on demand */
+        if(H5Pset_fapl_core(fapl, (size_t)1, TRUE) < 0)
+            return -1;
+        if(H5Pset_core_write_tracking(fapl, TRUE, (size_t)4096) < 0)
+            return -1;
+        if(H5Pset_core_lazy_load(fapl, TRUE) < 0)
+            return -1;
+    }
     else if(!HDstrcmp(name, "split")) {
         /* Split meta data and raw data each using default driver */
         if(H5Pset_fapl_split(fapl,
@@ -896,6 +905,19 @@ h5_fileaccess(void)
         if(H5Pset_fapl_family(fapl, fam_size, H5P_DEFAULT)<0)
             return -1;
     }
+    else if(!HDstrcmp(name, "stripe")) {
+        hsize_t stripe_size = 64*1024; /*64 KB*/
+        unsigned nmembs = 4;
+
+        /* Striped set of files using the default driver */
+        if((val = HDstrtok(NULL, " \t\n\r"))) {
+            stripe_size = (hsize_t)(HDstrtod(val, NULL) * 1024);
+            if((val = HDstrtok(NULL, " \t\n\r")))
+                nmembs = (unsigned)HDstrtoul(val, NULL, 0);
+        }
+        if(H5Pset_fapl_stripe(fapl, stripe_size, nmembs, H5P_DEFAULT) < 0)
+            return -1;
+    }
     else if(!HDstrcmp(name, "log")) {
         unsigned log_flags = H5FD_LOG_LOC_IO | H5FD_LOG_ALLOC;
 
@@ -990,6 +1012,14 @@ h5_get_vfd_fapl(void)
             return -1;
         if(H5Pset_core_write_tracking(fapl, TRUE, (size_t)4096) < 0)
             return -1;
+    } else if(!HDstrcmp(tok, "core_lazy")) {
+        /* In-memory driver with pages of existing files loaded on demand */
+        if(H5Pset_fapl_core(fapl, (size_t)1, TRUE) < 0)
+            return -1;
+        if(H5Pset_core_write_tracking(fapl, TRUE, (size_t)4096) < 0)
+            return -1;
+        if(H5Pset_core_lazy_load(fapl, TRUE) < 0)
+            return -1;
      } else if(!HDstrcmp(tok, "split")) {
         /* Split meta data and raw data each using default driver */
         if(H5Pset_fapl_split(fapl,
@@ -1034,6 +1064,19 @@ h5_get_vfd_fapl(void)
             fam_size = (hsize_t)(HDstrtod(tok, NULL) * 1024*1024);
         if(H5Pset_fapl_family(fapl, fam_size, H5P_DEFAULT) < 0)
             return -1;
+    } else if(!HDstrcmp(tok, "stripe")) {
+        /* Striped set of files using the default driver */
+        hsize_t stripe_size = 64*1024; /*64 KB*/
+        unsigned nmembs = 4;
+
+        /* Were the stripe size (in KB) and number of members specified? */
+        if((tok = HDstrtok(NULL, " \t\n\r"))) {
+            stripe_size = (hsize_t)(HDstrtod(tok, NULL) * 1024);
+            if((tok = HDstrtok(NULL, " \t\n\r")))
+                nmembs = (unsigned)HDstrtoul(tok, NULL, 0);
+        }
+        if(H5Pset_fapl_stripe(fapl, stripe_size, nmembs, H5P_DEFAULT) < 0)
+            return -1;
     } else if(!HDstrcmp(tok, "log")) {
         /* Log file access */
         unsigned log_flags = H5FD_LOG_LOC_IO | H5FD_LOG_ALLOC;
@@ -1378,7 +1421,7 @@ h5_get_file_size(const char *filename, hid_t fapl)
             return file_size;
         }
 #endif /* H5_HAVE_PARALLEL */
-        else if(driver == H5FD_FAMILY) {
+        else if(driver == H5FD_FAMILY || driver == H5FD_STRIPE) {
             h5_stat_size_t tot_size = 0;
 
             /* Try all filenames possible, until we find one that's missing */
@@ -40,6 +40,12 @@
 #define NX                      100
 #define NY                      50
 
+/* Parameters for the shared-memory page tier test */
+#define SHM_PAGE_SIZE           4096
+#define SHM_NELMTS              (8 * SHM_PAGE_SIZE / sizeof(int))
+#define SHM_SLAB_NELMTS         256
+#define SHM_SIZE                (64 * SHM_PAGE_SIZE)
+
 /* helper routines */
 static unsigned create_file(char *filename, hid_t fcpl, hid_t fapl);
 static unsigned open_file(char *filename, hid_t fapl, hsize_t page_size, size_t page_buffer_size);
@@ -48,8 +54,10 @@ static unsigned open_file(char *filename, hid_t fapl, hsize_t page_size, size_t
 static unsigned test_args(hid_t fapl, const char *env_h5_drvr);
 static unsigned test_raw_data_handling(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_lru_processing(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_2q_processing(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_min_threshold(hid_t orig_fapl, const char *env_h5_drvr);
 static unsigned test_stats_collection(hid_t orig_fapl, const char *env_h5_drvr);
+static unsigned test_shared_memory(hid_t orig_fapl, const char *env_h5_drvr);
 #ifdef H5_HAVE_PARALLEL
 static unsigned verify_page_buffering_disabled(hid_t orig_fapl, 
     const char *env_h5_drvr);
@@ -1068,6 +1076,196 @@ error:
     return 1;
 } /* test_lru_processing */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_2q_processing()
+ *
+ * Purpose:     Tests the 2Q page replacement policy: a page that is used
+ *              again after falling out of the FIFO must survive a scan
+ *              of pages that are only used once.  Also checks the
+ *              policy property and the extended statistics (hit ratios,
+ *              pages written back and write time).
+ *
+ *              Any data mis-matches or failures reported by the HDF5
+ *              library result in test failure.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_2q_processing(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    hid_t file_id = -1;          /* File ID */
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    hid_t fapl2 = -1;
+    H5F_page_buffer_policy_t policy;
+    int i;
+    int num_elements = 8000;    /* 40 pages of 200 ints */
+    haddr_t addr = HADDR_UNDEF;
+    haddr_t search_addr = HADDR_UNDEF;
+    double hit_ratios[2];
+    unsigned writes[2];
+    double write_time = -1.0;
+    herr_t ret;
+    int *data = NULL;
+    H5F_t *f = NULL;
+
+    TESTING("2Q Processing");
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    if(set_multi_split(env_h5_drvr, fapl, sizeof(int)*200)  != 0)
+        TEST_ERROR;
+
+    if((data = (int *)HDcalloc((size_t)num_elements, sizeof(int))) == NULL)
+        TEST_ERROR;
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Pset_file_space_page_size(fcpl, sizeof(int)*200) < 0)
+        FAIL_STACK_ERROR;
+
+    /* keep 8 pages at max in the page buffer */
+    if(H5Pset_page_buffer_size(fapl, sizeof(int)*1600, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+
+    /* check the policy property */
+    if(H5Pget_page_buffer_policy(fapl, &policy) < 0)
+        FAIL_STACK_ERROR;
+    if(policy != H5F_PAGE_BUFFER_POLICY_LRU)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_policy(fapl, H5F_PAGE_BUFFER_POLICY_NTYPES);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+    if(H5Pset_page_buffer_policy(fapl, H5F_PAGE_BUFFER_POLICY_2Q) < 0)
+        FAIL_STACK_ERROR;
+
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* the policy is reported by the file's access property list */
+    if((fapl2 = H5Fget_access_plist(file_id)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_policy(fapl2, &policy) < 0)
+        FAIL_STACK_ERROR;
+    if(policy != H5F_PAGE_BUFFER_POLICY_2Q)
+        TEST_ERROR;
+    if(H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Get a pointer to the internal file object */
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+
+    /* allocate space for 40 pages, and initialize them to -1 without
+     * going through the page buffer
+     */
+    if(HADDR_UNDEF == (addr = H5MF_alloc(f, H5FD_MEM_DRAW, H5AC_ind_read_dxpl_id, sizeof(int)*(size_t)num_elements)))
+        FAIL_STACK_ERROR;
+    for(i=0 ; i<num_elements ; i++)
+        data[i] = -1;
+    if(H5F_block_write(f, H5FD_MEM_DRAW, addr, sizeof(int)*(size_t)num_elements, H5AC_rawdata_dxpl_id, data) < 0)
+        FAIL_STACK_ERROR;
+
+    /* read page 0, then pages 1 - 9, which pushes page 0 out of the FIFO */
+    for(i=0 ; i<10 ; i++)
+        if(H5F_block_read(f, H5FD_MEM_DRAW, addr+(sizeof(int)*200*(size_t)i), sizeof(int), H5AC_rawdata_dxpl_id, data) < 0)
+            FAIL_STACK_ERROR;
+    search_addr = addr;
+    if(NULL != H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+        TEST_ERROR;
+
+    /* read page 0 again, it should now go in the LRU */
+    if(H5F_block_read(f, H5FD_MEM_DRAW, addr, sizeof(int), H5AC_rawdata_dxpl_id, data) < 0)
+        FAIL_STACK_ERROR;
+    if(f->shared->page_buf->LRU_list_len != 1)
+        TEST_ERROR;
+
+    /* scan pages 10 - 39 once: page 0 should stay in the page buffer */
+    for(i=10 ; i<40 ; i++)
+        if(H5F_block_read(f, H5FD_MEM_DRAW, addr+(sizeof(int)*200*(size_t)i), sizeof(int), H5AC_rawdata_dxpl_id, data) < 0)
+            FAIL_STACK_ERROR;
+    if(NULL == H5SL_search(f->shared->page_buf->slist_ptr, &(search_addr)))
+        TEST_ERROR;
+    if(H5SL_count(f->shared->page_buf->slist_ptr) != 8)
+        TEST_ERROR;
+
+    /* read page 0 once more, it should be a hit */
+    if(H5F_block_read(f, H5FD_MEM_DRAW, addr, sizeof(int), H5AC_rawdata_dxpl_id, data) < 0)
+        FAIL_STACK_ERROR;
+    if(data[0] != -1)
+        TEST_ERROR;
+
+    /* dirty pages 30 - 35 and flush them */
+    for(i=30 ; i<36 ; i++) {
+        data[0] = i;
+        if(H5F_block_write(f, H5FD_MEM_DRAW, addr+(sizeof(int)*200*(size_t)i), sizeof(int), H5AC_rawdata_dxpl_id, data) < 0)
+            FAIL_STACK_ERROR;
+    } /* end for */
+    if(H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0)
+        FAIL_STACK_ERROR;
+
+    if(H5Fget_page_buffering_ext_stats(file_id, hit_ratios, writes, &write_time) < 0)
+        FAIL_STACK_ERROR;
+    if(hit_ratios[1] <= 0.0 || hit_ratios[1] > 1.0)
+        TEST_ERROR;
+    if(writes[1] < 6)
+        TEST_ERROR;
+    if(write_time < 0.0)
+        TEST_ERROR;
+
+    /* the written values should have reached the file */
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+    for(i=30 ; i<36 ; i++) {
+        if(H5F_block_read(f, H5FD_MEM_DRAW, addr+(sizeof(int)*200*(size_t)i), sizeof(int), H5AC_rawdata_dxpl_id, data) < 0)
+            FAIL_STACK_ERROR;
+        if(data[0] != i) {
+            HDfprintf(stderr, "Read different values than written\n");
+            TEST_ERROR;
+        } /* end if */
+    } /* end for */
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(data);
+
+    PASSED()
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Fclose(file_id);
+        if(data)
+            HDfree(data);
+    } H5E_END_TRY;
+    return 1;
+} /* test_2q_processing */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_min_threshold()
@@ -2007,6 +2205,369 @@ error:
     return 1;
 } /* test_stats_collection */
 
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5_HAVE_SHM_OPEN) && defined(H5_HAVE_MMAP)
+
+/*-------------------------------------------------------------------------
+ * Function:    shared_read_dset()
+ *
+ * Purpose:     Helper for test_shared_memory().  Opens the test file
+ *              read-only, verifies that it is attached to the
+ *              shared-memory page tier, and reads the dataset back in
+ *              pieces smaller than a page, so that the reads go through
+ *              the page buffer.
+ *
+ * Return:      Success:        ID of the open file
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+shared_read_dset(const char *filename, hid_t fapl)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t fspace = -1;
+    hid_t mspace = -1;
+    hsize_t start, count = SHM_SLAB_NELMTS;
+    int rbuf[SHM_SLAB_NELMTS];
+    H5F_t *f = NULL;
+    unsigned u, v;
+
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+    if(NULL == f->shared->page_buf || NULL == f->shared->page_buf->shm)
+        TEST_ERROR;
+
+    if((dset_id = H5Dopen2(file_id, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if((fspace = H5Dget_space(dset_id)) < 0)
+        FAIL_STACK_ERROR;
+    if((mspace = H5Screate_simple(1, &count, NULL)) < 0)
+        FAIL_STACK_ERROR;
+
+    for(u = 0; u < SHM_NELMTS; u += SHM_SLAB_NELMTS) {
+        start = u;
+        if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+            FAIL_STACK_ERROR;
+        if(H5Dread(dset_id, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR;
+        for(v = 0; v < SHM_SLAB_NELMTS; v++)
+            if(rbuf[v] != (int)(u + v))
+                TEST_ERROR;
+    } /* end for */
+
+    if(H5Sclose(mspace) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Sclose(fspace) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR;
+
+    return file_id;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+
+    return -1;
+} /* shared_read_dset */
+#endif /* H5_HAVE_FORK && H5_HAVE_WAITPID && H5_HAVE_SHM_OPEN && H5_HAVE_MMAP */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_shared_memory()
+ *
+ * Purpose:     Test the shared-memory tier of the page buffer.
+ *
+ *              Checks the H5Pset/get_page_buffer_shared_size() property,
+ *              that a file opened for writing doesn't use the shared
+ *              tier, and that a page read by one process is found in the
+ *              shared tier by another process reading the same file:
+ *              the parent reads the dataset first, then a forked child
+ *              reads it without any page buffer misses for raw data.
+ *
+ * Return:      0 if test is sucessful
+ *              1 if test fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_shared_memory(hid_t orig_fapl, const char *env_h5_drvr)
+{
+    char filename[FILENAME_LEN]; /* Filename to use */
+    hid_t file_id = -1;          /* File ID */
+    hid_t dset_id = -1;
+    hid_t space_id = -1;
+    hid_t fcpl = -1;
+    hid_t fapl = -1;
+    hid_t fapl2 = -1;
+    hsize_t dims = SHM_NELMTS;
+    size_t shared_size;
+    int *data = NULL;
+    H5F_t *f = NULL;
+#if defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5_HAVE_SHM_OPEN) && defined(H5_HAVE_MMAP)
+    int pipe_fd[2] = {-1, -1};
+    pid_t pid = -1;
+    int status;
+    char go = 'g';
+#endif
+    unsigned u;
+
+    TESTING("Shared-memory page tier");
+
+#if !(defined(H5_HAVE_FORK) && defined(H5_HAVE_WAITPID) && defined(H5_HAVE_SHM_OPEN) && defined(H5_HAVE_MMAP))
+    SKIPPED();
+    HDputs("    Test skipped due to fork, waitpid or POSIX shared memory not available.");
+    return 0;
+#else
+    /* The shared tier is keyed by the identity of a single file */
+    if(!HDstrcmp(env_h5_drvr, "family")) {
+        SKIPPED();
+        HDputs("    Test skipped for the family driver.");
+        return 0;
+    } /* end if */
+
+    h5_fixname(FILENAME[0], orig_fapl, filename, sizeof(filename));
+
+    if((fapl = H5Pcopy(orig_fapl)) < 0)
+        TEST_ERROR
+
+    /* Check the default and set/get */
+    if(H5Pget_page_buffer_shared_size(fapl, &shared_size) < 0)
+        FAIL_STACK_ERROR;
+    if(shared_size != 0)
+        TEST_ERROR;
+    if(H5Pset_page_buffer_size(fapl, 16 * SHM_PAGE_SIZE, 0, 0) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pset_page_buffer_shared_size(fapl, SHM_SIZE) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_shared_size(fapl, &shared_size) < 0)
+        FAIL_STACK_ERROR;
+    if(shared_size != SHM_SIZE)
+        TEST_ERROR;
+
+    /* Keep the raw data sieve buffer smaller than a page, so that raw data
+     * reads go through the page buffer
+     */
+    if(H5Pset_sieve_buf_size(fapl, (size_t)(SHM_PAGE_SIZE / 4)) < 0)
+        FAIL_STACK_ERROR;
+
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, (hsize_t)1) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pset_file_space_page_size(fcpl, (hsize_t)SHM_PAGE_SIZE) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create the file, which doesn't use the shared tier */
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl)) < 0)
+        FAIL_STACK_ERROR;
+    if(NULL == (f = (H5F_t *)H5I_object(file_id)))
+        FAIL_STACK_ERROR;
+    if(NULL == f->shared->page_buf || NULL != f->shared->page_buf->shm)
+        TEST_ERROR;
+
+    if((data = (int *)HDmalloc(SHM_NELMTS * sizeof(int))) == NULL)
+        TEST_ERROR
+    for(u = 0; u < SHM_NELMTS; u++)
+        data[u] = (int)u;
+    if((space_id = H5Screate_simple(1, &dims, NULL)) < 0)
+        FAIL_STACK_ERROR;
+    if((dset_id = H5Dcreate2(file_id, "dset", H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    file_id = -1;
+
+    /* Fork the second reader before the file is opened again, so that it
+     * doesn't inherit the parent's open file
+     */
+    if(HDpipe(pipe_fd) < 0)
+        TEST_ERROR
+    if((pid = HDfork()) < 0)
+        TEST_ERROR
+    else if(0 == pid) {
+        hid_t child_file_id;
+
+        /* Wait for the parent to read the dataset */
+        HDclose(pipe_fd[1]);
+        if(HDread(pipe_fd[0], &go, (size_t)1) != 1)
+            HD_exit(EXIT_FAILURE);
+        HDclose(pipe_fd[0]);
+
+        /* Read the dataset: all raw data pages must come from the shared tier */
+        if((child_file_id = shared_read_dset(filename, fapl)) < 0)
+            HD_exit(EXIT_FAILURE);
+        f = (H5F_t *)H5I_object(child_file_id);
+        if(0 != f->shared->page_buf->misses[1] || 0 == f->shared->page_buf->shm_hits[1])
+            HD_exit(EXIT_FAILURE);
+        if(H5Fclose(child_file_id) < 0)
+            HD_exit(EXIT_FAILURE);
+        HD_exit(EXIT_SUCCESS);
+    } /* end if */
+    HDclose(pipe_fd[0]);
+    pipe_fd[0] = -1;
+
+    /* Read the dataset: the raw data pages are read from the file and
+     * published in the shared tier
+     */
+    if((file_id = shared_read_dset(filename, fapl)) < 0)
+        TEST_ERROR
+    f = (H5F_t *)H5I_object(file_id);
+    if(0 == f->shared->page_buf->misses[1] || 0 != f->shared->page_buf->shm_hits[1])
+        TEST_ERROR;
+
+    /* The access property list reports the shared tier size */
+    if((fapl2 = H5Fget_access_plist(file_id)) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pget_page_buffer_shared_size(fapl2, &shared_size) < 0)
+        FAIL_STACK_ERROR;
+    if(shared_size != SHM_SIZE)
+        TEST_ERROR;
+    if(H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Let the child read the dataset, with the file still open here */
+    if(HDwrite(pipe_fd[1], &go, (size_t)1) != 1)
+        TEST_ERROR
+    HDclose(pipe_fd[1]);
+    pipe_fd[1] = -1;
+    while(pid != HDwaitpid(pid, &status, 0))
+        /*void*/;
+    pid = -1;
+    if(!WIFEXITED(status) || WEXITSTATUS(status))
+        TEST_ERROR
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    file_id = -1;
+
+    /* A reader that exits without closing the file leaves the segment
+     * behind, with its pages published
+     */
+    if((pid = HDfork()) < 0)
+        TEST_ERROR
+    else if(0 == pid) {
+        if(shared_read_dset(filename, fapl) < 0)
+            HD_exit(EXIT_FAILURE);
+        HD_exit(EXIT_SUCCESS);
+    } /* end if */
+    while(pid != HDwaitpid(pid, &status, 0))
+        /*void*/;
+    pid = -1;
+    if(!WIFEXITED(status) || WEXITSTATUS(status))
+        TEST_ERROR
+
+    /* Fork another reader before the file is opened again */
+    if(HDpipe(pipe_fd) < 0)
+        TEST_ERROR
+    if((pid = HDfork()) < 0)
+        TEST_ERROR
+    else if(0 == pid) {
+        hid_t child_file_id;
+
+        HDclose(pipe_fd[1]);
+        if(HDread(pipe_fd[0], &go, (size_t)1) != 1)
+            HD_exit(EXIT_FAILURE);
+        HDclose(pipe_fd[0]);
+
+        /* The segment must have survived the close in the other child */
+        if((child_file_id = shared_read_dset(filename, fapl)) < 0)
+            HD_exit(EXIT_FAILURE);
+        f = (H5F_t *)H5I_object(child_file_id);
+        if(0 != f->shared->page_buf->misses[1] || 0 == f->shared->page_buf->shm_hits[1])
+            HD_exit(EXIT_FAILURE);
+        if(H5Fclose(child_file_id) < 0)
+            HD_exit(EXIT_FAILURE);
+        HD_exit(EXIT_SUCCESS);
+    } /* end if */
+    HDclose(pipe_fd[0]);
+    pipe_fd[0] = -1;
+
+    /* The next reader removes the stale segment and starts a new one */
+    if((file_id = shared_read_dset(filename, fapl)) < 0)
+        TEST_ERROR
+    f = (H5F_t *)H5I_object(file_id);
+    if(0 == f->shared->page_buf->misses[1] || 0 != f->shared->page_buf->shm_hits[1])
+        TEST_ERROR;
+
+    /* A child that inherits the open file and closes it must not detach
+     * this process from the segment
+     */
+    {
+        pid_t closer_pid;
+
+        if((closer_pid = HDfork()) < 0)
+            TEST_ERROR
+        else if(0 == closer_pid) {
+            HDclose(pipe_fd[1]);
+            if(H5Fclose(file_id) < 0)
+                HD_exit(EXIT_FAILURE);
+            HD_exit(EXIT_SUCCESS);
+        } /* end if */
+        while(closer_pid != HDwaitpid(closer_pid, &status, 0))
+            /*void*/;
+        if(!WIFEXITED(status) || WEXITSTATUS(status))
+            TEST_ERROR
+    }
+
+    /* Let the other reader find the pages published here */
+    if(HDwrite(pipe_fd[1], &go, (size_t)1) != 1)
+        TEST_ERROR
+    HDclose(pipe_fd[1]);
+    pipe_fd[1] = -1;
+    while(pid != HDwaitpid(pid, &status, 0))
+        /*void*/;
+    pid = -1;
+    if(!WIFEXITED(status) || WEXITSTATUS(status))
+        TEST_ERROR
+
+    if(H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fcpl) < 0)
+        FAIL_STACK_ERROR;
+    if(H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR;
+    HDfree(data);
+
+    PASSED()
+    return 0;
+
+error:
+    if(pipe_fd[0] >= 0)
+        HDclose(pipe_fd[0]);
+    if(pipe_fd[1] >= 0)
+        HDclose(pipe_fd[1]);
+    if(pid > 0)
+        while(pid != HDwaitpid(pid, &status, 0))
+            /*void*/;
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    if(data)
+        HDfree(data);
+
+    return 1;
+#endif /* H5_HAVE_FORK && H5_HAVE_WAITPID && H5_HAVE_SHM_OPEN && H5_HAVE_MMAP */
+} /* test_shared_memory */
+
 
 /*-------------------------------------------------------------------------
  * Function:    verify_page_buffering_disabled()
@@ -2177,8 +2738,10 @@ main(void)
     nerrors += test_args(fapl, env_h5_drvr);
     nerrors += test_raw_data_handling(fapl, env_h5_drvr);
     nerrors += test_lru_processing(fapl, env_h5_drvr);
+    nerrors += test_2q_processing(fapl, env_h5_drvr);
     nerrors += test_min_threshold(fapl, env_h5_drvr);
     nerrors += test_stats_collection(fapl, env_h5_drvr);
+    nerrors += test_shared_memory(fapl, env_h5_drvr);
 
 #endif /* H5_HAVE_PARALLEL */
 
@@ -118,6 +118,15 @@
 #define NGROUPS			2
 #define NDSETS			4
 
+/* Declarations for test_file_meta_read_ahead() */
+#define FILE8			"tfile8.h5"	/* Test file */
+#define RA_SIZE			(64 * 1024)	/* Metadata read-ahead size */
+#define RA_NGROUPS		600		/* # of links in group */
+#define RA_NATTRS		24		/* # of attributes on dataset */
+#define RA_ATTR_NELMTS		64		/* # of elements in each attribute */
+#define RA_DSET_NELMTS		2000		/* # of elements in dataset */
+#define RA_CHUNK_NELMTS		4		/* # of elements in each chunk */
+
 /* Files created under 1.6 branch and 1.8 branch--used in test_filespace_compatible() */
 const char *OLD_FILENAME[] = {  
     "filespace_1_6.h5",	/* 1.6 HDF5 file */
@@ -5033,6 +5042,234 @@ test_libver_macros2(void)
 
 } /* test_libver_macros2() */
 
+/****************************************************************
+**
+**  test_file_meta_read_ahead():
+**	Test that metadata read-ahead (H5Pset_meta_read_ahead_size)
+**	doesn't change what is read back: large v1 & v2 B-tree
+**	indexed groups, object headers with continuation chunks and
+**	extensible array chunk indices are read with read-ahead on.
+**	Also checks that blocks were actually read ahead and served
+**	from the read-ahead buffer, and that nothing is read ahead
+**	by default.
+**
+****************************************************************/
+static herr_t
+test_file_meta_read_ahead_cb(hid_t H5_ATTR_UNUSED group, const char H5_ATTR_UNUSED *name,
+    const H5L_info_t H5_ATTR_UNUSED *info, void *op_data)
+{
+    (*(unsigned *)op_data)++;
+
+    return(H5_ITER_CONT);
+} /* test_file_meta_read_ahead_cb() */
+
+static void
+test_file_meta_read_ahead(void)
+{
+    hid_t	file, fapl, fapl2, grp, dset, space, dcpl, attr;
+    hsize_t     dims[1] = {RA_DSET_NELMTS};
+    hsize_t     max_dims[1] = {H5S_UNLIMITED};
+    hsize_t     chunk_dims[1] = {RA_CHUNK_NELMTS};
+    hsize_t     attr_dims[1] = {RA_ATTR_NELMTS};
+    int         *wdata, *rdata;
+    char        name[32];
+    size_t      ra_size;
+    unsigned    count;
+    unsigned    nreads, nhits;
+    unsigned    latest;
+    unsigned    u, v;
+    herr_t	ret;
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing metadata read-ahead\n"));
+
+    wdata = (int *)HDmalloc(sizeof(int) * RA_DSET_NELMTS);
+    CHECK(wdata, NULL, "HDmalloc");
+    rdata = (int *)HDmalloc(sizeof(int) * RA_DSET_NELMTS);
+    CHECK(rdata, NULL, "HDmalloc");
+    for(u = 0; u < RA_DSET_NELMTS; u++)
+        wdata[u] = (int)u;
+
+    /* Check the default & the property round trip */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pget_meta_read_ahead_size(fapl, &ra_size);
+    CHECK(ret, FAIL, "H5Pget_meta_read_ahead_size");
+    VERIFY(ra_size, 0, "H5Pget_meta_read_ahead_size");
+    ret = H5Pset_meta_read_ahead_size(fapl, (size_t)RA_SIZE);
+    CHECK(ret, FAIL, "H5Pset_meta_read_ahead_size");
+    ret = H5Pget_meta_read_ahead_size(fapl, &ra_size);
+    CHECK(ret, FAIL, "H5Pget_meta_read_ahead_size");
+    VERIFY(ra_size, RA_SIZE, "H5Pget_meta_read_ahead_size");
+
+    /* Test with the earliest & latest formats */
+    for(latest = 0; latest < 2; latest++) {
+        hid_t create_fapl = H5Pcreate(H5P_FILE_ACCESS);
+        CHECK(create_fapl, FAIL, "H5Pcreate");
+        if(latest) {
+            ret = H5Pset_libver_bounds(create_fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST);
+            CHECK(ret, FAIL, "H5Pset_libver_bounds");
+        } /* end if */
+
+        /* Create the file */
+        file = H5Fcreate(FILE8, H5F_ACC_TRUNC, H5P_DEFAULT, create_fapl);
+        CHECK(file, FAIL, "H5Fcreate");
+
+        /* Create a group with enough links to need internal B-tree nodes */
+        grp = H5Gcreate2(file, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(grp, FAIL, "H5Gcreate2");
+        for(u = 0; u < RA_NGROUPS; u++) {
+            hid_t sub;
+
+            HDsprintf(name, "sub %05u", u);
+            sub = H5Gcreate2(grp, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(sub, FAIL, "H5Gcreate2");
+            ret = H5Gclose(sub);
+            CHECK(ret, FAIL, "H5Gclose");
+        } /* end for */
+        ret = H5Gclose(grp);
+        CHECK(ret, FAIL, "H5Gclose");
+
+        /* Create a chunked dataset, with an extensible array index for the latest format */
+        space = H5Screate_simple(1, dims, max_dims);
+        CHECK(space, FAIL, "H5Screate_simple");
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, FAIL, "H5Pcreate");
+        ret = H5Pset_chunk(dcpl, 1, chunk_dims);
+        CHECK(ret, FAIL, "H5Pset_chunk");
+        dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(dset, FAIL, "H5Dcreate2");
+        ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Pclose(dcpl);
+        CHECK(ret, FAIL, "H5Pclose");
+        ret = H5Sclose(space);
+        CHECK(ret, FAIL, "H5Sclose");
+
+        /* Add enough attributes to the dataset to need continuation chunks */
+        space = H5Screate_simple(1, attr_dims, NULL);
+        CHECK(space, FAIL, "H5Screate_simple");
+        for(u = 0; u < RA_NATTRS; u++) {
+            HDsprintf(name, "attr %02u", u);
+            attr = H5Acreate2(dset, name, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(attr, FAIL, "H5Acreate2");
+            ret = H5Awrite(attr, H5T_NATIVE_INT, wdata + u);
+            CHECK(ret, FAIL, "H5Awrite");
+            ret = H5Aclose(attr);
+            CHECK(ret, FAIL, "H5Aclose");
+        } /* end for */
+        ret = H5Sclose(space);
+        CHECK(ret, FAIL, "H5Sclose");
+
+        ret = H5Dclose(dset);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Fclose(file);
+        CHECK(ret, FAIL, "H5Fclose");
+        ret = H5Pclose(create_fapl);
+        CHECK(ret, FAIL, "H5Pclose");
+
+        /* Re-open the file with metadata read-ahead */
+        file = H5Fopen(FILE8, H5F_ACC_RDWR, fapl);
+        CHECK(file, FAIL, "H5Fopen");
+
+        /* Verify the file's access property list */
+        fapl2 = H5Fget_access_plist(file);
+        CHECK(fapl2, FAIL, "H5Fget_access_plist");
+        ret = H5Pget_meta_read_ahead_size(fapl2, &ra_size);
+        CHECK(ret, FAIL, "H5Pget_meta_read_ahead_size");
+        VERIFY(ra_size, RA_SIZE, "H5Pget_meta_read_ahead_size");
+        ret = H5Pclose(fapl2);
+        CHECK(ret, FAIL, "H5Pclose");
+
+        /* Iterate over the group */
+        grp = H5Gopen2(file, "group", H5P_DEFAULT);
+        CHECK(grp, FAIL, "H5Gopen2");
+        count = 0;
+        ret = H5Literate(grp, H5_INDEX_NAME, H5_ITER_INC, NULL, test_file_meta_read_ahead_cb, &count);
+        CHECK(ret, FAIL, "H5Literate");
+        VERIFY(count, RA_NGROUPS, "H5Literate");
+
+        /* Modify a sub-group's metadata after read-ahead, and verify it's visible */
+        ret = H5Lmove(grp, "sub 00000", grp, "sub moved", H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(ret, FAIL, "H5Lmove");
+        ret = H5Gclose(grp);
+        CHECK(ret, FAIL, "H5Gclose");
+
+        /* Read the dataset & its attributes back */
+        dset = H5Dopen2(file, "dset", H5P_DEFAULT);
+        CHECK(dset, FAIL, "H5Dopen2");
+        HDmemset(rdata, 0, sizeof(int) * RA_DSET_NELMTS);
+        ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+        for(u = 0; u < RA_DSET_NELMTS; u++)
+            VERIFY(rdata[u], wdata[u], "H5Dread");
+        for(u = 0; u < RA_NATTRS; u++) {
+            HDsprintf(name, "attr %02u", u);
+            attr = H5Aopen(dset, name, H5P_DEFAULT);
+            CHECK(attr, FAIL, "H5Aopen");
+            ret = H5Aread(attr, H5T_NATIVE_INT, rdata);
+            CHECK(ret, FAIL, "H5Aread");
+            for(v = 0; v < RA_ATTR_NELMTS; v++)
+                VERIFY(rdata[v], wdata[u + v], "H5Aread");
+            ret = H5Aclose(attr);
+            CHECK(ret, FAIL, "H5Aclose");
+        } /* end for */
+        ret = H5Dclose(dset);
+        CHECK(ret, FAIL, "H5Dclose");
+
+        /* Verify that metadata was read ahead, and that reads were served from it */
+        ret = H5F_get_meta_read_ahead_stats_test(file, &nreads, &nhits);
+        CHECK(ret, FAIL, "H5F_get_meta_read_ahead_stats_test");
+        CHECK(nreads, 0, "H5F_get_meta_read_ahead_stats_test");
+        CHECK(nhits, 0, "H5F_get_meta_read_ahead_stats_test");
+        ret = H5Fclose(file);
+        CHECK(ret, FAIL, "H5Fclose");
+
+        /* Re-open the file, and check the modification made above */
+        file = H5Fopen(FILE8, H5F_ACC_RDONLY, fapl);
+        CHECK(file, FAIL, "H5Fopen");
+        grp = H5Gopen2(file, "group", H5P_DEFAULT);
+        CHECK(grp, FAIL, "H5Gopen2");
+        count = 0;
+        ret = H5Literate(grp, H5_INDEX_NAME, H5_ITER_INC, NULL, test_file_meta_read_ahead_cb, &count);
+        CHECK(ret, FAIL, "H5Literate");
+        VERIFY(count, RA_NGROUPS, "H5Literate");
+        VERIFY(H5Lexists(grp, "sub moved", H5P_DEFAULT), TRUE, "H5Lexists");
+        VERIFY(H5Lexists(grp, "sub 00000", H5P_DEFAULT), FALSE, "H5Lexists");
+        ret = H5Gclose(grp);
+        CHECK(ret, FAIL, "H5Gclose");
+        ret = H5F_get_meta_read_ahead_stats_test(file, &nreads, &nhits);
+        CHECK(ret, FAIL, "H5F_get_meta_read_ahead_stats_test");
+        CHECK(nreads, 0, "H5F_get_meta_read_ahead_stats_test");
+        CHECK(nhits, 0, "H5F_get_meta_read_ahead_stats_test");
+        ret = H5Fclose(file);
+        CHECK(ret, FAIL, "H5Fclose");
+
+        /* Verify that nothing is read ahead by default */
+        file = H5Fopen(FILE8, H5F_ACC_RDONLY, H5P_DEFAULT);
+        CHECK(file, FAIL, "H5Fopen");
+        grp = H5Gopen2(file, "group", H5P_DEFAULT);
+        CHECK(grp, FAIL, "H5Gopen2");
+        count = 0;
+        ret = H5Literate(grp, H5_INDEX_NAME, H5_ITER_INC, NULL, test_file_meta_read_ahead_cb, &count);
+        CHECK(ret, FAIL, "H5Literate");
+        VERIFY(count, RA_NGROUPS, "H5Literate");
+        ret = H5Gclose(grp);
+        CHECK(ret, FAIL, "H5Gclose");
+        ret = H5F_get_meta_read_ahead_stats_test(file, &nreads, &nhits);
+        CHECK(ret, FAIL, "H5F_get_meta_read_ahead_stats_test");
+        VERIFY(nreads, 0, "H5F_get_meta_read_ahead_stats_test");
+        VERIFY(nhits, 0, "H5F_get_meta_read_ahead_stats_test");
+        ret = H5Fclose(file);
+        CHECK(ret, FAIL, "H5Fclose");
+    } /* end for */
+
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    HDfree(wdata);
+    HDfree(rdata);
+} /* test_file_meta_read_ahead() */
+
 /****************************************************************
 **
 **  test_deprec():
@@ -5318,6 +5555,7 @@ test_file(void)
     test_libver_bounds();                       /* Test compatibility for file space management */
     test_libver_macros();                       /* Test the macros for library version comparison */
     test_libver_macros2();                      /* Test the macros for library version comparison */
+    test_file_meta_read_ahead();                /* Test metadata read-ahead */
 #ifndef H5_NO_DEPRECATED_SYMBOLS
     test_deprec();                              /* Test deprecated routines */
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
@@ -5349,5 +5587,6 @@ cleanup_file(void)
     HDremove(FILE5);
     HDremove(FILE6);
     HDremove(FILE7);
+    HDremove(FILE8);
 }
 
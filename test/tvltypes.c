@@ -42,6 +42,9 @@
 #define SPACE4_DIM_SMALL     128
 #define SPACE4_DIM_LARGE     (H5D_TEMP_BUF_SIZE / 64)
 
+/* Number of elements of the VL sequence of more than 1MB */
+#define VL_BIG_SEQ_LEN          (((1024 * 1024) / sizeof(unsigned int)) + 6)
+
 void *test_vltypes_alloc_custom(size_t size, void *info);
 void test_vltypes_free_custom(void *mem, void *info);
 
@@ -1860,6 +1863,7 @@ test_vltypes_vlen_vlen_atomic(void)
     hid_t		sid1;       /* Dataspace ID			*/
     hid_t		tid1, tid2; /* Datatype IDs         */
     hid_t       xfer_pid;   /* Dataset transfer property list ID */
+    H5D_vlen_arena_t *arena;    /* VL data arena */
     hsize_t		dims1[] = {SPACE1_DIM1};
     hsize_t     size;       /* Number of bytes which will be used */
     unsigned       i,j,k;      /* counting variables */
@@ -2004,6 +2008,42 @@ test_vltypes_vlen_vlen_atomic(void)
     /* Make certain the VL memory has been freed */
     VERIFY(mem_used,0,"H5Dvlen_reclaim");
 
+    /* Read the dataset again into an arena, which takes precedence over
+     * the custom memory allocation routines for both levels of VL data */
+    arena = H5Dvlen_arena_create();
+    CHECK(arena, NULL, "H5Dvlen_arena_create");
+    ret = H5Pset_vlen_arena(xfer_pid, arena);
+    CHECK(ret, FAIL, "H5Pset_vlen_arena");
+
+    ret = H5Dread(dataset, tid2, H5S_ALL, H5S_ALL, xfer_pid, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+    VERIFY(mem_used, 0, "H5Dread");
+
+    /* Compare data read in */
+    for(i=0; i<SPACE1_DIM1; i++) {
+        if(wdata[i].len!=rdata[i].len) {
+            TestErrPrintf("%d: VL data length don't match!, wdata[%d].len=%d, rdata[%d].len=%d\n",__LINE__,(int)i,(int)wdata[i].len,(int)i,(int)rdata[i].len);
+            continue;
+        } /* end if */
+        for(t1=(hvl_t *)wdata[i].p, t2=(hvl_t *)(rdata[i].p), j=0; j<rdata[i].len; j++, t1++, t2++) {
+            if(t1->len!=t2->len) {
+                TestErrPrintf("%d: VL data length don't match!, i=%d, j=%d, t1->len=%d, t2->len=%d\n",__LINE__,(int)i,(int)j,(int)t1->len,(int)t2->len);
+                continue;
+            } /* end if */
+            if(HDmemcmp(t1->p, t2->p, t2->len * sizeof(unsigned int)))
+                TestErrPrintf("%d: VL data values don't match!, i=%d, j=%d\n",__LINE__,(int)i,(int)j);
+        } /* end for */
+    } /* end for */
+
+    /* Reclaiming VL data in an arena leaves it alone; the arena frees it all */
+    ret=H5Dvlen_reclaim(tid2,sid1,xfer_pid,rdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+    VERIFY(mem_used,0,"H5Dvlen_reclaim");
+    ret = H5Pset_vlen_arena(xfer_pid, NULL);
+    CHECK(ret, FAIL, "H5Pset_vlen_arena");
+    ret = H5Dvlen_arena_free(arena);
+    CHECK(ret, FAIL, "H5Dvlen_arena_free");
+
     /* Reclaim the write VL data */
     ret=H5Dvlen_reclaim(tid2,sid1,H5P_DEFAULT,wdata);
     CHECK(ret, FAIL, "H5Dvlen_reclaim");
@@ -3158,6 +3198,241 @@ test_vltypes_fill_value(void)
     HDfree(rbuf);
 } /* end test_vltypes_fill_value() */
 
+/****************************************************************
+**
+**  test_vltypes_arena(): Test reading VL data from many global
+**      heap collections, in the order written and out of order,
+**      into memory allocated by the library and from a VL arena.
+**
+****************************************************************/
+static void
+test_vltypes_arena(void)
+{
+    hvl_t *wdata;               /* Information to write */
+    hvl_t *rdata;               /* Information read in */
+    char **wstr;                /* Strings to write */
+    char **rstr;                /* Strings read in */
+    hid_t fid1;                 /* HDF5 File IDs */
+    hid_t dataset, dataset2;    /* Dataset IDs */
+    hid_t sid1;                 /* Dataspace ID */
+    hid_t tid1, tid2;           /* Datatype IDs */
+    hid_t xfer_pid;             /* Dataset transfer property list ID */
+    H5D_vlen_arena_t *arena;    /* VL data arena */
+    H5D_vlen_arena_t *arena2;   /* VL data arena from property list */
+    hsize_t dims1[] = {SPACE4_DIM_LARGE};
+    hsize_t start[1], stride[1], count[1];
+    unsigned i, j;              /* counting variables */
+    unsigned pass;              /* Read with the default allocator or an arena */
+    herr_t ret;                 /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing VL Data Read From Many Heap Collections\n"));
+
+    wdata = (hvl_t *)HDmalloc(SPACE4_DIM_LARGE * sizeof(hvl_t));
+    CHECK(wdata, NULL, "HDmalloc");
+    rdata = (hvl_t *)HDmalloc(SPACE4_DIM_LARGE * sizeof(hvl_t));
+    CHECK(rdata, NULL, "HDmalloc");
+    wstr = (char **)HDmalloc(SPACE4_DIM_LARGE * sizeof(char *));
+    CHECK(wstr, NULL, "HDmalloc");
+    rstr = (char **)HDmalloc(SPACE4_DIM_LARGE * sizeof(char *));
+    CHECK(rstr, NULL, "HDmalloc");
+
+    /* Sequences of varying length (every 7th "nil", one large one) and strings */
+    for(i = 0; i < SPACE4_DIM_LARGE; i++) {
+        wdata[i].len = (i % 7) ? (i % 23) : 0;
+        if(i == SPACE4_DIM_LARGE / 2)
+            wdata[i].len = 50000;
+        wdata[i].p = wdata[i].len ? HDmalloc(wdata[i].len * sizeof(unsigned int)) : NULL;
+        for(j = 0; j < wdata[i].len; j++)
+            ((unsigned int *)wdata[i].p)[j] = i * 10 + j;
+
+        wstr[i] = (char *)HDmalloc(32);
+        HDsnprintf(wstr[i], 32, "string %u%s", i, (i % 3) ? "" : " of some length");
+    } /* end for */
+
+    /* Create file, datatypes and datasets */
+    fid1 = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid1, FAIL, "H5Fcreate");
+    sid1 = H5Screate_simple(SPACE1_RANK, dims1, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+    tid1 = H5Tvlen_create(H5T_NATIVE_UINT);
+    CHECK(tid1, FAIL, "H5Tvlen_create");
+    tid2 = H5Tcopy(H5T_C_S1);
+    CHECK(tid2, FAIL, "H5Tcopy");
+    ret = H5Tset_size(tid2, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+    dataset = H5Dcreate2(fid1, "Dataset1", tid1, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+    dataset2 = H5Dcreate2(fid1, "Dataset2", tid2, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset2, FAIL, "H5Dcreate2");
+
+    /* Write all the elements, then rewrite every other one, so that
+     * neighboring elements are in different heap collections */
+    ret = H5Dwrite(dataset, tid1, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dwrite(dataset2, tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, wstr);
+    CHECK(ret, FAIL, "H5Dwrite");
+    start[0] = 0; stride[0] = 2; count[0] = SPACE4_DIM_LARGE / 2;
+    ret = H5Sselect_hyperslab(sid1, H5S_SELECT_SET, start, stride, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dwrite(dataset, tid1, sid1, sid1, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dwrite(dataset2, tid2, sid1, sid1, H5P_DEFAULT, wstr);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Sselect_all(sid1);
+    CHECK(ret, FAIL, "H5Sselect_all");
+
+    xfer_pid = H5Pcreate(H5P_DATASET_XFER);
+    CHECK(xfer_pid, FAIL, "H5Pcreate");
+
+    for(pass = 0; pass < 2; pass++) {
+        arena = NULL;
+        if(pass) {
+            arena = H5Dvlen_arena_create();
+            CHECK(arena, NULL, "H5Dvlen_arena_create");
+            ret = H5Pset_vlen_arena(xfer_pid, arena);
+            CHECK(ret, FAIL, "H5Pset_vlen_arena");
+            ret = H5Pget_vlen_arena(xfer_pid, &arena2);
+            CHECK(ret, FAIL, "H5Pget_vlen_arena");
+            if(arena2 != arena)
+                TestErrPrintf("%d: H5Pget_vlen_arena returned %p, expected %p\n", __LINE__, arena2, arena);
+        } /* end if */
+
+        /* Read the data back */
+        ret = H5Dread(dataset, tid1, H5S_ALL, H5S_ALL, xfer_pid, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+        ret = H5Dread(dataset2, tid2, H5S_ALL, H5S_ALL, xfer_pid, rstr);
+        CHECK(ret, FAIL, "H5Dread");
+
+        /* Check data read in */
+        for(i = 0; i < SPACE4_DIM_LARGE; i++) {
+            if(rdata[i].len != wdata[i].len) {
+                TestErrPrintf("VL data length don't match!, rdata[%u].len=%u, wdata[%u].len=%u\n", i, (unsigned)rdata[i].len, i, (unsigned)wdata[i].len);
+                break;
+            } /* end if */
+            if(rdata[i].len && HDmemcmp(rdata[i].p, wdata[i].p, rdata[i].len * sizeof(unsigned int))) {
+                TestErrPrintf("VL data values don't match!, element %u\n", i);
+                break;
+            } /* end if */
+            if(HDstrcmp(rstr[i], wstr[i])) {
+                TestErrPrintf("VL strings don't match!, rstr[%u]=%s, wstr[%u]=%s\n", i, rstr[i], i, wstr[i]);
+                break;
+            } /* end if */
+        } /* end for */
+
+        /* Reclaim the read VL data (a no-op with an arena) */
+        ret = H5Dvlen_reclaim(tid1, sid1, xfer_pid, rdata);
+        CHECK(ret, FAIL, "H5Dvlen_reclaim");
+        ret = H5Dvlen_reclaim(tid2, sid1, xfer_pid, rstr);
+        CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+        if(arena) {
+            ret = H5Pset_vlen_arena(xfer_pid, NULL);
+            CHECK(ret, FAIL, "H5Pset_vlen_arena");
+            ret = H5Dvlen_arena_free(arena);
+            CHECK(ret, FAIL, "H5Dvlen_arena_free");
+        } /* end if */
+    } /* end for */
+
+    ret = H5Pclose(xfer_pid);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Dclose(dataset2);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Tclose(tid1);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(tid2);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid1);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Release the data written */
+    for(i = 0; i < SPACE4_DIM_LARGE; i++) {
+        HDfree(wdata[i].p);
+        HDfree(wstr[i]);
+    } /* end for */
+    HDfree(wdata);
+    HDfree(rdata);
+    HDfree(wstr);
+    HDfree(rstr);
+} /* end test_vltypes_arena() */
+
+/****************************************************************
+**
+**  test_vltypes_heap_batch(): Test writing VL data whose batch of
+**      heap objects is flushed for a sequence of more than 1MB, and
+**      reading it back after the file is reopened.
+**
+****************************************************************/
+static void
+test_vltypes_heap_batch(void)
+{
+    hid_t fid1;                 /* HDF5 File ID */
+    hid_t dataset;              /* Dataset ID */
+    hid_t sid1;                 /* Dataspace ID */
+    hid_t tid1;                 /* Datatype ID */
+    hvl_t wdata[SPACE1_DIM1];   /* Information to write */
+    hvl_t rdata[SPACE1_DIM1];   /* Information read in */
+    hsize_t dims1[] = {SPACE1_DIM1};
+    unsigned i, j;              /* counting variables */
+    herr_t ret;                 /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing VL Data Written In Batches\n"));
+
+    for(i = 0; i < SPACE1_DIM1; i++) {
+        wdata[i].len = (i == SPACE1_DIM1 / 2) ? VL_BIG_SEQ_LEN : (i + 1) * 100;
+        wdata[i].p = HDmalloc(wdata[i].len * sizeof(unsigned int));
+        CHECK(wdata[i].p, NULL, "HDmalloc");
+        for(j = 0; j < wdata[i].len; j++)
+            ((unsigned int *)wdata[i].p)[j] = i * 10 + j;
+    } /* end for */
+
+    /* Write the data */
+    fid1 = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid1, FAIL, "H5Fcreate");
+    sid1 = H5Screate_simple(SPACE1_RANK, dims1, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+    tid1 = H5Tvlen_create(H5T_NATIVE_UINT);
+    CHECK(tid1, FAIL, "H5Tvlen_create");
+    dataset = H5Dcreate2(fid1, "Dataset1", tid1, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+    ret = H5Dwrite(dataset, tid1, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid1);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Read it back from the file */
+    fid1 = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(fid1, FAIL, "H5Fopen");
+    dataset = H5Dopen2(fid1, "Dataset1", H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dopen2");
+    ret = H5Dread(dataset, tid1, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+    for(i = 0; i < SPACE1_DIM1; i++)
+        if(wdata[i].len != rdata[i].len || HDmemcmp(wdata[i].p, rdata[i].p, wdata[i].len * sizeof(unsigned int)))
+            TestErrPrintf("%d: VL data doesn't match!, wdata[%u].len=%u, rdata[%u].len=%u\n", __LINE__, i, (unsigned)wdata[i].len, i, (unsigned)rdata[i].len);
+    ret = H5Dvlen_reclaim(tid1, sid1, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Tclose(tid1);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid1);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    for(i = 0; i < SPACE1_DIM1; i++)
+        HDfree(wdata[i].p);
+} /* end test_vltypes_heap_batch() */
+
 /****************************************************************
 **
 **  test_vltypes(): Main VL datatype testing routine.
@@ -3185,6 +3460,8 @@ test_vltypes(void)
     test_vltypes_compound_vlen_vlen();/* Test compound datatypes with VL atomic components */
     test_vltypes_compound_vlstr();    /* Test data rewritten of nested VL data */
     test_vltypes_fill_value();        /* Test fill value for VL data */
+    test_vltypes_arena();             /* Test VL data read in batches and into an arena */
+    test_vltypes_heap_batch();        /* Test VL data written in batches */
 }   /* test_vltypes() */
 
 
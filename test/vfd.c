@@ -19,6 +19,7 @@
  */
 
 #include "h5test.h"
+#include "H5Fprivate.h"
 
 #define KB              1024U
 #define FAMILY_NUMBER   4
@@ -45,6 +46,7 @@
 #define THRESHOLD    1
 #define DSET2_NAME   "dset2"
 #define DSET2_DIM    4
+#define DIRECT_COMBINE_SIZE (5 * FBSIZE - 100)
 #endif /* H5_HAVE_DIRECT */
 
 const char *FILENAME[] = {
@@ -58,11 +60,31 @@ const char *FILENAME[] = {
     "stdio_file",        /*7*/
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
+    "mmap_file",         /*10*/
+    "stripe_file",       /*11*/
+    "trace_file",        /*12*/
+    "multi_async_file",  /*13*/
     NULL
 };
 
 #define LOG_FILENAME "log_vfd_out.log"
 
+/* Macros for the stripe VFD test */
+#define STRIPE_SIZE     (4 * KB)
+#define STRIPE_NMEMBS   4
+#define STRIPE_DIM0     512
+#define STRIPE_DIM1     1024
+
+/* Macros for the trace VFD test */
+#define TRACE_NRECORDS  4
+#define TRACE_DIM0      128
+#define TRACE_DIM1      256
+
+/* Macros for the asynchronous MULTI member test */
+#define MULTI_ASYNC_NWRITES 8
+#define MULTI_ASYNC_DIM0    256
+#define MULTI_ASYNC_DIM1    512
+
 #define COMPAT_BASENAME "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
 
@@ -176,12 +198,14 @@ test_core(void)
     hid_t       fapl_id_out = -1;           /* from H5Fget_access_plist     */
     hid_t       did = -1;                   /* dataset ID                   */
     hid_t       sid = -1;                   /* dataspace ID                 */
+    hid_t       msid = -1;                  /* memory dataspace ID          */
     char        filename[1024];             /* filename                     */
     void        *os_file_handle = NULL;     /* OS file handle               */
     hsize_t     file_size;                  /* file size                    */
     size_t      increment;                  /* core VFD increment           */
     hbool_t     backing_store;              /* use backing store?           */
     hbool_t     use_write_tracking;         /* write tracking flag          */
+    hbool_t     lazy_load;                  /* lazy load flag               */
     size_t      write_tracking_page_size;   /* write tracking page size     */
     int         *data_w = NULL;             /* data written to the dataset  */
     int         *data_r = NULL;             /* data read from the dataset   */
@@ -189,6 +213,7 @@ test_core(void)
     int         *pw = NULL, *pr = NULL;     /* pointers for iterating over
                                                data arrays (write & read)   */
     hsize_t     dims[2];                    /* dataspace dimensions         */
+    hsize_t     start[2], count[2];         /* hyperslab selection          */
     int         i, j;                       /* iterators                    */
     htri_t      status;                     /* return value from H5Lexists  */
 
@@ -446,6 +471,79 @@ test_core(void)
     if(file_size < 64 * KB || file_size > 256 * KB)
         FAIL_PUTS_ERROR("suspicious file size obtained from H5Fget_filesize");
 
+
+    /************************************************************************
+     * Open the file with lazy loading and a small page size, change one
+     * row of the dataset, and ensure that the change IS propagated and
+     * that the rest of the file, which was never loaded, is intact.
+     ************************************************************************/
+
+    if(H5Dclose(did) < 0)
+        TEST_ERROR;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* Check that lazy loading is off by default */
+    if(H5Pget_core_lazy_load(fapl_id, &lazy_load) < 0)
+        TEST_ERROR;
+    if(FALSE != lazy_load)
+        FAIL_PUTS_ERROR("lazy loading should be off by default");
+
+    if(H5Pset_core_write_tracking(fapl_id, TRUE, (size_t)(4 * KB)) < 0)
+        TEST_ERROR;
+    if(H5Pset_core_lazy_load(fapl_id, TRUE) < 0)
+        TEST_ERROR;
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR;
+    if((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Overwrite one row in the middle of the dataset */
+    start[0] = CORE_DSET_DIM1 / 2;
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = CORE_DSET_DIM2;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if((msid = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    pw = data_w + (CORE_DSET_DIM1 / 2) * CORE_DSET_DIM2;
+    for(j = 0; j < CORE_DSET_DIM2; j++)
+        pw[j] = -pw[j];
+    if(H5Dwrite(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, pw) < 0)
+        TEST_ERROR;
+    if(H5Sclose(msid) < 0)
+        TEST_ERROR;
+    if(H5Sselect_all(sid) < 0)
+        TEST_ERROR;
+
+    /* Close and reopen the file without lazy loading */
+    if(H5Dclose(did) < 0)
+        TEST_ERROR;
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+    if(H5Pset_core_lazy_load(fapl_id, FALSE) < 0)
+        TEST_ERROR;
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR;
+    if((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Read the data back and check it */
+    HDmemset(data_r, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)); 
+    if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+        TEST_ERROR;
+    pw = data_w;
+    pr = data_r;
+    for(i = 0; i < CORE_DSET_DIM1; i++)
+        for(j = 0; j < CORE_DSET_DIM2; j++)
+            if(*pw++ != *pr++) {
+                H5_FAILED();
+                printf("    Read different values than written in data set.\n");
+                printf("    At index %d,%d\n", i, j);
+                TEST_ERROR;
+            } /* end if */
+
     /* Close everything */
     if(H5Sclose(sid) < 0)
         TEST_ERROR;
@@ -469,6 +567,7 @@ test_core(void)
 
 error:
     H5E_BEGIN_TRY {
+        H5Sclose(msid);
         H5Sclose(sid);
         H5Dclose(did);
         H5Pclose(fapl_id_out);
@@ -705,6 +804,150 @@ error:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_combine
+ *
+ * Purpose:     Tests the write-combining of the DIRECT I/O driver: small
+ *              adjacent writes from unaligned memory, reading them back
+ *              before they are written out, a write away from the
+ *              buffered data and a write starting inside a block already
+ *              in the file, then checking the file after it is
+ *              truncated and reopened.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_direct_combine(void)
+{
+#ifdef H5_HAVE_DIRECT
+    hid_t       fapl = -1;
+    H5FD_t      *file = NULL;
+    char        filename[1024];
+    unsigned char *wbuf = NULL, *rbuf = NULL;
+    h5_stat_t   sb;
+    size_t      u, size;
+#endif /*H5_HAVE_DIRECT*/
+
+    TESTING("DIRECT I/O write-combining");
+
+#ifndef H5_HAVE_DIRECT
+    SKIPPED();
+    return 0;
+#else /*H5_HAVE_DIRECT*/
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_direct(fapl, MBOUNDARY, FBSIZE, CBSIZE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+
+    /* Unaligned buffers, with one extra byte so the data doesn't start on
+     * the memory boundary */
+    if(NULL == (wbuf = (unsigned char *)HDmalloc(DIRECT_COMBINE_SIZE + 1)))
+        TEST_ERROR;
+    if(NULL == (rbuf = (unsigned char *)HDmalloc(DIRECT_COMBINE_SIZE + 1)))
+        TEST_ERROR;
+    for(u = 0; u < DIRECT_COMBINE_SIZE + 1; u++)
+        wbuf[u] = (unsigned char)(u * 7);
+
+    H5E_BEGIN_TRY {
+        file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF);
+    } H5E_END_TRY;
+    if(NULL == file) {
+        H5Pclose(fapl);
+        HDfree(wbuf);
+        HDfree(rbuf);
+        SKIPPED();
+        printf("  Probably the file system doesn't support Direct I/O\n");
+        return 0;
+    }
+    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)DIRECT_COMBINE_SIZE) < 0)
+        TEST_ERROR;
+
+    /* Write the data in small, adjacent pieces of varying size */
+    for(u = 0, size = 1; u < DIRECT_COMBINE_SIZE; u += size, size = (size * 3) % 1021 + 1) {
+        size = MIN(size, DIRECT_COMBINE_SIZE - u);
+        if(H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)u, size, wbuf + 1 + u) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    /* Read it back, including the data not yet written out */
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)DIRECT_COMBINE_SIZE, rbuf + 1) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wbuf + 1, rbuf + 1, (size_t)DIRECT_COMBINE_SIZE))
+        TEST_ERROR;
+
+    /* A write away from the buffered data, and one that starts inside a
+     * block that is already in the file */
+    for(u = FBSIZE + 10; u < FBSIZE + 30; u++)
+        wbuf[1 + u] = (unsigned char)~wbuf[1 + u];
+    if(H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(FBSIZE + 10), (size_t)20, wbuf + 1 + FBSIZE + 10) < 0)
+        TEST_ERROR;
+    for(u = 2 * FBSIZE - 5; u < 2 * FBSIZE + 5; u++)
+        wbuf[1 + u] = (unsigned char)~wbuf[1 + u];
+    if(H5FDwrite(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)(2 * FBSIZE - 5), (size_t)10, wbuf + 1 + 2 * FBSIZE - 5) < 0)
+        TEST_ERROR;
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)DIRECT_COMBINE_SIZE, rbuf + 1) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wbuf + 1, rbuf + 1, (size_t)DIRECT_COMBINE_SIZE))
+        TEST_ERROR;
+
+    /* Flushing writes out the data; truncating removes the padding of the
+     * last block */
+    if(H5FDflush(file, H5P_DEFAULT, FALSE) < 0)
+        TEST_ERROR;
+    if(H5FDtruncate(file, H5P_DEFAULT, TRUE) < 0)
+        TEST_ERROR;
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+    if(HDstat(filename, &sb) < 0)
+        TEST_ERROR;
+    if((size_t)sb.st_size != DIRECT_COMBINE_SIZE)
+        TEST_ERROR;
+
+    /* Reopen the file and check the data */
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDONLY, fapl, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)DIRECT_COMBINE_SIZE) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, DIRECT_COMBINE_SIZE + 1);
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)DIRECT_COMBINE_SIZE, rbuf + 1) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(wbuf + 1, rbuf + 1, (size_t)DIRECT_COMBINE_SIZE))
+        TEST_ERROR;
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+
+    h5_delete_test_file(FILENAME[5], fapl);
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+
+    return -1;
+#endif /*H5_HAVE_DIRECT*/
+} /* end test_direct_combine() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
  *
@@ -1464,6 +1707,173 @@ error:
     return -1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_async
+ *
+ * Purpose:     Tests a split MULTI file whose raw data member is written
+ *              asynchronously: writing a dataset in several pieces,
+ *              reading it back while writes may still be queued,
+ *              checking the member statistics and reopening the file
+ *              without the asynchronous member.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_multi_async(void)
+{
+    hid_t       file = -1, fapl = -1, access_fapl = -1;
+    hid_t       dset = -1, space = -1, mspace = -1;
+    char        filename[1024];
+    hsize_t     dims[2] = {MULTI_ASYNC_DIM0, MULTI_ASYNC_DIM1};
+    hsize_t     start[2] = {0, 0};
+    hsize_t     count[2] = {MULTI_ASYNC_DIM0 / MULTI_ASYNC_NWRITES, MULTI_ASYNC_DIM1};
+    hbool_t     async;
+    H5FD_multi_stats_t stats;
+    int         *points = NULL, *check = NULL;
+    unsigned    u;
+    int         i;
+
+    TESTING("MULTI file driver with an asynchronous member");
+
+    if(NULL == (points = (int *)HDmalloc(MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1; i++)
+        points[i] = i;
+
+    /* Split file with the raw data written behind */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_split(fapl, "%s-s.h5", H5P_DEFAULT, "%s-r.h5", H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_multi_async(fapl, H5FD_MEM_DRAW, TRUE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[13], fapl, filename, sizeof(filename));
+
+    /* The setting applies to the whole member */
+    if(H5Pget_fapl_multi_async(fapl, H5FD_MEM_GHEAP, &async) < 0)
+        TEST_ERROR;
+    if(!async)
+        TEST_ERROR;
+    if(H5Pget_fapl_multi_async(fapl, H5FD_MEM_OHDR, &async) < 0)
+        TEST_ERROR;
+    if(async)
+        TEST_ERROR;
+
+    /* No statistics before the property list is used for a file */
+    if(H5Pget_fapl_multi_stats(fapl, H5FD_MEM_DRAW, &stats) < 0)
+        TEST_ERROR;
+    if(stats.nwrites != 0 || stats.bytes_written != 0)
+        TEST_ERROR;
+
+    /* Write a dataset in several pieces, then read it back */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((mspace = H5Screate_simple(2, count, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for(u = 0; u < MULTI_ASYNC_NWRITES; u++) {
+        start[0] = u * count[0];
+        if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if(H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, points + start[0] * MULTI_ASYNC_DIM1) < 0)
+            TEST_ERROR;
+    } /* end for */
+    HDmemset(check, 0, MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1; i++)
+        if(check[i] != points[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written at index %d\n", i);
+            goto error;
+        } /* end if */
+    if(H5Fflush(file, H5F_SCOPE_GLOBAL) < 0)
+        TEST_ERROR;
+
+    /* Check the member statistics */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5Pget_fapl_multi_async(access_fapl, H5FD_MEM_DRAW, &async) < 0)
+        TEST_ERROR;
+    if(!async)
+        TEST_ERROR;
+    if(H5Pget_fapl_multi_stats(access_fapl, H5FD_MEM_DRAW, &stats) < 0)
+        TEST_ERROR;
+    if(stats.nwrites < MULTI_ASYNC_NWRITES || stats.bytes_written < MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int))
+        TEST_ERROR;
+    if(stats.nreads < 1 || stats.bytes_read < MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int))
+        TEST_ERROR;
+    if(H5Pget_fapl_multi_stats(access_fapl, H5FD_MEM_SUPER, &stats) < 0)
+        TEST_ERROR;
+    if(stats.nwrites < 1 || stats.bytes_written >= MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Reopen with every member synchronous and check the data again */
+    if(H5Pset_fapl_multi_async(fapl, H5FD_MEM_DRAW, FALSE) < 0)
+        TEST_ERROR;
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(check, 0, MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < MULTI_ASYNC_DIM0 * MULTI_ASYNC_DIM1; i++)
+        if(check[i] != points[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values after reopening at index %d\n", i);
+            goto error;
+        } /* end if */
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[13], fapl);
+
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    return -1;
+} /* end test_multi_async() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_log
@@ -1734,6 +2144,554 @@ error:
 } /* end test_windows() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only MMAP driver: reading a file written
+ *              with another driver, accessing contiguous dataset storage
+ *              in place through the mapping returned by
+ *              H5Fget_vfd_handle(), and refusing write access.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP
+    hid_t       file = -1, fapl = -1, access_fapl = -1;
+    hid_t       dset = -1, space = -1;
+    char        filename[1024];
+    void        **mem = NULL;
+    hsize_t     dims[2];
+    haddr_t     offset;
+    int         *points = NULL, *check = NULL;
+    const int   *mapped;
+    int         i;
+#endif /*H5_HAVE_MMAP*/
+
+    TESTING("MMAP file driver");
+
+#ifndef H5_HAVE_MMAP
+
+    SKIPPED();
+    return 0;
+
+#else /* H5_HAVE_MMAP */
+
+    if(NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    /* Write the file with the SEC2 driver */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(fapl) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    dims[0] = DSET1_DIM1;
+    dims[1] = DSET1_DIM2;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Re-open it with the MMAP driver */
+    if(H5Pset_fapl_mmap(fapl) < 0)
+        TEST_ERROR;
+
+    /* Write access isn't allowed */
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDWR, fapl);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR;
+
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5FD_MMAP != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Read the dataset back */
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if(check[i] != points[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written at index %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* The file handle is a pointer to the mapping, where the dataset's
+     * storage can be accessed in place
+     */
+    if(H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&mem) < 0)
+        TEST_ERROR;
+    if(NULL == mem || NULL == *mem)
+        TEST_ERROR;
+    if(HADDR_UNDEF == (offset = H5Dget_offset(dset)))
+        TEST_ERROR;
+    mapped = (const int *)((const unsigned char *)*mem + offset);
+    if(HDmemcmp(mapped, points, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)))
+        TEST_ERROR;
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[10], fapl);
+
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    return -1;
+
+#endif /* H5_HAVE_MMAP */
+} /* end test_mmap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_stripe
+ *
+ * Purpose:     Tests the STRIPE driver: writing a dataset large enough to
+ *              span all the members in one request, reading it back
+ *              after reopening (where the members are opened lazily),
+ *              and reopening with the wrong stripe size.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_stripe(void)
+{
+    hid_t       file = -1, fapl = -1, access_fapl = -1, memb_fapl = -1;
+    hid_t       dset = -1, space = -1;
+    char        filename[1024];
+    char        memb_name[1024];
+    hsize_t     dims[2] = {STRIPE_DIM0, STRIPE_DIM1};
+    hsize_t     stripe_size;
+    unsigned    nmembs;
+    int         *points = NULL, *check = NULL;
+    unsigned    u;
+    int         i;
+
+    TESTING("STRIPE file driver");
+
+    if(NULL == (points = (int *)HDmalloc(STRIPE_DIM0 * STRIPE_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(STRIPE_DIM0 * STRIPE_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < STRIPE_DIM0 * STRIPE_DIM1; i++)
+        points[i] = i;
+
+    /* Set property list and file name for STRIPE driver */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_stripe(fapl, (hsize_t)STRIPE_SIZE, STRIPE_NMEMBS, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[11], fapl, filename, sizeof(filename));
+
+    /* Check the driver properties */
+    if(H5Pget_fapl_stripe(fapl, &stripe_size, &nmembs, &memb_fapl) < 0)
+        TEST_ERROR;
+    if(stripe_size != STRIPE_SIZE || nmembs != STRIPE_NMEMBS)
+        TEST_ERROR;
+    if(H5FD_SEC2 != H5Pget_driver(memb_fapl))
+        TEST_ERROR;
+    if(H5Pclose(memb_fapl) < 0)
+        TEST_ERROR;
+
+    /* Create the file and write a dataset */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5FD_STRIPE != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* The data is spread evenly over all the members */
+    for(u = 0; u < STRIPE_NMEMBS; u++) {
+        h5_stat_t sb;
+
+        HDsnprintf(memb_name, sizeof(memb_name), filename, u);
+        if(HDstat(memb_name, &sb) < 0)
+            TEST_ERROR;
+        if((hsize_t)sb.st_size < (STRIPE_DIM0 * STRIPE_DIM1 * sizeof(int)) / STRIPE_NMEMBS - STRIPE_SIZE)
+            TEST_ERROR;
+    } /* end for */
+
+    /* Reopening with the wrong stripe size or number of members fails */
+    if(H5Pset_fapl_stripe(fapl, (hsize_t)(STRIPE_SIZE * 2), STRIPE_NMEMBS, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_stripe(fapl, (hsize_t)STRIPE_SIZE, STRIPE_NMEMBS - 1, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR;
+
+    /* Reopen with the correct properties and read the data back */
+    if(H5Pset_fapl_stripe(fapl, (hsize_t)STRIPE_SIZE, STRIPE_NMEMBS, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(check, 0, STRIPE_DIM0 * STRIPE_DIM1 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < STRIPE_DIM0 * STRIPE_DIM1; i++)
+        if(check[i] != points[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written at index %d\n", i);
+            goto error;
+        } /* end if */
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[11], fapl);
+
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Pclose(memb_fapl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    return -1;
+} /* end test_stripe() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    check_trace
+ *
+ * Purpose:     Helper for test_trace(): reads the blocks of a trace file,
+ *              checking their headers and records, and counts the
+ *              sessions and records in it.  Within a session, records
+ *              must be in the order the operations started in.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+check_trace(const char *trace_name, unsigned *nsessions, size_t *nrecs,
+    size_t *nflush, hsize_t *raw_written, uint64_t *write_end)
+{
+    FILE        *fp = NULL;
+    unsigned char hdr[H5FD_TRACE_HEADER_SIZE];
+    unsigned char rec[H5FD_TRACE_RECORD_SIZE];
+    uint64_t    session = 0, prev_start = 0;
+    uint32_t    pid = 0;
+
+    *nsessions = 0;
+    *nrecs = *nflush = 0;
+    *raw_written = 0;
+    *write_end = 0;
+
+    if(NULL == (fp = HDfopen(trace_name, "rb")))
+        TEST_ERROR;
+    while(1 == HDfread(hdr, sizeof(hdr), (size_t)1, fp)) {
+        const uint8_t *p = hdr + 16;
+        uint64_t hdr_session;
+        uint32_t hdr_pid, hdr_nrecs;
+
+        if(HDmemcmp(hdr, H5FD_TRACE_MAGIC, (size_t)8))
+            TEST_ERROR;
+        if(hdr[8] != H5FD_TRACE_VERSION || hdr[12] != H5FD_TRACE_RECORD_SIZE)
+            TEST_ERROR;
+        UINT64DECODE(p, hdr_session);
+        UINT32DECODE(p, hdr_pid);
+        UINT32DECODE(p, hdr_nrecs);
+        if(0 == hdr_nrecs)
+            TEST_ERROR;
+
+        /* Only one process traces here, so sessions don't interleave */
+        if(0 == *nsessions || hdr_session != session || hdr_pid != pid) {
+            if(*nsessions > 0 && hdr_session < session)
+                TEST_ERROR;
+            session = hdr_session;
+            pid = hdr_pid;
+            prev_start = 0;
+            (*nsessions)++;
+        } /* end if */
+
+        while(hdr_nrecs-- > 0) {
+            uint64_t start, addr, size;
+
+            if(1 != HDfread(rec, sizeof(rec), (size_t)1, fp))
+                TEST_ERROR;
+            p = rec;
+            UINT64DECODE(p, start);
+            p += 8;         /* Skip the latency */
+            UINT64DECODE(p, addr);
+            UINT64DECODE(p, size);
+            if(start < prev_start)
+                TEST_ERROR;
+            prev_start = start;
+            if(rec[32] > H5FD_TRACE_OP_TRUNCATE || rec[33] >= H5FD_MEM_NTYPES)
+                TEST_ERROR;
+            if(rec[32] == H5FD_TRACE_OP_WRITE) {
+                if(rec[33] == H5FD_MEM_DRAW)
+                    *raw_written += size;
+                *write_end = MAX(*write_end, addr + size);
+            } /* end if */
+            if(rec[32] == H5FD_TRACE_OP_FLUSH)
+                (*nflush)++;
+            (*nrecs)++;
+        } /* end while */
+    } /* end while */
+    if(HDfclose(fp) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    return -1;
+} /* end check_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_trace
+ *
+ * Purpose:     Tests the TRACE driver: writing a dataset through it on
+ *              top of the SEC2 driver with a record buffer small enough
+ *              to be written out several times, checking the records in
+ *              the trace file, reading the file back through it again,
+ *              which appends a second session to the trace, and reading
+ *              the file back without the trace driver.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_trace(void)
+{
+    hid_t       file = -1, fapl = -1, access_fapl = -1;
+    hid_t       dset = -1, space = -1;
+    char        filename[1024];
+    char        trace_name[1024];
+    hsize_t     dims[2] = {TRACE_DIM0, TRACE_DIM1};
+    unsigned    nsessions;
+    size_t      nrecs, nflush, nrecs2;
+    hsize_t     raw_written;
+    uint64_t    write_end;
+    int         *points = NULL, *check = NULL;
+    int         i;
+
+    TESTING("TRACE file driver");
+
+    if(NULL == (points = (int *)HDmalloc(TRACE_DIM0 * TRACE_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(TRACE_DIM0 * TRACE_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < TRACE_DIM0 * TRACE_DIM1; i++)
+        points[i] = i;
+
+    /* Set property list and file name for TRACE driver */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[12], fapl, filename, sizeof(filename));
+    HDsnprintf(trace_name, sizeof(trace_name), "%s.trace", filename);
+    if(H5Pset_fapl_trace(fapl, trace_name, (size_t)TRACE_NRECORDS, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+
+    /* Traces are appended to, so start without one */
+    HDremove(trace_name);
+
+    /* Create the file and write a dataset */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5FD_TRACE != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Check the trace: all the raw data was written */
+    if(check_trace(trace_name, &nsessions, &nrecs, &nflush, &raw_written, &write_end) < 0)
+        TEST_ERROR;
+    if(1 != nsessions)
+        TEST_ERROR;
+    if(nrecs <= TRACE_NRECORDS || 0 == nflush)
+        TEST_ERROR;
+    if(raw_written < TRACE_DIM0 * TRACE_DIM1 * sizeof(int))
+        TEST_ERROR;
+    if((h5_stat_size_t)write_end > h5_get_file_size(filename, H5P_DEFAULT))
+        TEST_ERROR;
+
+    /* Read the file back through the trace driver: the new session is
+     * appended to the trace, after the first one
+     */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    if(check_trace(trace_name, &nsessions, &nrecs2, &nflush, &raw_written, &write_end) < 0)
+        TEST_ERROR;
+    if(2 != nsessions || nrecs2 <= nrecs)
+        TEST_ERROR;
+    if(raw_written < TRACE_DIM0 * TRACE_DIM1 * sizeof(int))
+        TEST_ERROR;
+
+    /* The file itself is an ordinary HDF5 file */
+    if(H5Pset_fapl_sec2(fapl) < 0)
+        TEST_ERROR;
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(check, 0, TRACE_DIM0 * TRACE_DIM1 * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < TRACE_DIM0 * TRACE_DIM1; i++)
+        if(check[i] != points[i]) {
+            H5_FAILED();
+            HDprintf("    Read different values than written at index %d\n", i);
+            goto error;
+        } /* end if */
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[12], fapl);
+    HDremove(trace_name);
+
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    return -1;
+} /* end test_trace() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -1760,13 +2718,18 @@ main(void)
     nerrors += test_sec2() < 0           ? 1 : 0;
     nerrors += test_core() < 0           ? 1 : 0;
     nerrors += test_direct() < 0         ? 1 : 0;
+    nerrors += test_direct_combine() < 0 ? 1 : 0;
     nerrors += test_family() < 0         ? 1 : 0;
     nerrors += test_family_compat() < 0  ? 1 : 0;
     nerrors += test_multi() < 0          ? 1 : 0;
     nerrors += test_multi_compat() < 0   ? 1 : 0;
+    nerrors += test_multi_async() < 0    ? 1 : 0;
     nerrors += test_log() < 0            ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
+    nerrors += test_mmap() < 0           ? 1 : 0;
+    nerrors += test_stripe() < 0         ? 1 : 0;
+    nerrors += test_trace() < 0          ? 1 : 0;
 
     if(nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n",
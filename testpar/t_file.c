@@ -34,6 +34,8 @@
 #include "H5Fpkg.h"
 
 #define NUM_DSETS               5
+#define OPEN_IMAGE_SIZE         4096
+#define OPEN_IMAGE_NELMTS       1024
 
 int mpi_size, mpi_rank;
 
@@ -709,7 +711,10 @@ test_file_properties(void)
 {
     hid_t fid;                  /* HDF5 file ID */
     hid_t fapl_id;		/* File access plist */
+    hid_t gid;                  /* Group ID */
     hbool_t is_coll;
+    H5F_mdc_sync_timing_t timing;   /* Sync point timing */
+    unsigned nentries = 0;      /* Entries written by all processes */
     const char *filename;
     MPI_Comm comm = MPI_COMM_WORLD;
     MPI_Info info = MPI_INFO_NULL;
@@ -791,6 +796,22 @@ test_file_properties(void)
     VRFY((ret >= 0), "H5Pget_all_coll_metadata_ops succeeded");
     VRFY((is_coll == TRUE), "Incorrect property setting for coll metadata API calls requirement");
 
+    /* Dirty some metadata and check that the sync points writing it
+     * out are reported
+     */
+    gid = H5Gcreate2(fid, "sync_timing", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((gid >= 0), "H5Gcreate2 succeeded");
+    ret = H5Gclose(gid);
+    VRFY((ret >= 0), "H5Gclose succeeded");
+    ret = H5Fflush(fid, H5F_SCOPE_GLOBAL);
+    VRFY((ret >= 0), "H5Fflush succeeded");
+    ret = H5Fget_mdc_sync_timing(fid, &timing);
+    VRFY((ret >= 0), "H5Fget_mdc_sync_timing succeeded");
+    VRFY((timing.nsync_points > 0), "no sync point reported");
+    VRFY((timing.total_time > 0.0), "no sync point time reported");
+    MPI_Allreduce(&timing.nentries, &nentries, 1, MPI_UNSIGNED, MPI_SUM, comm);
+    VRFY((nentries > 0), "no metadata entries written at sync point");
+
     /* close fapl and retrieve it from file */
     ret = H5Pclose(fapl_id);
     VRFY((ret >= 0), "H5Pclose succeeded");
@@ -820,3 +841,117 @@ test_file_properties(void)
     VRFY((ret >= 0), "H5Pclose succeeded");
 } /* end test_file_properties() */
 
+/*
+ * Open an existing file with rank 0 reading the start of the file and
+ * broadcasting it, read-only and read-write, and check that the objects
+ * and data read are right and that objects created afterwards persist.
+ */
+void
+test_open_image(void)
+{
+    hid_t fid;                  /* HDF5 file ID */
+    hid_t fapl_id;		/* File access plist */
+    hid_t sid, did, gid;        /* Dataspace, dataset and group IDs */
+    hsize_t dims[1] = {OPEN_IMAGE_NELMTS};
+    int *wbuf, *rbuf;           /* Data buffers */
+    size_t image_size;
+    const char *filename;
+    int i;
+    herr_t ret;                 /* Generic return value */
+
+    filename = (const char *)GetTestParameters();
+
+    /* set up MPI parameters */
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    wbuf = (int *)HDmalloc(sizeof(int) * OPEN_IMAGE_NELMTS);
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc(sizeof(int) * OPEN_IMAGE_NELMTS);
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+    for(i = 0; i < OPEN_IMAGE_NELMTS; i++)
+        wbuf[i] = i * 3;
+
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl_id >= 0), "H5Pcreate");
+    ret = H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio");
+
+    /* Create the file with a group and a dataset */
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+    gid = H5Gcreate2(fid, "group", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((gid >= 0), "H5Gcreate2 succeeded");
+    sid = H5Screate_simple(1, dims, NULL);
+    VRFY((sid >= 0), "H5Screate_simple succeeded");
+    did = H5Dcreate2(gid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((did >= 0), "H5Dcreate2 succeeded");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Dclose(did);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Sclose(sid);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Gclose(gid);
+    VRFY((ret >= 0), "H5Gclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Set the size of the image broadcast at open */
+    ret = H5Pset_fapl_mpio_open_image(fapl_id, (size_t)OPEN_IMAGE_SIZE);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio_open_image succeeded");
+    ret = H5Pget_fapl_mpio_open_image(fapl_id, &image_size);
+    VRFY((ret >= 0), "H5Pget_fapl_mpio_open_image succeeded");
+    VRFY((image_size == OPEN_IMAGE_SIZE), "Incorrect open image size");
+
+    /* Read the objects back from a read-only open */
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    did = H5Dopen2(fid, "/group/dset", H5P_DEFAULT);
+    VRFY((did >= 0), "H5Dopen2 succeeded");
+    HDmemset(rbuf, 0, sizeof(int) * OPEN_IMAGE_NELMTS);
+    ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    for(i = 0; i < OPEN_IMAGE_NELMTS; i++)
+        VRFY((rbuf[i] == wbuf[i]), "data read correctly");
+    ret = H5Dclose(did);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Add a group from a read-write open */
+    fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    gid = H5Gcreate2(fid, "group2", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((gid >= 0), "H5Gcreate2 succeeded");
+    ret = H5Gclose(gid);
+    VRFY((ret >= 0), "H5Gclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Setting the driver again turns the image off */
+    ret = H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio");
+    ret = H5Pget_fapl_mpio_open_image(fapl_id, &image_size);
+    VRFY((ret >= 0), "H5Pget_fapl_mpio_open_image succeeded");
+    VRFY((image_size == 0), "Incorrect open image size");
+
+    /* Both groups are there */
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    gid = H5Gopen2(fid, "group", H5P_DEFAULT);
+    VRFY((gid >= 0), "H5Gopen2 succeeded");
+    ret = H5Gclose(gid);
+    VRFY((ret >= 0), "H5Gclose succeeded");
+    gid = H5Gopen2(fid, "group2", H5P_DEFAULT);
+    VRFY((gid >= 0), "H5Gopen2 succeeded");
+    ret = H5Gclose(gid);
+    VRFY((ret >= 0), "H5Gclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_open_image() */
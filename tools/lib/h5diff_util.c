@@ -143,6 +143,14 @@ void print_type(hid_t type)
             parallel_print("H5T_IEEE_F64BE");
         } else if (H5Tequal(type, H5T_IEEE_F64LE)) {
             parallel_print("H5T_IEEE_F64LE");
+        } else if (H5Tequal(type, H5T_IEEE_F16BE)) {
+            parallel_print("H5T_IEEE_F16BE");
+        } else if (H5Tequal(type, H5T_IEEE_F16LE)) {
+            parallel_print("H5T_IEEE_F16LE");
+        } else if (H5Tequal(type, H5T_FLOAT_BFLOAT16BE)) {
+            parallel_print("H5T_FLOAT_BFLOAT16BE");
+        } else if (H5Tequal(type, H5T_FLOAT_BFLOAT16LE)) {
+            parallel_print("H5T_FLOAT_BFLOAT16LE");
         } else if (H5Tequal(type, H5T_NATIVE_FLOAT)) {
             parallel_print("H5T_NATIVE_FLOAT");
         } else if (H5Tequal(type, H5T_NATIVE_DOUBLE)) {
@@ -2070,6 +2070,18 @@ h5tools_print_datatype(FILE *stream, h5tools_str_t *buffer, const h5tool_format_
         else if (H5Tequal(type, H5T_IEEE_F64LE) == TRUE) {
             h5tools_str_append(buffer, "H5T_IEEE_F64LE");
         }
+        else if (H5Tequal(type, H5T_IEEE_F16BE) == TRUE) {
+            h5tools_str_append(buffer, "H5T_IEEE_F16BE");
+        }
+        else if (H5Tequal(type, H5T_IEEE_F16LE) == TRUE) {
+            h5tools_str_append(buffer, "H5T_IEEE_F16LE");
+        }
+        else if (H5Tequal(type, H5T_FLOAT_BFLOAT16BE) == TRUE) {
+            h5tools_str_append(buffer, "H5T_FLOAT_BFLOAT16BE");
+        }
+        else if (H5Tequal(type, H5T_FLOAT_BFLOAT16LE) == TRUE) {
+            h5tools_str_append(buffer, "H5T_FLOAT_BFLOAT16LE");
+        }
         else if (H5Tequal(type, H5T_VAX_F32) == TRUE) {
             h5tools_str_append(buffer, "H5T_VAX_F32");
         }
@@ -1246,6 +1246,10 @@ dump_fcpl(hid_t fid)
         HDstrcpy(dname,"H5FD_FAMILY");
     else if(H5FD_LOG==fdriver)
         HDstrcpy(dname,"H5FD_LOG");
+#ifdef H5_HAVE_MMAP
+    else if(H5FD_MMAP==fdriver)
+        HDstrcpy(dname,"H5FD_MMAP");
+#endif
     else if(H5FD_MPIO==fdriver)
         HDstrcpy(dname,"H5FD_MPIO");
     else if(H5FD_MULTI==fdriver)
@@ -1254,6 +1258,10 @@ dump_fcpl(hid_t fid)
         HDstrcpy(dname,"H5FD_SEC2");
     else if(H5FD_STDIO==fdriver)
         HDstrcpy(dname,"H5FD_STDIO");
+    else if(H5FD_STRIPE==fdriver)
+        HDstrcpy(dname,"H5FD_STRIPE");
+    else if(H5FD_TRACE==fdriver)
+        HDstrcpy(dname,"H5FD_TRACE");
     else
         HDstrcpy(dname,"Unknown driver");
 
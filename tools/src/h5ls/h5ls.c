@@ -416,6 +416,10 @@ print_native_type(h5tools_str_t *buffer, hid_t type, int ind)
         } else if (H5Tequal(type, H5T_NATIVE_LDOUBLE)==TRUE) {
             h5tools_str_append(buffer, "native long double");
 #endif
+        } else if (H5Tequal(type, H5T_NATIVE_FLOAT16)==TRUE) {
+            h5tools_str_append(buffer, "native 16-bit float");
+        } else if (H5Tequal(type, H5T_NATIVE_BFLOAT16)==TRUE) {
+            h5tools_str_append(buffer, "native bfloat16");
         } else if (H5Tequal(type, H5T_NATIVE_INT8)==TRUE) {
             h5tools_str_append(buffer, "native int8_t");
         } else if (H5Tequal(type, H5T_NATIVE_UINT8)==TRUE) {
@@ -521,6 +525,18 @@ print_ieee_type(h5tools_str_t *buffer, hid_t type, int ind)
     else if (H5Tequal(type, H5T_IEEE_F64LE)==TRUE) {
         h5tools_str_append(buffer, "IEEE 64-bit little-endian float");
     }
+    else if (H5Tequal(type, H5T_IEEE_F16BE)==TRUE) {
+        h5tools_str_append(buffer, "IEEE 16-bit big-endian float");
+    }
+    else if (H5Tequal(type, H5T_IEEE_F16LE)==TRUE) {
+        h5tools_str_append(buffer, "IEEE 16-bit little-endian float");
+    }
+    else if (H5Tequal(type, H5T_FLOAT_BFLOAT16BE)==TRUE) {
+        h5tools_str_append(buffer, "16-bit big-endian bfloat16");
+    }
+    else if (H5Tequal(type, H5T_FLOAT_BFLOAT16LE)==TRUE) {
+        h5tools_str_append(buffer, "16-bit little-endian bfloat16");
+    }
     else {
         return print_float_type(buffer, type, ind);
     }
@@ -0,0 +1,862 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: A tool to summarize the I/O trace written by the trace driver
+ *          (H5Pset_fapl_trace), and to replay it against another driver
+ *          for benchmarking.  A trace file holds the operations of every
+ *          session that traced to it; they are summarized and replayed
+ *          together.
+ */
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+/* Name of tool */
+#define PROGRAMNAME     "h5iotrace"
+
+/* Number of records read from the trace at a time */
+#define NRECORDS_READ   1024
+
+/* Defaults for the hot region report */
+#define DEFAULT_REGION_SIZE     (1024 * 1024)
+#define DEFAULT_NREGIONS        10
+
+/* A decoded trace record */
+typedef struct trace_rec_t {
+    unsigned    session;        /* Index of the session in the trace */
+    uint64_t    start;          /* Start time (ns since the file was opened) */
+    uint64_t    latency;        /* Time taken (ns) */
+    uint64_t    addr;           /* File address */
+    uint64_t    size;           /* Size of the operation */
+    unsigned    op;             /* H5FD_TRACE_OP_* */
+    unsigned    type;           /* H5FD_mem_t of the operation */
+} trace_rec_t;
+
+/* A session in the trace: one opening of the traced file */
+typedef struct session_t {
+    uint64_t    start;          /* Start time (ns since the Epoch) */
+    unsigned    pid;            /* Process ID */
+    uint64_t    duration;       /* End of the last operation (ns since the start) */
+} session_t;
+
+/* A trace file being read */
+typedef struct trace_file_t {
+    FILE        *fp;            /* The trace file */
+    size_t      nleft;          /* Number of records left in the current block */
+    unsigned    session;        /* Index of the session of the current block */
+    session_t   *sessions;      /* Sessions found so far */
+    unsigned    nsessions;      /* Number of sessions found so far */
+    unsigned    sessions_alloc; /* Number of sessions allocated */
+    int         error;          /* Whether the trace is corrupt */
+} trace_file_t;
+
+/* Statistics for one kind of operation */
+typedef struct op_stats_t {
+    unsigned long long  count;          /* Number of operations */
+    unsigned long long  bytes;          /* Number of bytes */
+    unsigned long long  sequential;     /* Operations starting where the previous one ended */
+    uint64_t            total_latency;  /* Sum of latencies (ns) */
+    uint64_t            max_latency;    /* Largest latency (ns) */
+    uint64_t            next_addr;      /* End of the previous operation */
+} op_stats_t;
+
+/* Accesses to one region of the file */
+typedef struct region_t {
+    uint64_t            index;          /* Region number */
+    unsigned long long  count;          /* Number of accesses */
+} region_t;
+
+static const char *op_names[] = {"read", "write", "flush", "truncate"};
+static const char *type_names[] = {"default", "super", "btree", "draw", "gheap", "lheap", "ohdr"};
+
+static char *trace_name_g = NULL;
+static char *replay_name_g = NULL;
+static const char *driver_g = "sec2";
+static uint64_t region_size_g = DEFAULT_REGION_SIZE;
+static unsigned nregions_g = DEFAULT_NREGIONS;
+
+/*
+ * Command-line options: The user can specify short or long-named
+ * parameters.
+ */
+static const char *s_opts = "hVr:d:g:n:";
+static struct long_options l_opts[] = {
+        { "help", no_arg, 'h' },
+        { "hel", no_arg, 'h'},
+        { "he", no_arg, 'h'},
+        { "version", no_arg, 'V' },
+        { "versio", no_arg, 'V' },
+        { "versi", no_arg, 'V' },
+        { "vers", no_arg, 'V' },
+        { "replay", require_arg, 'r' },
+        { "repla", require_arg, 'r' },
+        { "repl", require_arg, 'r' },
+        { "rep", require_arg, 'r' },
+        { "driver", require_arg, 'd' },
+        { "drive", require_arg, 'd' },
+        { "driv", require_arg, 'd' },
+        { "dri", require_arg, 'd' },
+        { "region", require_arg, 'g' },
+        { "regio", require_arg, 'g' },
+        { "regi", require_arg, 'g' },
+        { "reg", require_arg, 'g' },
+        { "top", require_arg, 'n' },
+        { "to", require_arg, 'n' },
+        { NULL, 0, '\0' }
+};
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Prints a usage message
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void usage(const char *prog)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] trace_file\n", prog);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "   -h, --help                Print a usage message and exit\n");
+    HDfprintf(stdout, "   -V, --version             Print version number and exit\n");
+    HDfprintf(stdout, "   -r F, --replay=F          Replay the trace against file F instead of\n");
+    HDfprintf(stdout, "                             summarizing it.  F is created or truncated.\n");
+    HDfprintf(stdout, "   -d D, --driver=D          Driver to replay with: sec2 (default), stdio,\n");
+    HDfprintf(stdout, "                             core or direct\n");
+    HDfprintf(stdout, "   -g S, --region=S          Size in bytes of the regions counted for the\n");
+    HDfprintf(stdout, "                             hot region report (default %d)\n", DEFAULT_REGION_SIZE);
+    HDfprintf(stdout, "   -n N, --top=N             Number of hot regions reported (default %d)\n", DEFAULT_NREGIONS);
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "Examples of use:\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5iotrace file.h5.trace\n");
+    HDfprintf(stdout, "  Summarize the operations recorded in <file.h5.trace>.\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "h5iotrace -r /scratch/replay.h5 -d direct file.h5.trace\n");
+    HDfprintf(stdout, "  Repeat the operations recorded in <file.h5.trace> on </scratch/replay.h5>\n");
+    HDfprintf(stdout, "  with the direct I/O driver, and report how long they took.\n");
+} /* usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: parse_command_line
+ *
+ * Purpose: Parses command line and sets up global variable to control output
+ *
+ * Return:  Success: 0
+ *
+ *          Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+parse_command_line(int argc, const char **argv)
+{
+    int opt;
+
+     /* no arguments */
+    if (argc == 1) {
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    }
+
+    /* parse command line options */
+    while((opt = get_option(argc, argv, s_opts, l_opts)) != EOF) {
+        switch((char)opt) {
+            case 'h':
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'V':
+                print_version(h5tools_getprogname());
+                h5tools_setstatus(EXIT_SUCCESS);
+                goto done;
+
+            case 'r':
+                replay_name_g = HDstrdup(opt_arg);
+                break;
+
+            case 'd':
+                driver_g = opt_arg;
+                break;
+
+            case 'g':
+                region_size_g = (uint64_t)HDstrtoull(opt_arg, NULL, 0);
+                if(0 == region_size_g) {
+                    error_msg("region size must be positive\n");
+                    h5tools_setstatus(EXIT_FAILURE);
+                    goto error;
+                }
+                break;
+
+            case 'n':
+                nregions_g = (unsigned)HDstrtoul(opt_arg, NULL, 0);
+                break;
+
+            default:
+                usage(h5tools_getprogname());
+                h5tools_setstatus(EXIT_FAILURE);
+                goto error;
+        } /* end switch */
+    } /* end while */
+
+    /* check for file name to be processed */
+    if(argc <= opt_ind) {
+        error_msg("missing trace file name\n");
+        usage(h5tools_getprogname());
+        h5tools_setstatus(EXIT_FAILURE);
+        goto error;
+    } /* end if */
+
+    trace_name_g = HDstrdup(argv[opt_ind]);
+
+done:
+    return(0);
+
+error:
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    leave
+ *
+ * Purpose:     Close the tools library and exit
+ *
+ * Return:      Does not return
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+leave(int ret)
+{
+    h5tools_close();
+    HDexit(ret);
+} /* leave() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    decode_uint
+ *
+ * Purpose:     Decodes a little-endian unsigned integer of N bytes
+ *
+ * Return:      The value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+decode_uint(const unsigned char *p, unsigned n)
+{
+    uint64_t    val = 0;
+
+    while(n-- > 0)
+        val = (val << 8) | p[n];
+
+    return val;
+} /* decode_uint() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_header
+ *
+ * Purpose:     Reads the header of the next block of records, and finds
+ *              or adds its session
+ *
+ * Return:      1 if a header was read, 0 at the end of the trace, -1 if
+ *              the header is bad
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+read_header(trace_file_t *tf)
+{
+    unsigned char   hdr[H5FD_TRACE_HEADER_SIZE];
+    uint64_t        start;
+    unsigned        pid;
+    unsigned        u;
+
+    if(1 != HDfread(hdr, sizeof(hdr), (size_t)1, tf->fp))
+        return 0;
+    if(HDmemcmp(hdr, H5FD_TRACE_MAGIC, (size_t)8)) {
+        error_msg("\"%s\" is not a trace file, or is corrupt\n", trace_name_g);
+        return -1;
+    }
+    if(H5FD_TRACE_VERSION != decode_uint(hdr + 8, 4) || H5FD_TRACE_RECORD_SIZE != decode_uint(hdr + 12, 4)) {
+        error_msg("unsupported trace file version\n");
+        return -1;
+    }
+    start = decode_uint(hdr + 16, 8);
+    pid = (unsigned)decode_uint(hdr + 24, 4);
+    tf->nleft = (size_t)decode_uint(hdr + 28, 4);
+
+    /* Blocks of the same session are usually together */
+    if(tf->nsessions > 0 && tf->sessions[tf->session].start == start && tf->sessions[tf->session].pid == pid)
+        return 1;
+    for(u = 0; u < tf->nsessions; u++)
+        if(tf->sessions[u].start == start && tf->sessions[u].pid == pid)
+            break;
+    if(u == tf->nsessions) {
+        if(tf->nsessions == tf->sessions_alloc) {
+            session_t *tmp;
+
+            tf->sessions_alloc = tf->sessions_alloc ? 2 * tf->sessions_alloc : 16;
+            if(NULL == (tmp = (session_t *)HDrealloc(tf->sessions, tf->sessions_alloc * sizeof(session_t)))) {
+                error_msg("unable to allocate memory\n");
+                return -1;
+            }
+            tf->sessions = tmp;
+        }
+        tf->sessions[u].start = start;
+        tf->sessions[u].pid = pid;
+        tf->sessions[u].duration = 0;
+        tf->nsessions++;
+    }
+    tf->session = u;
+
+    return 1;
+} /* read_header() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    open_trace
+ *
+ * Purpose:     Opens the trace file and checks its first header
+ *
+ * Return:      Success: 0
+ *
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+open_trace(const char *name, trace_file_t *tf)
+{
+    int ret;
+
+    HDmemset(tf, 0, sizeof(*tf));
+
+    if(NULL == (tf->fp = HDfopen(name, "rb"))) {
+        error_msg("unable to open trace file \"%s\"\n", name);
+        return -1;
+    }
+    if((ret = read_header(tf)) <= 0) {
+        if(0 == ret)
+            error_msg("\"%s\" is not a trace file\n", name);
+        return -1;
+    }
+
+    return 0;
+} /* open_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    close_trace
+ *
+ * Purpose:     Closes the trace file
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+close_trace(trace_file_t *tf)
+{
+    if(tf->fp)
+        HDfclose(tf->fp);
+    if(tf->sessions)
+        HDfree(tf->sessions);
+    HDmemset(tf, 0, sizeof(*tf));
+} /* close_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_records
+ *
+ * Purpose:     Reads and decodes up to NRECORDS_READ records, moving on
+ *              to the following blocks as needed.  Sets TF->error if the
+ *              trace is corrupt.
+ *
+ * Return:      The number of records read, zero at the end of the trace
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+read_records(trace_file_t *tf, trace_rec_t *recs)
+{
+    unsigned char   buf[NRECORDS_READ * H5FD_TRACE_RECORD_SIZE];
+    size_t          nrecs = 0, n, u;
+
+    while(nrecs < NRECORDS_READ && !tf->error) {
+        int ret;
+
+        /* Move on to the next block */
+        if(0 == tf->nleft) {
+            if((ret = read_header(tf)) <= 0) {
+                if(ret < 0)
+                    tf->error = 1;
+                break;
+            }
+            continue;
+        }
+
+        n = HDfread(buf, (size_t)H5FD_TRACE_RECORD_SIZE, MIN(tf->nleft, NRECORDS_READ - nrecs), tf->fp);
+        if(0 == n) {
+            /* A block cut short, e.g. by a crash */
+            tf->nleft = 0;
+            break;
+        }
+        for(u = 0; u < n; u++, nrecs++) {
+            const unsigned char *p = buf + u * H5FD_TRACE_RECORD_SIZE;
+            trace_rec_t *r = &recs[nrecs];
+
+            r->session = tf->session;
+            r->start = decode_uint(p, 8);
+            r->latency = decode_uint(p + 8, 8);
+            r->addr = decode_uint(p + 16, 8);
+            r->size = decode_uint(p + 24, 8);
+            r->op = p[32];
+            r->type = p[33];
+            tf->sessions[tf->session].duration = MAX(tf->sessions[tf->session].duration, r->start + r->latency);
+        } /* end for */
+        tf->nleft -= n;
+    } /* end while */
+
+    return nrecs;
+} /* read_records() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    cmp_region_index / cmp_region_count
+ *
+ * Purpose:     qsort() callbacks ordering regions by number, and by
+ *              decreasing access count
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+cmp_region_index(const void *_a, const void *_b)
+{
+    const uint64_t *a = (const uint64_t *)_a;
+    const uint64_t *b = (const uint64_t *)_b;
+
+    return (*a > *b) - (*a < *b);
+} /* cmp_region_index() */
+
+static int
+cmp_region_count(const void *_a, const void *_b)
+{
+    const region_t *a = (const region_t *)_a;
+    const region_t *b = (const region_t *)_b;
+
+    if(a->count != b->count)
+        return (a->count < b->count) ? 1 : -1;
+    return (a->index > b->index) - (a->index < b->index);
+} /* cmp_region_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    summarize
+ *
+ * Purpose:     Prints a summary of the operations in the trace: counts,
+ *              sizes, latencies and sequentiality of each operation, the
+ *              split between metadata and raw data, and the most
+ *              frequently accessed regions of the file.
+ *
+ * Return:      Success: 0
+ *
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+summarize(trace_file_t *tf)
+{
+    trace_rec_t         *recs = NULL;
+    op_stats_t          ops[H5FD_TRACE_OP_TRUNCATE + 1];
+    unsigned long long  type_count[H5FD_MEM_NTYPES][2];
+    unsigned long long  type_bytes[H5FD_MEM_NTYPES][2];
+    unsigned long long  meta_count = 0, meta_bytes = 0, raw_count = 0, raw_bytes = 0;
+    unsigned long long  nrecs = 0;
+    uint64_t            *region_idx = NULL;
+    size_t              nregion_idx = 0, region_alloc = 0;
+    region_t            *regions = NULL;
+    size_t              nregions = 0;
+    uint64_t            duration = 0;
+    size_t              n, u;
+    int                 ret_value = 0;
+
+    HDmemset(ops, 0, sizeof(ops));
+    HDmemset(type_count, 0, sizeof(type_count));
+    HDmemset(type_bytes, 0, sizeof(type_bytes));
+
+    if(NULL == (recs = (trace_rec_t *)HDmalloc(NRECORDS_READ * sizeof(trace_rec_t)))) {
+        error_msg("unable to allocate memory\n");
+        ret_value = -1;
+        goto done;
+    }
+
+    while((n = read_records(tf, recs)) > 0) {
+        for(u = 0; u < n; u++) {
+            const trace_rec_t *r = &recs[u];
+            op_stats_t *s;
+
+            if(r->op > H5FD_TRACE_OP_TRUNCATE)
+                continue;
+            nrecs++;
+
+            s = &ops[r->op];
+            s->count++;
+            s->bytes += r->size;
+            s->total_latency += r->latency;
+            s->max_latency = MAX(s->max_latency, r->latency);
+
+            if(r->op != H5FD_TRACE_OP_READ && r->op != H5FD_TRACE_OP_WRITE)
+                continue;
+
+            if(s->count > 1 && r->addr == s->next_addr)
+                s->sequential++;
+            s->next_addr = r->addr + r->size;
+
+            if(r->type < H5FD_MEM_NTYPES) {
+                type_count[r->type][r->op]++;
+                type_bytes[r->type][r->op] += r->size;
+            }
+            if(H5FD_MEM_DRAW == r->type) {
+                raw_count++;
+                raw_bytes += r->size;
+            }
+            else {
+                meta_count++;
+                meta_bytes += r->size;
+            }
+
+            /* Remember the region accessed */
+            if(nregion_idx == region_alloc) {
+                uint64_t *tmp;
+
+                region_alloc = region_alloc ? 2 * region_alloc : 4096;
+                if(NULL == (tmp = (uint64_t *)HDrealloc(region_idx, region_alloc * sizeof(uint64_t)))) {
+                    error_msg("unable to allocate memory\n");
+                    ret_value = -1;
+                    goto done;
+                }
+                region_idx = tmp;
+            }
+            region_idx[nregion_idx++] = r->addr / region_size_g;
+        } /* end for */
+    } /* end while */
+
+    if(tf->error) {
+        ret_value = -1;
+        goto done;
+    }
+
+    /* The sessions' durations add up, even if some of them overlapped */
+    for(u = 0; u < tf->nsessions; u++)
+        duration += tf->sessions[u].duration;
+
+    HDfprintf(stdout, "Trace file: %s\n", trace_name_g);
+    HDfprintf(stdout, "Records: %llu in %u session%s over %.6f seconds\n\n", nrecs, tf->nsessions,
+            tf->nsessions == 1 ? "" : "s", (double)duration / 1.0e9);
+
+    HDfprintf(stdout, "%-10s %12s %16s %12s %14s %14s\n", "Operation", "Count", "Bytes",
+            "Sequential", "Avg lat (us)", "Max lat (us)");
+    for(u = 0; u <= H5FD_TRACE_OP_TRUNCATE; u++) {
+        if(0 == ops[u].count)
+            continue;
+        HDfprintf(stdout, "%-10s %12llu %16llu ", op_names[u], ops[u].count, ops[u].bytes);
+        if(u == H5FD_TRACE_OP_READ || u == H5FD_TRACE_OP_WRITE)
+            HDfprintf(stdout, "%11.1f%%", ops[u].count > 1 ? 100.0 * (double)ops[u].sequential / (double)(ops[u].count - 1) : 0.0);
+        else
+            HDfprintf(stdout, "%12s", "-");
+        HDfprintf(stdout, " %14.3f %14.3f\n", (double)ops[u].total_latency / (double)ops[u].count / 1000.0,
+                (double)ops[u].max_latency / 1000.0);
+    } /* end for */
+
+    HDfprintf(stdout, "\n%-10s %12s %16s %12s %16s\n", "Mem type", "Reads", "Read bytes", "Writes", "Write bytes");
+    for(u = 0; u < H5FD_MEM_NTYPES; u++) {
+        if(0 == type_count[u][0] && 0 == type_count[u][1])
+            continue;
+        HDfprintf(stdout, "%-10s %12llu %16llu %12llu %16llu\n", type_names[u],
+                type_count[u][0], type_bytes[u][0], type_count[u][1], type_bytes[u][1]);
+    } /* end for */
+
+    if(meta_count + raw_count > 0)
+        HDfprintf(stdout, "\nMetadata: %.1f%% of reads and writes, %.1f%% of bytes\n",
+                100.0 * (double)meta_count / (double)(meta_count + raw_count),
+                (meta_bytes + raw_bytes) ? 100.0 * (double)meta_bytes / (double)(meta_bytes + raw_bytes) : 0.0);
+
+    /* Count the accesses to each region, and report the busiest */
+    if(nregion_idx > 0 && nregions_g > 0) {
+        HDqsort(region_idx, nregion_idx, sizeof(uint64_t), cmp_region_index);
+        if(NULL == (regions = (region_t *)HDmalloc(nregion_idx * sizeof(region_t)))) {
+            error_msg("unable to allocate memory\n");
+            ret_value = -1;
+            goto done;
+        }
+        for(u = 0; u < nregion_idx; u++) {
+            if(nregions == 0 || regions[nregions - 1].index != region_idx[u]) {
+                regions[nregions].index = region_idx[u];
+                regions[nregions].count = 0;
+                nregions++;
+            }
+            regions[nregions - 1].count++;
+        } /* end for */
+        HDqsort(regions, nregions, sizeof(region_t), cmp_region_count);
+
+        HDfprintf(stdout, "\nHot regions (%llu of %llu regions of %llu bytes accessed):\n",
+                (unsigned long long)MIN(nregions, nregions_g), (unsigned long long)nregions,
+                (unsigned long long)region_size_g);
+        HDfprintf(stdout, "%20s %12s %9s\n", "Start address", "Accesses", "Share");
+        for(u = 0; u < nregions && u < nregions_g; u++)
+            HDfprintf(stdout, "%20llu %12llu %8.1f%%\n", (unsigned long long)(regions[u].index * region_size_g),
+                    regions[u].count, 100.0 * (double)regions[u].count / (double)nregion_idx);
+    } /* end if */
+
+done:
+    if(recs)
+        HDfree(recs);
+    if(region_idx)
+        HDfree(region_idx);
+    if(regions)
+        HDfree(regions);
+
+    return ret_value;
+} /* summarize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    replay
+ *
+ * Purpose:     Performs the reads, writes, flushes and truncates in the
+ *              trace on a new file, in order and as fast as possible,
+ *              and reports how long they took.  Written data is a fixed
+ *              pattern.
+ *
+ * Return:      Success: 0
+ *
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+replay(trace_file_t *tf)
+{
+    trace_rec_t         *recs = NULL;
+    hid_t               fapl = -1;
+    H5FD_t              *file = NULL;
+    unsigned char       *buf = NULL;
+    size_t              buf_size = 0;
+    haddr_t             eoa = 0;
+    unsigned long long  nops = 0, nread = 0, nwritten = 0;
+    uint64_t            traced = 0;
+    H5_timer_t          timer;
+    double              elapsed;
+    size_t              n, u;
+    int                 ret_value = 0;
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        error_msg("H5Pcreate\n");
+        ret_value = -1;
+        goto done;
+    }
+    if(!HDstrcmp(driver_g, "sec2"))
+        ret_value = H5Pset_fapl_sec2(fapl);
+    else if(!HDstrcmp(driver_g, "stdio"))
+        ret_value = H5Pset_fapl_stdio(fapl);
+    else if(!HDstrcmp(driver_g, "core"))
+        ret_value = H5Pset_fapl_core(fapl, (size_t)(1024 * 1024), TRUE);
+#ifdef H5_HAVE_DIRECT
+    else if(!HDstrcmp(driver_g, "direct"))
+        ret_value = H5Pset_fapl_direct(fapl, (size_t)1024, (size_t)4096, (size_t)(16 * 1024 * 1024));
+#endif /* H5_HAVE_DIRECT */
+    else {
+        error_msg("unknown driver \"%s\"\n", driver_g);
+        ret_value = -1;
+        goto done;
+    }
+    if(ret_value < 0) {
+        error_msg("unable to set driver \"%s\"\n", driver_g);
+        goto done;
+    }
+
+    if(NULL == (file = H5FDopen(replay_name_g, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF))) {
+        error_msg("unable to create \"%s\"\n", replay_name_g);
+        ret_value = -1;
+        goto done;
+    }
+
+    if(NULL == (recs = (trace_rec_t *)HDmalloc(NRECORDS_READ * sizeof(trace_rec_t)))) {
+        error_msg("unable to allocate memory\n");
+        ret_value = -1;
+        goto done;
+    }
+
+    H5_timer_reset(&timer);
+    H5_timer_begin(&timer);
+    while((n = read_records(tf, recs)) > 0) {
+        for(u = 0; u < n; u++) {
+            const trace_rec_t *r = &recs[u];
+            H5FD_mem_t type = r->type < H5FD_MEM_NTYPES ? (H5FD_mem_t)r->type : H5FD_MEM_DEFAULT;
+
+            switch(r->op) {
+                case H5FD_TRACE_OP_READ:
+                case H5FD_TRACE_OP_WRITE:
+                    if(r->size > buf_size) {
+                        unsigned char *tmp;
+
+                        if(NULL == (tmp = (unsigned char *)HDrealloc(buf, (size_t)r->size))) {
+                            error_msg("unable to allocate memory\n");
+                            ret_value = -1;
+                            goto done;
+                        }
+                        buf = tmp;
+                        HDmemset(buf + buf_size, 0xa5, (size_t)r->size - buf_size);
+                        buf_size = (size_t)r->size;
+                    }
+                    if(r->addr + r->size > eoa) {
+                        eoa = r->addr + r->size;
+                        if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, eoa) < 0) {
+                            error_msg("unable to set end of address space\n");
+                            ret_value = -1;
+                            goto done;
+                        }
+                    }
+                    if(r->op == H5FD_TRACE_OP_READ) {
+                        if(H5FDread(file, type, H5P_DEFAULT, r->addr, (size_t)r->size, buf) < 0) {
+                            error_msg("read failed\n");
+                            ret_value = -1;
+                            goto done;
+                        }
+                        nread += r->size;
+                    }
+                    else {
+                        if(H5FDwrite(file, type, H5P_DEFAULT, r->addr, (size_t)r->size, buf) < 0) {
+                            error_msg("write failed\n");
+                            ret_value = -1;
+                            goto done;
+                        }
+                        nwritten += r->size;
+                    }
+                    break;
+
+                case H5FD_TRACE_OP_FLUSH:
+                    if(H5FDflush(file, H5P_DEFAULT, FALSE) < 0) {
+                        error_msg("flush failed\n");
+                        ret_value = -1;
+                        goto done;
+                    }
+                    break;
+
+                case H5FD_TRACE_OP_TRUNCATE:
+                    eoa = r->addr;
+                    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, eoa) < 0 || H5FDtruncate(file, H5P_DEFAULT, FALSE) < 0) {
+                        error_msg("truncate failed\n");
+                        ret_value = -1;
+                        goto done;
+                    }
+                    break;
+
+                default:
+                    continue;
+            } /* end switch */
+
+            nops++;
+            traced += r->latency;
+        } /* end for */
+    } /* end while */
+    H5_timer_end(NULL, &timer);
+    elapsed = timer.etime;
+    if(tf->error) {
+        ret_value = -1;
+        goto done;
+    }
+
+    HDfprintf(stdout, "Replayed %llu operations on %s with the %s driver\n", nops, replay_name_g, driver_g);
+    HDfprintf(stdout, "Bytes read:    %llu\n", nread);
+    HDfprintf(stdout, "Bytes written: %llu\n", nwritten);
+    HDfprintf(stdout, "Elapsed:       %.6f seconds (%.6f seconds when traced)\n", elapsed, (double)traced / 1.0e9);
+    if(elapsed > 0.0)
+        HDfprintf(stdout, "Throughput:    %.2f MB/s\n", (double)(nread + nwritten) / (1024.0 * 1024.0) / elapsed);
+
+done:
+    if(file && H5FDclose(file) < 0) {
+        error_msg("unable to close \"%s\"\n", replay_name_g);
+        ret_value = -1;
+    }
+    if(fapl >= 0)
+        H5Pclose(fapl);
+    if(recs)
+        HDfree(recs);
+    if(buf)
+        HDfree(buf);
+
+    return ret_value;
+} /* replay() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Summarizes a trace, or replays it with the -r option.
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main (int argc, const char *argv[])
+{
+    trace_file_t tf;
+
+    HDmemset(&tf, 0, sizeof(tf));
+    h5tools_setprogname(PROGRAMNAME);
+    h5tools_setstatus(EXIT_SUCCESS);
+
+    /* Disable the HDF5 library's error reporting */
+    H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+    /* initialize h5tools lib */
+    h5tools_init();
+
+    /* Parse command line options */
+    if(parse_command_line(argc, argv) < 0)
+        goto done;
+
+    if(trace_name_g == NULL)
+        goto done;
+
+    if(open_trace(trace_name_g, &tf) < 0) {
+        h5tools_setstatus(EXIT_FAILURE);
+        goto done;
+    }
+
+    if((replay_name_g ? replay(&tf) : summarize(&tf)) < 0)
+        h5tools_setstatus(EXIT_FAILURE);
+
+done:
+    close_trace(&tf);
+    if(trace_name_g)
+        HDfree(trace_name_g);
+    if(replay_name_g)
+        HDfree(replay_name_g);
+
+    leave(h5tools_getstatus());
+} /* main() */
+
@@ -29,6 +29,8 @@ add_test (
     COMMAND    ${CMAKE_COMMAND}
         -E remove
         chunk.h5
+        cmpd_read.h5
+        fs_churn.h5
         iopipe.h5
         iopipe.raw
         x-diag-rd.dat
@@ -103,6 +105,36 @@ else ()
   )
 endif ()
 
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_fs_churn COMMAND $<TARGET_FILE:fs_churn> "-n" "512" "-r" "2")
+else ()
+  add_test (NAME PERFORM_fs_churn COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:fs_churn>"
+      -D "TEST_ARGS:STRING=-n;512;-r;2"
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=fs_churn.txt"
+      #-D "TEST_REFERENCE=fs_churn.out"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_cmpd_read COMMAND $<TARGET_FILE:cmpd_read> "-n" "1000")
+else ()
+  add_test (NAME PERFORM_cmpd_read COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:cmpd_read>"
+      -D "TEST_ARGS:STRING=-n;1000"
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=cmpd_read.txt"
+      #-D "TEST_REFERENCE=cmpd_read.out"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+
 if (HDF5_ENABLE_USING_MEMCHECKER)
   add_test (NAME PERFORM_perf_meta COMMAND $<TARGET_FILE:perf_meta>)
 else ()
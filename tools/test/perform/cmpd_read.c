@@ -0,0 +1,271 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Measure the per-call overhead of small reads from a dataset of
+ *           wide compound records.
+ *
+ *           The dataset's compound type has many integer fields, and the
+ *           memory type lists the same fields (or every STEP-th field) in
+ *           reverse order, so that every H5Dread() has to look up and run
+ *           a compound conversion.  Reads of a few records each are
+ *           dominated by that overhead rather than by I/O, so this reports
+ *           the time per read as well as the time of the lookup alone
+ *           (with H5Tfind()).
+ *
+ *           With -w the memory type keeps the field order and only widens
+ *           its last field, so that most of each record can be copied as
+ *           is.  Larger reads (-r) then measure the conversion itself.
+ */
+
+/* See H5private.h for how to include headers */
+#undef NDEBUG
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILE_NAME_1     "cmpd_read.h5"
+
+/* Default parameters */
+#define CMPD_READ_NFIELDS   200         /* # of fields in the compound type */
+#define CMPD_READ_NREADS    20000       /* # of reads to time */
+#define CMPD_READ_NRECS     4           /* # of records per read */
+#define CMPD_READ_NELMTS    1024        /* # of records in the dataset */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  usage
+ *
+ * Purpose:  Prints a usage message and exits.
+ *
+ * Return:  never returns
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stderr, "usage: %s [-f NFIELDS] [-n NREADS] [-r NRECS] [-s STEP] [-w]\n", prog);
+    HDfprintf(stderr, "\
+    NFIELDS    -- Number of fields in the compound type (default %d)\n\
+    NREADS     -- Number of reads to time (default %d)\n\
+    NRECS      -- Number of records per read (default %d)\n\
+    STEP       -- Read every STEP-th field only (default 1)\n\
+    -w         -- Keep the field order, but widen the last field read\n",
+        CMPD_READ_NFIELDS, CMPD_READ_NREADS, CMPD_READ_NRECS);
+    HDexit(EXIT_FAILURE);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:  memb_offset
+ *
+ * Purpose:  Returns the offset of the K-th of NMEMBS fields in the memory
+ *           type.
+ *
+ * Return:  The offset
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+memb_offset(unsigned k, unsigned nmembs, hbool_t widen)
+{
+    return (widen ? k : nmembs - k - 1) * sizeof(int);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:  create_cmpd
+ *
+ * Purpose:  Creates a compound type of integer fields: all NFIELDS fields
+ *           in order when STEP is 0, otherwise every STEP-th field laid
+ *           out as described by memb_offset(), with the last one widened
+ *           to a long long if WIDEN is set.
+ *
+ * Return:  Success:  datatype ID
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+create_cmpd(unsigned nfields, unsigned step, hbool_t widen)
+{
+    char     name[32];
+    hid_t    tid = -1;
+    unsigned nmembs = step ? (nfields + step - 1) / step : nfields;
+    unsigned k;
+
+    if((tid = H5Tcreate(H5T_COMPOUND, nmembs * sizeof(int) +
+            (widen ? sizeof(long long) - sizeof(int) : 0))) < 0)
+        goto error;
+    for(k = 0; k < nmembs; k++) {
+        HDsnprintf(name, sizeof(name), "field %03u", step ? k * step : k);
+        if(!step) {
+            if(H5Tinsert(tid, name, k * sizeof(int), H5T_NATIVE_INT) < 0)
+                goto error;
+        } /* end if */
+        else if(H5Tinsert(tid, name, memb_offset(k, nmembs, widen),
+                (widen && k == nmembs - 1) ? H5T_NATIVE_LLONG : H5T_NATIVE_INT) < 0)
+            goto error;
+    } /* end for */
+
+    return tid;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(tid);
+    } H5E_END_TRY;
+    return -1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:  Runs the small compound read benchmark.
+ *
+ * Return:  Success:  0
+ *          Failure:  1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hid_t    file = -1, dset = -1, fspace = -1, mspace = -1;
+    hid_t    ftype = -1, mtype = -1;
+    unsigned nfields = CMPD_READ_NFIELDS;
+    unsigned nreads = CMPD_READ_NREADS;
+    unsigned nrecs = CMPD_READ_NRECS;
+    unsigned step = 1;
+    hbool_t  widen = FALSE;
+    unsigned nmembs;
+    hsize_t  dims[1], start[1], count[1];
+    int     *buf = NULL;
+    H5T_cdata_t *cdata;
+    double   t0, t_find, t_read;
+    unsigned u;
+    int      i;
+
+    /* Parse command-line options */
+    for(i = 1; i < argc; i++) {
+        if(!HDstrcmp(argv[i], "-w")) {
+            widen = TRUE;
+            continue;
+        } /* end if */
+        if(i + 1 >= argc)
+            usage(argv[0]);
+        if(!HDstrcmp(argv[i], "-f"))
+            nfields = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else if(!HDstrcmp(argv[i], "-n"))
+            nreads = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else if(!HDstrcmp(argv[i], "-r"))
+            nrecs = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else if(!HDstrcmp(argv[i], "-s"))
+            step = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else
+            usage(argv[0]);
+    } /* end for */
+    if(nfields < 1 || nreads < 1 || nrecs < 1 || nrecs > CMPD_READ_NELMTS || step < 1)
+        usage(argv[0]);
+    nmembs = (nfields + step - 1) / step;
+
+    if((ftype = create_cmpd(nfields, 0, FALSE)) < 0) goto error;
+    if((mtype = create_cmpd(nfields, step, widen)) < 0) goto error;
+    if(NULL == (buf = (int *)HDcalloc((size_t)CMPD_READ_NELMTS * (nfields + 2), sizeof(int))))
+        goto error;
+    for(u = 0; u < CMPD_READ_NELMTS * nfields; u++)
+        buf[u] = (int)u;
+
+    /* Create and fill the dataset */
+    if((file = H5Fcreate(FILE_NAME_1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    dims[0] = CMPD_READ_NELMTS;
+    if((fspace = H5Screate_simple(1, dims, NULL)) < 0) goto error;
+    if((dset = H5Dcreate2(file, "dset", ftype, fspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dwrite(dset, ftype, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0) goto error;
+
+    HDfprintf(stdout, "%u fields, %u reads of %u records, %u fields %s\n", nfields,
+        nreads, nrecs, nmembs, widen ? "in order, last one widened" : "in reverse order");
+
+    /* Time the conversion path lookup alone */
+    t0 = H5_get_time();
+    for(u = 0; u < nreads; u++)
+        if(NULL == H5Tfind(ftype, mtype, &cdata))
+            goto error;
+    t_find = H5_get_time() - t0;
+
+    /* Time small reads from changing locations */
+    count[0] = nrecs;
+    if((mspace = H5Screate_simple(1, count, NULL)) < 0) goto error;
+    t0 = H5_get_time();
+    for(u = 0; u < nreads; u++) {
+        start[0] = (u * nrecs) % (CMPD_READ_NELMTS - nrecs + 1);
+        if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto error;
+        if(H5Dread(dset, mtype, mspace, fspace, H5P_DEFAULT, buf) < 0)
+            goto error;
+    } /* end for */
+    t_read = H5_get_time() - t0;
+
+    /* Check the first record of the last read */
+    for(u = 0; u < nmembs; u++) {
+        const uint8_t *p = (const uint8_t *)buf + memb_offset(u, nmembs, widen);
+        long long val;
+
+        if(widen && u == nmembs - 1) {
+            long long llval;
+
+            HDmemcpy(&llval, p, sizeof(long long));
+            val = llval;
+        } /* end if */
+        else {
+            int ival;
+
+            HDmemcpy(&ival, p, sizeof(int));
+            val = ival;
+        } /* end else */
+        if(val != (long long)(start[0] * nfields + u * step)) {
+            HDfprintf(stderr, "field %u read incorrectly\n", u * step);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    HDfprintf(stdout, "%-12s %12s %12s\n", "Operation", "Total(s)", "Per call(us)");
+    HDfprintf(stdout, "%-12s %12.4f %12.3f\n", "H5Tfind", t_find, t_find * 1.0e6 / nreads);
+    HDfprintf(stdout, "%-12s %12.4f %12.3f\n", "H5Dread", t_read, t_read * 1.0e6 / nreads);
+
+    if(H5Sclose(mspace) < 0) goto error;
+    if(H5Sclose(fspace) < 0) goto error;
+    if(H5Dclose(dset) < 0) goto error;
+    if(H5Fclose(file) < 0) goto error;
+    if(H5Tclose(mtype) < 0) goto error;
+    if(H5Tclose(ftype) < 0) goto error;
+    HDfree(buf);
+    HDremove(FILE_NAME_1);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+        H5Dclose(dset);
+        H5Fclose(file);
+        H5Tclose(mtype);
+        H5Tclose(ftype);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    HDfprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}
@@ -0,0 +1,269 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:  Stress the file free-space managers with dataset create/delete
+ *           churn and report allocation times and free-space fragmentation.
+ *
+ *           Each round deletes a random half of the datasets in the file and
+ *           re-creates the same number with new random sizes, so that the
+ *           library's free-space managers (see test/freespace.c) have to
+ *           find, split and merge a large number of sections.  After each
+ *           round the free sections tracked for the file are retrieved with
+ *           H5Fget_free_sections() and summarized.
+ */
+
+/* See H5private.h for how to include headers */
+#undef NDEBUG
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILE_NAME_1     "fs_churn.h5"
+
+/* Default parameters */
+#define FS_CHURN_NDSETS     4096        /* # of datasets alive in the file */
+#define FS_CHURN_NROUNDS    8           /* # of delete/re-create rounds */
+#define FS_CHURN_MAX_ELMTS  1024        /* Max. # of (1-byte) elements in a dataset */
+
+
+/*-------------------------------------------------------------------------
+ * Function:  usage
+ *
+ * Purpose:  Prints a usage message and exits.
+ *
+ * Return:  never returns
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stderr, "usage: %s [-n NDSETS] [-r NROUNDS] [-a ALIGNMENT] [-s SEED]\n", prog);
+    HDfprintf(stderr, "\
+    NDSETS     -- Number of datasets kept alive in the file (default %d)\n\
+    NROUNDS    -- Number of delete/re-create rounds (default %d)\n\
+    ALIGNMENT  -- File object alignment, in bytes (default 1, i.e. none)\n\
+    SEED       -- Seed for the random number generator (default 0)\n",
+        FS_CHURN_NDSETS, FS_CHURN_NROUNDS);
+    HDexit(EXIT_FAILURE);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:  create_dset
+ *
+ * Purpose:  Creates a contiguous dataset of random size, with its storage
+ *           allocated immediately.
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+create_dset(hid_t file, hid_t dcpl, unsigned u)
+{
+    char    name[32];
+    hsize_t dims[1];
+    hid_t   space = -1, dset = -1;
+
+    dims[0] = (hsize_t)(1 + (HDrandom() % FS_CHURN_MAX_ELMTS));
+    HDsnprintf(name, sizeof(name), "dset %06u", u);
+
+    if((space = H5Screate_simple(1, dims, NULL)) < 0) goto error;
+    if((dset = H5Dcreate2(file, name, H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if(H5Dclose(dset) < 0) goto error;
+    if(H5Sclose(space) < 0) goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+    } H5E_END_TRY;
+    return -1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:  report_free_space
+ *
+ * Purpose:  Summarizes the free sections tracked for the file: their
+ *           number, total and largest size, and the fragmentation
+ *           (the fraction of free space not in the largest section).
+ *
+ * Return:  Success:  0
+ *          Failure:  -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+report_free_space(hid_t file, unsigned round, double t_delete, double t_create)
+{
+    H5F_sect_info_t *sect_info = NULL;
+    ssize_t nsects;
+    hsize_t tot_size = 0, max_size = 0;
+    ssize_t u;
+
+    if((nsects = H5Fget_free_sections(file, H5FD_MEM_DEFAULT, (size_t)0, NULL)) < 0)
+        goto error;
+    if(nsects > 0) {
+        if(NULL == (sect_info = (H5F_sect_info_t *)HDcalloc((size_t)nsects, sizeof(H5F_sect_info_t))))
+            goto error;
+        if(H5Fget_free_sections(file, H5FD_MEM_DEFAULT, (size_t)nsects, sect_info) != nsects)
+            goto error;
+        for(u = 0; u < nsects; u++) {
+            tot_size += sect_info[u].size;
+            if(sect_info[u].size > max_size)
+                max_size = sect_info[u].size;
+        } /* end for */
+        HDfree(sect_info);
+    } /* end if */
+
+    HDfprintf(stdout, "%5u %10.4f %10.4f %8Zd %12Hu %10Hu %7.3f\n", round,
+        t_delete, t_create, nsects, tot_size, max_size,
+        tot_size ? 1.0 - ((double)max_size / (double)tot_size) : 0.0);
+
+    return 0;
+
+error:
+    if(sect_info)
+        HDfree(sect_info);
+    return -1;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:  main
+ *
+ * Purpose:  Runs the free-space churn benchmark.
+ *
+ * Return:  Success:  0
+ *          Failure:  1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    hid_t    file = -1, fcpl = -1, fapl = -1, dcpl = -1;
+    unsigned ndsets = FS_CHURN_NDSETS;
+    unsigned nrounds = FS_CHURN_NROUNDS;
+    unsigned long alignment = 1;
+    unsigned seed = 0;
+    unsigned *alive = NULL;     /* Dataset # for each live slot */
+    unsigned next_id;
+    unsigned u, r;
+    double   t0, t_delete, t_create;
+    int      i;
+
+    /* Parse command-line options */
+    for(i = 1; i < argc; i++) {
+        if(i + 1 >= argc)
+            usage(argv[0]);
+        if(!HDstrcmp(argv[i], "-n"))
+            ndsets = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else if(!HDstrcmp(argv[i], "-r"))
+            nrounds = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else if(!HDstrcmp(argv[i], "-a"))
+            alignment = HDstrtoul(argv[++i], NULL, 0);
+        else if(!HDstrcmp(argv[i], "-s"))
+            seed = (unsigned)HDstrtoul(argv[++i], NULL, 0);
+        else
+            usage(argv[0]);
+    } /* end for */
+    if(ndsets < 2 || alignment < 1)
+        usage(argv[0]);
+    HDsrandom(seed);
+
+    if(NULL == (alive = (unsigned *)HDmalloc(ndsets * sizeof(unsigned))))
+        goto error;
+
+    /* Track all freed space in persistent free-space managers */
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0) goto error;
+    if(H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_FSM_AGGR, TRUE, (hsize_t)1) < 0)
+        goto error;
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0) goto error;
+    if(H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0) goto error;
+    if(alignment > 1 && H5Pset_alignment(fapl, (hsize_t)1, (hsize_t)alignment) < 0)
+        goto error;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) goto error;
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) goto error;
+
+    if((file = H5Fcreate(FILE_NAME_1, H5F_ACC_TRUNC, fcpl, fapl)) < 0) goto error;
+
+    HDfprintf(stdout, "%u datasets, %u rounds, alignment %lu\n", ndsets, nrounds, alignment);
+    HDfprintf(stdout, "%5s %10s %10s %8s %12s %10s %7s\n", "Round",
+        "Delete(s)", "Create(s)", "Sects", "Free", "Largest", "Frag");
+
+    /* Populate the file */
+    t0 = H5_get_time();
+    for(u = 0; u < ndsets; u++) {
+        if(create_dset(file, dcpl, u) < 0) goto error;
+        alive[u] = u;
+    } /* end for */
+    t_create = H5_get_time() - t0;
+    next_id = ndsets;
+    if(report_free_space(file, 0, 0.0, t_create) < 0) goto error;
+
+    for(r = 1; r <= nrounds; r++) {
+        char name[32];
+
+        /* Shuffle the live datasets, then delete the first half of them */
+        for(u = ndsets - 1; u > 0; u--) {
+            unsigned v = (unsigned)HDrandom() % (u + 1);
+            unsigned tmp = alive[u];
+
+            alive[u] = alive[v];
+            alive[v] = tmp;
+        } /* end for */
+        t0 = H5_get_time();
+        for(u = 0; u < ndsets / 2; u++) {
+            HDsnprintf(name, sizeof(name), "dset %06u", alive[u]);
+            if(H5Ldelete(file, name, H5P_DEFAULT) < 0) goto error;
+        } /* end for */
+        t_delete = H5_get_time() - t0;
+
+        /* Re-create the same number of datasets, with new sizes */
+        t0 = H5_get_time();
+        for(u = 0; u < ndsets / 2; u++) {
+            if(create_dset(file, dcpl, next_id) < 0) goto error;
+            alive[u] = next_id++;
+        } /* end for */
+        t_create = H5_get_time() - t0;
+
+        if(report_free_space(file, r, t_delete, t_create) < 0) goto error;
+    } /* end for */
+
+    if(H5Fclose(file) < 0) goto error;
+    if(H5Pclose(dcpl) < 0) goto error;
+    if(H5Pclose(fapl) < 0) goto error;
+    if(H5Pclose(fcpl) < 0) goto error;
+    HDfree(alive);
+    HDremove(FILE_NAME_1);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(file);
+        H5Pclose(dcpl);
+        H5Pclose(fapl);
+        H5Pclose(fcpl);
+    } H5E_END_TRY;
+    if(alive)
+        HDfree(alive);
+    HDfprintf(stderr, "*** ERRORS DETECTED ***\n");
+    return 1;
+}